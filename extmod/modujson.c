@@ -25,21 +25,55 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "py/objlist.h"
-#include "py/objstringio.h"
+#include "py/objstr.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
 #include "py/stream.h"
 
 #include "supervisor/shared/translate.h"
 
 #if MICROPY_PY_UJSON
 
+// ujson.dump collects the output in a buffer on the C stack and writes it to
+// the stream in chunks, rather than once per token.
+typedef struct _ujson_dump_t {
+    mp_obj_t stream_obj;
+    size_t len;
+    byte buf[MICROPY_PY_UJSON_WRITE_BUF_SIZE];
+} ujson_dump_t;
+
+STATIC void ujson_dump_flush(ujson_dump_t *d) {
+    if (d->len > 0) {
+        mp_stream_write(d->stream_obj, d->buf, d->len, MP_STREAM_RW_WRITE);
+        d->len = 0;
+    }
+}
+
+STATIC void ujson_dump_strn(void *data, const char *str, size_t len) {
+    ujson_dump_t *d = data;
+    if (d->len + len > sizeof(d->buf)) {
+        ujson_dump_flush(d);
+        if (len >= sizeof(d->buf)) {
+            mp_stream_write(d->stream_obj, str, len, MP_STREAM_RW_WRITE);
+            return;
+        }
+    }
+    memcpy(d->buf + d->len, str, len);
+    d->len += len;
+}
+
 STATIC mp_obj_t mod_ujson_dump(mp_obj_t obj, mp_obj_t stream) {
     mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
-    mp_print_t print = {MP_OBJ_TO_PTR(stream), mp_stream_write_adaptor};
+    ujson_dump_t d;
+    d.stream_obj = stream;
+    d.len = 0;
+    mp_print_t print = {&d, ujson_dump_strn};
     mp_obj_print_helper(&print, obj, PRINT_JSON);
+    ujson_dump_flush(&d);
     return mp_const_none;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_ujson_dump_obj, mod_ujson_dump);
@@ -53,7 +87,7 @@ STATIC mp_obj_t mod_ujson_dumps(mp_obj_t obj) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_dumps_obj, mod_ujson_dumps);
 
-// The function below implements a simple non-recursive JSON parser.
+// The functions below implement a simple non-recursive JSON parser.
 //
 // The JSON specification is at http://www.ietf.org/rfc/rfc4627.txt
 // The parser here will parse any valid JSON and return the correct
@@ -65,51 +99,96 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_dumps_obj, mod_ujson_dumps);
 // Most of the work is parsing the primitives (null, false, true, numbers,
 // strings).  It does 1 pass over the input stream.  It tries to be fast and
 // small in code size, while not using more RAM than necessary.
+//
+// The input is read from the stream a buffer at a time, or taken in place
+// from a str/bytes object, and runs of string and number characters are
+// copied out of the buffer in one go.
 
 typedef struct _ujson_stream_t {
     mp_obj_t stream_obj;
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
-    int errcode;
+    byte *buf; // NULL when parsing a str/bytes object in place
+    const byte *pos; // next unread byte
+    const byte *end;
     byte cur;
 } ujson_stream_t;
 
 #define S_EOF (0) // null is not allowed in json stream so is ok as EOF marker
 #define S_END(s) ((s).cur == S_EOF)
 #define S_CUR(s) ((s).cur)
-#define S_NEXT(s) (ujson_stream_next(&(s)))
+#define S_NEXT(s) ((s).pos < (s).end ? ((s).cur = *(s).pos++) : ujson_stream_fill(&(s)))
 
-STATIC byte ujson_stream_next(ujson_stream_t *s) {
-    mp_uint_t ret = s->read(s->stream_obj, &s->cur, 1, &s->errcode);
-    if (s->errcode != 0) {
-        mp_raise_OSError(s->errcode);
-    }
-    if (ret == 0) {
-        s->cur = S_EOF;
+// tokens returned by ujson_token, besides the brackets and braces themselves
+#define TOK_EOF (S_EOF)
+#define TOK_VALUE ('v')
+
+STATIC byte ujson_stream_fill(ujson_stream_t *s) {
+    s->cur = S_EOF;
+    if (s->buf != NULL) {
+        int errcode;
+        mp_uint_t ret = s->read(s->stream_obj, s->buf, MICROPY_PY_UJSON_READ_BUF_SIZE, &errcode);
+        if (ret == MP_STREAM_ERROR) {
+            mp_raise_OSError(errcode);
+        }
+        if (ret > 0) {
+            s->pos = s->buf;
+            s->end = s->buf + ret;
+            s->cur = *s->pos++;
+        }
     }
     return s->cur;
 }
 
-STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
-    const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-    ujson_stream_t s = {stream_obj, stream_p->read, 0, 0};
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
-    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
-    stack.len = 0;
-    stack.items = NULL;
-    mp_obj_t stack_top = MP_OBJ_NULL;
-    mp_obj_type_t *stack_top_type = NULL;
-    mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
+STATIC void ujson_stream_init(ujson_stream_t *s, mp_obj_t obj, byte *buf) {
+    s->stream_obj = obj;
+    if (MP_OBJ_IS_STR_OR_BYTES(obj)) {
+        GET_STR_DATA_LEN(obj, data, len);
+        s->buf = NULL;
+        s->pos = data;
+        s->end = data + len;
+    } else {
+        s->read = mp_get_stream_raise(obj, MP_STREAM_OP_READ)->read;
+        s->buf = buf;
+        s->pos = s->end = buf;
+    }
+    S_NEXT(*s);
+}
+
+STATIC NORETURN void ujson_fail(void) {
+    mp_raise_ValueError(translate("syntax error in JSON"));
+}
+
+STATIC bool ujson_is_num_char(byte c) {
+    return unichar_isdigit(c) || c == '-' || c == '.' || c == 'E' || c == 'e';
+}
+
+// Append the current char, and the chars following it in the buffer for
+// which is_char holds, to vstr.  On return cur is the first char not added.
+STATIC void ujson_take_run(ujson_stream_t *s, vstr_t *vstr, bool (*is_char)(byte)) {
+    const byte *run = s->pos - 1;
+    const byte *p = s->pos;
+    while (p < s->end && is_char(*p)) {
+        p++;
+    }
+    vstr_add_strn(vstr, (const char*)run, p - run);
+    s->pos = p;
+    S_NEXT(*s);
+}
+
+STATIC bool ujson_is_str_char(byte c) {
+    return c != '"' && c != '\\' && c != S_EOF;
+}
+
+// Skip whitespace and separators and read the next token.  Returns TOK_EOF at
+// the end of the input, a bracket or brace, or TOK_VALUE with the primitive
+// stored in *value.
+STATIC byte ujson_token(ujson_stream_t *s, vstr_t *vstr, mp_obj_t *value) {
     for (;;) {
-        cont:
-        if (S_END(s)) {
-            break;
+        byte cur = S_CUR(*s);
+        if (cur == S_EOF) {
+            return TOK_EOF;
         }
-        mp_obj_t next = MP_OBJ_NULL;
-        bool enter = false;
-        byte cur = S_CUR(s);
-        S_NEXT(s);
+        S_NEXT(*s);
         switch (cur) {
             case ',':
             case ':':
@@ -117,90 +196,124 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
             case '\t':
             case '\n':
             case '\r':
-                goto cont;
+                continue;
+            case '[':
+            case '{':
+            case ']':
+            case '}':
+                return cur;
             case 'n':
-                if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
-                    S_NEXT(s);
-                    next = mp_const_none;
-                } else {
-                    goto fail;
+                if (S_CUR(*s) == 'u' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 'l') {
+                    S_NEXT(*s);
+                    *value = mp_const_none;
+                    return TOK_VALUE;
                 }
-                break;
+                ujson_fail();
             case 'f':
-                if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_false;
-                } else {
-                    goto fail;
+                if (S_CUR(*s) == 'a' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 's' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_false;
+                    return TOK_VALUE;
                 }
-                break;
+                ujson_fail();
             case 't':
-                if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
-                    next = mp_const_true;
-                } else {
-                    goto fail;
+                if (S_CUR(*s) == 'r' && S_NEXT(*s) == 'u' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
+                    *value = mp_const_true;
+                    return TOK_VALUE;
                 }
-                break;
+                ujson_fail();
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
-                    if (c == '\\') {
-                        c = S_NEXT(s);
-                        switch (c) {
-                            case 'b': c = 0x08; break;
-                            case 'f': c = 0x0c; break;
-                            case 'n': c = 0x0a; break;
-                            case 'r': c = 0x0d; break;
-                            case 't': c = 0x09; break;
-                            case 'u': {
-                                mp_uint_t num = 0;
-                                for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
-                                    if (c > 9) {
-                                        c -= ('a' - ('9' + 1));
-                                    }
-                                    num = (num << 4) | c;
+                vstr_reset(vstr);
+                while (!S_END(*s) && S_CUR(*s) != '"') {
+                    byte c = S_CUR(*s);
+                    if (c != '\\') {
+                        ujson_take_run(s, vstr, ujson_is_str_char);
+                        continue;
+                    }
+                    c = S_NEXT(*s);
+                    switch (c) {
+                        case 'b': c = 0x08; break;
+                        case 'f': c = 0x0c; break;
+                        case 'n': c = 0x0a; break;
+                        case 'r': c = 0x0d; break;
+                        case 't': c = 0x09; break;
+                        case 'u': {
+                            mp_uint_t num = 0;
+                            for (int i = 0; i < 4; i++) {
+                                c = (S_NEXT(*s) | 0x20) - '0';
+                                if (c > 9) {
+                                    c -= ('a' - ('9' + 1));
                                 }
-                                vstr_add_char(&vstr, num);
-                                goto str_cont;
+                                num = (num << 4) | c;
                             }
+                            vstr_add_char(vstr, num);
+                            goto str_cont;
                         }
                     }
-                    vstr_add_byte(&vstr, c);
+                    vstr_add_byte(vstr, c);
                 str_cont:
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
-                if (S_END(s)) {
-                    goto fail;
+                if (S_END(*s)) {
+                    ujson_fail();
                 }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
-                break;
+                S_NEXT(*s);
+                *value = mp_obj_new_str(vstr->buf, vstr->len);
+                return TOK_VALUE;
             case '-':
             case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9': {
+                vstr_reset(vstr);
+                vstr_add_byte(vstr, cur);
+                while (ujson_is_num_char(S_CUR(*s))) {
+                    ujson_take_run(s, vstr, ujson_is_num_char);
+                }
+                // a short run of digits, the common case, is converted here
                 bool flt = false;
-                vstr_reset(&vstr);
-                for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
-                    if (cur == '.' || cur == 'E' || cur == 'e') {
-                        flt = true;
-                    } else if (cur == '-' || unichar_isdigit(cur)) {
-                        // pass
-                    } else {
-                        break;
+                bool small = vstr->len <= 9 && vstr->len > (vstr->buf[0] == '-');
+                mp_int_t num = 0;
+                for (size_t i = 0; i < vstr->len; i++) {
+                    byte c = vstr->buf[i];
+                    if (unichar_isdigit(c)) {
+                        num = num * 10 + c - '0';
+                    } else if (c != '-' || i > 0) {
+                        small = false;
+                        flt |= c != '-';
                     }
-                    S_NEXT(s);
                 }
-                if (flt) {
-                    next = mp_parse_num_decimal(vstr.buf, vstr.len, false, false, NULL);
+                if (small && MP_SMALL_INT_FITS(num)) {
+                    *value = MP_OBJ_NEW_SMALL_INT(vstr->buf[0] == '-' ? -num : num);
+                } else if (flt) {
+                    *value = mp_parse_num_decimal(vstr->buf, vstr->len, false, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    *value = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
-                break;
+                return TOK_VALUE;
             }
+            default:
+                ujson_fail();
+        }
+    }
+}
+
+STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
+    byte buf[MICROPY_PY_UJSON_READ_BUF_SIZE];
+    ujson_stream_t s;
+    ujson_stream_init(&s, stream_obj, buf);
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
+    stack.len = 0;
+    stack.items = NULL;
+    mp_obj_t stack_top = MP_OBJ_NULL;
+    mp_obj_type_t *stack_top_type = NULL;
+    mp_obj_t stack_key = MP_OBJ_NULL;
+    for (;;) {
+        mp_obj_t next = MP_OBJ_NULL;
+        bool enter = false;
+        switch (ujson_token(&s, &vstr, &next)) {
+            case TOK_EOF:
+                goto success;
             case '[':
                 next = mp_obj_new_list(0, NULL);
                 enter = true;
@@ -222,10 +335,8 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
                 stack.len -= 1;
                 stack_top = stack.items[stack.len];
                 stack_top_type = mp_obj_get_type(stack_top);
-                goto cont;
+                continue;
             }
-            default:
-                goto fail;
         }
         if (stack_top == MP_OBJ_NULL) {
             stack_top = next;
@@ -278,19 +389,120 @@ STATIC mp_obj_t mod_ujson_load(mp_obj_t stream_obj) {
     return stack_top;
 
     fail:
-    mp_raise_ValueError(translate("syntax error in JSON"));
+    ujson_fail();
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_load_obj, mod_ujson_load);
 
 STATIC mp_obj_t mod_ujson_loads(mp_obj_t obj) {
+    // check the type; the str/bytes data is then parsed in place
     size_t len;
-    const char *buf = mp_obj_str_get_data(obj, &len);
-    vstr_t vstr = {len, len, (char*)buf, true};
-    mp_obj_stringio_t sio = {{&mp_type_stringio}, &vstr, 0, MP_OBJ_NULL};
-    return mod_ujson_load(MP_OBJ_FROM_PTR(&sio));
+    mp_obj_str_get_data(obj, &len);
+    return mod_ujson_load(obj);
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_loads_obj, mod_ujson_loads);
 
+#if MICROPY_PY_UJSON_ITERPARSE
+
+// ujson.iterparse returns an iterator of (event, value) pairs, so a large
+// document can be walked without building it in memory.  Unlike load it
+// checks that brackets and braces are paired.
+
+// state of each open container, kept one byte per level in the nest vstr
+#define NEST_ARRAY ('a')
+#define NEST_MAP_KEY ('k')
+#define NEST_MAP_VALUE ('v')
+
+typedef struct _ujson_iterparse_t {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    ujson_stream_t s;
+    vstr_t vstr;
+    vstr_t nest;
+    bool started;
+} ujson_iterparse_t;
+
+STATIC mp_obj_t ujson_iterparse_iternext(mp_obj_t self_in) {
+    ujson_iterparse_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t value = mp_const_none;
+    byte tok = ujson_token(&self->s, &self->vstr, &value);
+    byte *top = self->nest.len > 0 ? (byte*)&self->nest.buf[self->nest.len - 1] : NULL;
+    if (top == NULL && self->started) {
+        // only whitespace may follow the top-level value
+        if (tok != TOK_EOF) {
+            ujson_fail();
+        }
+        return MP_OBJ_STOP_ITERATION;
+    }
+    self->started = true;
+    qstr event;
+    switch (tok) {
+        case TOK_EOF:
+            ujson_fail();
+        case '[':
+        case '{':
+            if (top != NULL) {
+                if (*top == NEST_MAP_KEY) {
+                    ujson_fail();
+                } else if (*top == NEST_MAP_VALUE) {
+                    *top = NEST_MAP_KEY;
+                }
+            }
+            if (tok == '[') {
+                event = MP_QSTR_start_array;
+                vstr_add_byte(&self->nest, NEST_ARRAY);
+            } else {
+                event = MP_QSTR_start_map;
+                vstr_add_byte(&self->nest, NEST_MAP_KEY);
+            }
+            break;
+        case ']':
+            if (top == NULL || *top != NEST_ARRAY) {
+                ujson_fail();
+            }
+            event = MP_QSTR_end_array;
+            self->nest.len -= 1;
+            break;
+        case '}':
+            if (top == NULL || *top != NEST_MAP_KEY) {
+                ujson_fail();
+            }
+            event = MP_QSTR_end_map;
+            self->nest.len -= 1;
+            break;
+        default:
+            event = MP_QSTR_value;
+            if (top != NULL) {
+                if (*top == NEST_MAP_KEY) {
+                    event = MP_QSTR_map_key;
+                    *top = NEST_MAP_VALUE;
+                } else if (*top == NEST_MAP_VALUE) {
+                    *top = NEST_MAP_KEY;
+                }
+            }
+            break;
+    }
+    mp_obj_t items[2] = {MP_OBJ_NEW_QSTR(event), value};
+    return mp_obj_new_tuple(2, items);
+}
+
+STATIC mp_obj_t mod_ujson_iterparse(mp_obj_t obj) {
+    ujson_iterparse_t *self = m_new_obj(ujson_iterparse_t);
+    self->base.type = &mp_type_polymorph_iter;
+    self->iternext = ujson_iterparse_iternext;
+    byte *buf = NULL;
+    if (!MP_OBJ_IS_STR_OR_BYTES(obj)) {
+        buf = m_new(byte, MICROPY_PY_UJSON_READ_BUF_SIZE);
+    }
+    ujson_stream_init(&self->s, obj, buf);
+    vstr_init(&self->vstr, 8);
+    vstr_init(&self->nest, 8);
+    self->started = false;
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_ujson_iterparse_obj, mod_ujson_iterparse);
+
+#endif // MICROPY_PY_UJSON_ITERPARSE
+
 STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
 #if CIRCUITPY
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
@@ -301,6 +513,9 @@ STATIC const mp_rom_map_elem_t mp_module_ujson_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_ujson_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_ujson_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_ujson_loads_obj) },
+    #if MICROPY_PY_UJSON_ITERPARSE
+    { MP_ROM_QSTR(MP_QSTR_iterparse), MP_ROM_PTR(&mod_ujson_iterparse_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_ujson_globals, mp_module_ujson_globals_table);
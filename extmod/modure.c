@@ -36,16 +36,35 @@
 #if MICROPY_PY_URE
 
 #define re1_5_stack_chk() MP_STACK_CHECK()
+#define re1_5_alloc(size) ((void*)m_new(char, size))
+#define re1_5_free(ptr, size) m_del(char, ptr, size)
 
 #include "re1.5/re1.5.h"
 
 #define FLAG_DEBUG 0x1000
+#define FLAG_LINEAR 0x2000
 
 typedef struct _mp_obj_re_t {
     mp_obj_base_t base;
+    #if MICROPY_PY_URE_CACHE_SIZE
+    mp_obj_t pattern;
+    #endif
+    #if MICROPY_PY_URE_PIKEVM
+    bool linear;
+    #endif
     ByteProg re;
 } mp_obj_re_t;
 
+// Run the compiled pattern over subj, with the matcher it was compiled for
+STATIC int re_exec_prog(mp_obj_re_t *self, Subject *subj, const char **caps, int caps_num, bool is_anchored) {
+    #if MICROPY_PY_URE_PIKEVM
+    if (self->linear) {
+        return re1_5_pikevm(&self->re, subj, caps, caps_num, is_anchored);
+    }
+    #endif
+    return re1_5_recursiveloopprog(&self->re, subj, caps, caps_num, is_anchored);
+}
+
 typedef struct _mp_obj_match_t {
     mp_obj_base_t base;
     int num_matches;
@@ -112,7 +131,8 @@ STATIC void match_span_helper(size_t n_args, const mp_obj_t *args, mp_obj_t span
     const char *start = self->caps[no * 2];
     if (start != NULL) {
         // have a match for this group
-        const char *begin = mp_obj_str_get_str(self->str);
+        size_t len;
+        const char *begin = mp_obj_str_get_data(self->str, &len);
         s = start - begin;
         e = self->caps[no * 2 + 1] - begin;
     }
@@ -211,7 +231,7 @@ STATIC mp_obj_t ure_exec(bool is_anchored, uint n_args, const mp_obj_t *args) {
     mp_obj_match_t *match = m_new_obj_var(mp_obj_match_t, char*, caps_num);
     // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
     memset((char*)match->caps, 0, caps_num * sizeof(char*));
-    int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, is_anchored);
+    int res = re_exec_prog(self, &subj, match->caps, caps_num, is_anchored);
     if (res == 0) {
         m_del_var(mp_obj_match_t, char*, caps_num, match);
         return mp_const_none;
@@ -252,7 +272,7 @@ STATIC mp_obj_t re_split(size_t n_args, const mp_obj_t *args) {
     while (true) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char**)caps, 0, caps_num * sizeof(char*));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, caps, caps_num, false);
+        int res = re_exec_prog(self, &subj, caps, caps_num, false);
 
         // if we didn't have a match, or had an empty match, it's time to stop
         if (!res || caps[0] == caps[1]) {
@@ -307,7 +327,7 @@ STATIC mp_obj_t re_sub_helper(mp_obj_t self_in, size_t n_args, const mp_obj_t *a
     for (;;) {
         // cast is a workaround for a bug in msvc: it treats const char** as a const pointer instead of a pointer to pointer to const char
         memset((char*)match->caps, 0, caps_num * sizeof(char*));
-        int res = re1_5_recursiveloopprog(&self->re, &subj, match->caps, caps_num, false);
+        int res = re_exec_prog(self, &subj, match->caps, caps_num, false);
 
         // If we didn't have a match, or had an empty match, it's time to stop
         if (!res || match->caps[0] == match->caps[1]) {
@@ -414,18 +434,56 @@ STATIC const mp_obj_type_t re_type = {
     .locals_dict = (void*)&re_locals_dict,
 };
 
+#if MICROPY_PY_URE_CACHE_SIZE
+// The most recently compiled patterns are kept, most recent first, so that
+// ure.match(pattern, s) and friends in a loop don't recompile each time.
+STATIC mp_obj_t re_cache_lookup(const char *re_str, size_t re_len, int flags) {
+    mp_obj_t *cache = MP_STATE_VM(ure_cache);
+    for (size_t i = 0; i < MICROPY_PY_URE_CACHE_SIZE && cache[i] != MP_OBJ_NULL; i++) {
+        mp_obj_re_t *o = MP_OBJ_TO_PTR(cache[i]);
+        size_t len;
+        const char *str = mp_obj_str_get_data(o->pattern, &len);
+        #if MICROPY_PY_URE_PIKEVM
+        if (o->linear != !!(flags & FLAG_LINEAR)) {
+            continue;
+        }
+        #else
+        (void)flags;
+        #endif
+        if (len == re_len && memcmp(str, re_str, len) == 0) {
+            mp_obj_t hit = cache[i];
+            memmove(cache + 1, cache, i * sizeof(mp_obj_t));
+            cache[0] = hit;
+            return hit;
+        }
+    }
+    return MP_OBJ_NULL;
+}
+#endif
+
 STATIC mp_obj_t mod_re_compile(size_t n_args, const mp_obj_t *args) {
     const char *re_str = mp_obj_str_get_str(args[0]);
+    int flags = 0;
+    if (n_args > 1) {
+        flags = mp_obj_get_int(args[1]);
+    }
+    #if MICROPY_PY_URE_CACHE_SIZE
+    if (!(flags & FLAG_DEBUG)) {
+        mp_obj_t cached = re_cache_lookup(re_str, strlen(re_str), flags);
+        if (cached != MP_OBJ_NULL) {
+            return cached;
+        }
+    }
+    #endif
     int size = re1_5_sizecode(re_str);
     if (size == -1) {
         goto error;
     }
     mp_obj_re_t *o = m_new_obj_var(mp_obj_re_t, char, size);
     o->base.type = &re_type;
-    int flags = 0;
-    if (n_args > 1) {
-        flags = mp_obj_get_int(args[1]);
-    }
+    #if MICROPY_PY_URE_PIKEVM
+    o->linear = (flags & FLAG_LINEAR) != 0;
+    #endif
     int error = re1_5_compilecode(&o->re, re_str);
     if (error != 0) {
 error:
@@ -434,6 +492,14 @@ error:
     if (flags & FLAG_DEBUG) {
         re1_5_dumpcode(&o->re);
     }
+    #if MICROPY_PY_URE_CACHE_SIZE
+    o->pattern = args[0];
+    if (!(flags & FLAG_DEBUG)) {
+        mp_obj_t *cache = MP_STATE_VM(ure_cache);
+        memmove(cache + 1, cache, (MICROPY_PY_URE_CACHE_SIZE - 1) * sizeof(mp_obj_t));
+        cache[0] = MP_OBJ_FROM_PTR(o);
+    }
+    #endif
     return MP_OBJ_FROM_PTR(o);
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mod_re_compile_obj, 1, 2, mod_re_compile);
@@ -478,6 +544,9 @@ STATIC const mp_rom_map_elem_t mp_module_re_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_sub), MP_ROM_PTR(&mod_re_sub_obj) },
     #endif
     { MP_ROM_QSTR(MP_QSTR_DEBUG), MP_ROM_INT(FLAG_DEBUG) },
+    #if MICROPY_PY_URE_PIKEVM
+    { MP_ROM_QSTR(MP_QSTR_LINEAR), MP_ROM_INT(FLAG_LINEAR) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_re_globals, mp_module_re_globals_table);
@@ -494,6 +563,9 @@ const mp_obj_module_t mp_module_ure = {
 #include "re1.5/compilecode.c"
 #include "re1.5/dumpcode.c"
 #include "re1.5/recursiveloop.c"
+#if MICROPY_PY_URE_PIKEVM
+#include "re1.5/pike.c"
+#endif
 #include "re1.5/charclass.c"
 
 #endif //MICROPY_PY_URE
@@ -170,14 +170,16 @@ STATIC mp_obj_ssl_socket_t *socket_new(mp_obj_t sock, struct ssl_args *args) {
 
     if (args->key.u_obj != MP_OBJ_NULL) {
         size_t key_len;
-        const byte *key = (const byte*)mp_obj_str_get_data(args->key.u_obj, &key_len);
+        mp_obj_str_get_data(args->key.u_obj, &key_len);
         // len should include terminating null
+        const byte *key = (const byte*)mp_obj_str_get_str(args->key.u_obj);
         ret = mbedtls_pk_parse_key(&o->pkey, key, key_len + 1, NULL, 0);
         assert(ret == 0);
 
         size_t cert_len;
-        const byte *cert = (const byte*)mp_obj_str_get_data(args->cert.u_obj, &cert_len);
+        mp_obj_str_get_data(args->cert.u_obj, &cert_len);
         // len should include terminating null
+        const byte *cert = (const byte*)mp_obj_str_get_str(args->cert.u_obj);
         ret = mbedtls_x509_crt_parse(&o->cert, cert, cert_len + 1);
         assert(ret == 0);
 
@@ -0,0 +1,147 @@
+// Copyright 2007-2009 Russ Cox.  All Rights Reserved.
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file.
+
+#include "re1.5.h"
+
+// Pike VM over the byte code: all threads advance through the subject in
+// lock step, so matching takes time linear in the subject length and the C
+// stack is only used in proportion to the program size.  Threads are kept
+// in priority order, which gives the same leftmost-first captures as the
+// backtracking matcher.
+
+typedef struct ThreadList ThreadList;
+
+struct ThreadList
+{
+	int n;
+	const char **t;	// per thread: pc, then nsubp capture pointers
+};
+
+static void
+addthread(ByteProg *prog, ThreadList *l, int *marks, int generation, const char *pc, const char *sp, Subject *input, const char **sub, int nsubp)
+{
+	const char *old;
+	const char **t;
+	int off;
+
+	re1_5_stack_chk();
+
+	for(;;) {
+		if(marks[pc - prog->insts] == generation)
+			return;
+		marks[pc - prog->insts] = generation;
+		switch(*pc) {
+		case Jmp:
+			off = (signed char)pc[1];
+			pc = pc + 2 + off;
+			continue;
+		case Split:
+			off = (signed char)pc[1];
+			addthread(prog, l, marks, generation, pc + 2, sp, input, sub, nsubp);
+			pc = pc + 2 + off;
+			continue;
+		case RSplit:
+			off = (signed char)pc[1];
+			addthread(prog, l, marks, generation, pc + 2 + off, sp, input, sub, nsubp);
+			pc = pc + 2;
+			continue;
+		case Save:
+			off = (unsigned char)pc[1];
+			if(off >= nsubp) {
+				pc = pc + 2;
+				continue;
+			}
+			old = sub[off];
+			sub[off] = sp;
+			addthread(prog, l, marks, generation, pc + 2, sp, input, sub, nsubp);
+			sub[off] = old;
+			return;
+		case Bol:
+			if(sp != input->begin)
+				return;
+			pc++;
+			continue;
+		case Eol:
+			if(sp != input->end)
+				return;
+			pc++;
+			continue;
+		}
+		// a consumer or Match: the thread waits here for the next step
+		t = l->t + l->n++ * (nsubp + 1);
+		t[0] = pc;
+		memcpy(t + 1, sub, nsubp * sizeof(*sub));
+		return;
+	}
+}
+
+int
+re1_5_pikevm(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
+{
+	// each pc holds at most one thread per list, so prog->len bounds the lists
+	int stride = nsubp + 1;
+	size_t size = prog->bytelen * sizeof(int) + 2 * prog->len * stride * sizeof(char*);
+	int *marks = re1_5_alloc(size);
+	ThreadList clist, nlist, tmp;
+	const char **t;
+	const char *pc, *sp;
+	int generation, i, matched;
+
+	memset(marks, 0, prog->bytelen * sizeof(int));
+	clist.n = 0;
+	clist.t = (const char**)(marks + prog->bytelen);
+	nlist.n = 0;
+	nlist.t = clist.t + prog->len * stride;
+
+	generation = 1;
+	matched = 0;
+	sp = input->begin;
+	addthread(prog, &clist, marks, generation, HANDLE_ANCHORED(prog->insts, is_anchored), sp, input, subp, nsubp);
+	for(; clist.n > 0; sp++) {
+		generation++;
+		nlist.n = 0;
+		for(i = 0; i < clist.n; i++) {
+			t = clist.t + i * stride;
+			pc = t[0];
+			if(*pc == Match) {
+				// lower priority threads can't improve on this match
+				memcpy(subp, t + 1, nsubp * sizeof(*subp));
+				matched = 1;
+				break;
+			}
+			if(sp >= input->end)
+				continue;
+			switch(*pc) {
+			case Char:
+				if(*sp != pc[1])
+					continue;
+				pc += 2;
+				break;
+			case Any:
+				pc++;
+				break;
+			case Class:
+			case ClassNot:
+				if(!_re1_5_classmatch(pc + 1, sp))
+					continue;
+				pc += (unsigned char)pc[1] * 2 + 2;
+				break;
+			case NamedClass:
+				if(!_re1_5_namedclassmatch(pc + 1, sp))
+					continue;
+				pc += 2;
+				break;
+			default:
+				re1_5_fatal("pikevm");
+			}
+			addthread(prog, &nlist, marks, generation, pc, sp + 1, input, t + 1, nsubp);
+		}
+		tmp = clist;
+		clist = nlist;
+		nlist = tmp;
+	}
+
+	re1_5_free(marks, size);
+	return matched;
+}
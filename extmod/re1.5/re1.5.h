@@ -51,6 +51,10 @@ void re1_5_fatal(char*);
 #ifndef re1_5_stack_chk
 #define re1_5_stack_chk()
 #endif
+#ifndef re1_5_alloc
+#define re1_5_alloc(size) malloc(size)
+#define re1_5_free(ptr, size) free(ptr)
+#endif
 void *mal(int);
 
 struct Prog
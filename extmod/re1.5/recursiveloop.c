@@ -82,5 +82,21 @@ recursiveloop(char *pc, const char *sp, Subject *input, const char **subp, int n
 int
 re1_5_recursiveloopprog(ByteProg *prog, Subject *input, const char **subp, int nsubp, int is_anchored)
 {
+	char *pc = prog->insts + NON_ANCHORED_PREFIX;
+	const char *sp;
+
+	// If the pattern starts with a literal char, a search only needs to try
+	// the positions holding that char, which memchr finds quickly.  pc[0] is
+	// the Save of group 0.
+	if(!is_anchored && pc[2] == Char) {
+		for(sp = input->begin; sp < input->end; sp++) {
+			sp = memchr(sp, pc[3], input->end - sp);
+			if(sp == nil)
+				break;
+			if(recursiveloop(pc, sp, input, subp, nsubp))
+				return 1;
+		}
+		return 0;
+	}
 	return recursiveloop(HANDLE_ANCHORED(prog->insts, is_anchored), input->begin, input, subp, nsubp);
 }
@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "py/builtin.h"
 #include "py/objstr.h"
 #include "py/mperrno.h"
 #include "extmod/vfs.h"
@@ -40,7 +41,7 @@
 
 // For mp_vfs_proxy_call, the maximum number of additional args that can be passed.
 // A fixed maximum size is used to avoid the need for a costly variable array.
-#define PROXY_MAX_ARGS (2)
+#define PROXY_MAX_ARGS (3)
 
 // path is the path to lookup and *path_out holds the path within the VFS
 // object (starts with / if an absolute path).
@@ -152,6 +153,21 @@ mp_import_stat_t mp_vfs_import_stat(const char *path) {
     }
 }
 
+#if MICROPY_MODULE_STAT_CACHE
+// Whether mp_vfs_import_stat(path) may be cached.  Filesystems that can change
+// without going through their VFS object, such as the host's filesystem or one
+// written in Python, are always probed.
+bool mp_vfs_import_stat_cacheable(const char *path) {
+    const char *path_out;
+    mp_vfs_mount_t *vfs = mp_vfs_lookup_path(path, &path_out);
+    if (vfs == MP_VFS_NONE || vfs == MP_VFS_ROOT) {
+        return false;
+    }
+    const mp_vfs_proto_t *proto = (mp_vfs_proto_t*)mp_proto_get(MP_QSTR_protocol_vfs, vfs->obj);
+    return proto != NULL && proto->import_stat_cacheable;
+}
+#endif
+
 mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     enum { ARG_readonly, ARG_mkfs };
     static const mp_arg_t allowed_args[] = {
@@ -213,6 +229,7 @@ mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args
         vfsp = &(*vfsp)->next;
     }
     *vfsp = vfs;
+    mp_import_stat_cache_clear();
 
     return mp_const_none;
 }
@@ -227,7 +244,7 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
         mnt_str = mp_obj_str_get_data(mnt_in, &mnt_len);
     }
     for (mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table); *vfsp != NULL; vfsp = &(*vfsp)->next) {
-        if ((mnt_str != NULL && !memcmp(mnt_str, (*vfsp)->str, mnt_len + 1)) || (*vfsp)->obj == mnt_in) {
+        if ((mnt_str != NULL && mnt_len == (*vfsp)->len && !memcmp(mnt_str, (*vfsp)->str, mnt_len)) || (*vfsp)->obj == mnt_in) {
             vfs = *vfsp;
             *vfsp = (*vfsp)->next;
             break;
@@ -245,14 +262,16 @@ mp_obj_t mp_vfs_umount(mp_obj_t mnt_in) {
 
     // call the underlying object to do any unmounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_umount, 0, NULL);
+    mp_import_stat_cache_clear();
 
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_umount_obj, mp_vfs_umount);
 
-// Note: buffering and encoding args are currently ignored
+// Note: encoding arg is currently ignored, and buffering is only passed on to
+// FAT filesystems, as the size of their write-behind buffer
 mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_file, ARG_mode, ARG_encoding };
+    enum { ARG_file, ARG_mode, ARG_buffering, ARG_encoding };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_rom_obj = MP_ROM_PTR(&mp_const_none_obj)} },
         { MP_QSTR_mode, MP_ARG_OBJ, {.u_rom_obj = MP_ROM_QSTR(MP_QSTR_r)} },
@@ -265,7 +284,16 @@ mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args)
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_vfs_mount_t *vfs = lookup_path(args[ARG_file].u_obj, &args[ARG_file].u_obj);
-    return mp_vfs_proxy_call(vfs, MP_QSTR_open, 2, (mp_obj_t*)&args);
+    size_t n_open_args = 2;
+    #if MICROPY_VFS_FAT && MICROPY_VFS_FAT_WRITEBEHIND
+    // only FAT filesystems take a buffer size, other ones keep open(path, mode)
+    if (args[ARG_buffering].u_int != -1 && vfs != MP_VFS_NONE && vfs != MP_VFS_ROOT
+        && mp_obj_get_type(vfs->obj) == &mp_fat_vfs_type) {
+        args[ARG_buffering].u_obj = MP_OBJ_NEW_SMALL_INT(args[ARG_buffering].u_int);
+        n_open_args = 3;
+    }
+    #endif
+    return mp_vfs_proxy_call(vfs, MP_QSTR_open, n_open_args, (mp_obj_t*)&args);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mp_vfs_open_obj, 0, mp_vfs_open);
 
@@ -287,6 +315,7 @@ mp_obj_t mp_vfs_chdir(mp_obj_t path_in) {
     } else {
         mp_vfs_proxy_call(vfs, MP_QSTR_chdir, 1, &path_out);
     }
+    mp_import_stat_cache_clear();
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(mp_vfs_chdir_obj, mp_vfs_chdir);
@@ -45,11 +45,18 @@
 #define BP_IOCTL_SYNC           (3)
 #define BP_IOCTL_SEC_COUNT      (4)
 #define BP_IOCTL_SEC_SIZE       (5)
+// preferred maximum number of blocks per readblocks/writeblocks call, or None
+// if there is no limit (6 is block erase in other block device protocols)
+#define BP_IOCTL_XFER_SIZE      (7)
 
 // At the moment the VFS protocol just has import_stat, but could be extended to other methods
 typedef struct _mp_vfs_proto_t {
     MP_PROTOCOL_HEAD
     mp_import_stat_t (*import_stat)(void *self, const char *path);
+    // true if the filesystem only changes through methods of the VFS object,
+    // which then call mp_import_stat_cache_clear(), so that import_stat
+    // results may be cached
+    bool import_stat_cacheable;
 } mp_vfs_proto_t;
 
 typedef struct _mp_vfs_mount_t {
@@ -74,6 +81,7 @@ mp_obj_t mp_vfs_ilistdir_it_iternext(mp_obj_t self_in);
 
 mp_vfs_mount_t *mp_vfs_lookup_path(const char *path, const char **path_out);
 mp_import_stat_t mp_vfs_import_stat(const char *path);
+bool mp_vfs_import_stat_cacheable(const char *path);
 mp_obj_t mp_vfs_mount(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
 mp_obj_t mp_vfs_umount(mp_obj_t mnt_in);
 mp_obj_t mp_vfs_open(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args);
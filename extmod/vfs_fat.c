@@ -35,6 +35,7 @@
 #include <string.h>
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "py/builtin.h"
 #include "py/mperrno.h"
 #include "lib/oofatfs/ff.h"
 #include "extmod/vfs_fat.h"
@@ -72,6 +73,7 @@ STATIC mp_obj_t fat_vfs_make_new(const mp_obj_type_t *type, size_t n_args, const
     fs_user_mount_t *vfs = m_new_obj(fs_user_mount_t);
     vfs->base.type = type;
     vfs->flags = FSUSER_FREE_OBJ;
+    vfs->xfer_count = 0;
     vfs->fatfs.drv = vfs;
 
     // load block protocol methods
@@ -125,6 +127,7 @@ STATIC mp_obj_t fat_vfs_mkfs(mp_obj_t bdev_in) {
     if (res != FR_OK) {
         mp_raise_OSError(fresult_to_errno_table[res]);
     }
+    mp_import_stat_cache_clear();
 
     return mp_const_none;
 }
@@ -224,6 +227,7 @@ STATIC mp_obj_t fat_vfs_remove_internal(mp_obj_t vfs_in, mp_obj_t path_in, mp_in
         if (res != FR_OK) {
             mp_raise_OSError(fresult_to_errno_table[res]);
         }
+        mp_import_stat_cache_clear();
         return mp_const_none;
     } else {
         mp_raise_OSError(attr ? MP_ENOTDIR : MP_EISDIR);
@@ -269,6 +273,7 @@ STATIC mp_obj_t fat_vfs_rename(mp_obj_t vfs_in, mp_obj_t path_in, mp_obj_t path_
         res = f_rename(&self->fatfs, old_path, new_path);
     }
     if (res == FR_OK) {
+        mp_import_stat_cache_clear();
         return mp_const_none;
     } else {
         mp_raise_OSError(fresult_to_errno_table[res]);
@@ -283,6 +288,7 @@ STATIC mp_obj_t fat_vfs_mkdir(mp_obj_t vfs_in, mp_obj_t path_o) {
     const char *path = mp_obj_str_get_str(path_o);
     FRESULT res = f_mkdir(&self->fatfs, path);
     if (res == FR_OK) {
+        mp_import_stat_cache_clear();
         return mp_const_none;
     } else {
         mp_raise_OSError(fresult_to_errno_table[res]);
@@ -301,6 +307,7 @@ STATIC mp_obj_t fat_vfs_chdir(mp_obj_t vfs_in, mp_obj_t path_in) {
     if (res != FR_OK) {
         mp_raise_OSError(fresult_to_errno_table[res]);
     }
+    mp_import_stat_cache_clear();
 
     return mp_const_none;
 }
@@ -497,6 +504,7 @@ STATIC MP_DEFINE_CONST_DICT(fat_vfs_locals_dict, fat_vfs_locals_dict_table);
 STATIC const mp_vfs_proto_t fat_vfs_proto = {
     MP_PROTO_IMPLEMENT(MP_QSTR_protocol_vfs)
     .import_stat = fat_vfs_import_stat,
+    .import_stat_cacheable = true,
 };
 
 const mp_obj_type_t mp_fat_vfs_type = {
@@ -44,6 +44,8 @@
 typedef struct _fs_user_mount_t {
     mp_obj_base_t base;
     uint16_t flags;
+    // most blocks to pass in one readblocks/writeblocks call, 0 for no limit
+    uint16_t xfer_count;
     mp_obj_t readblocks[4];
     mp_obj_t writeblocks[4];
     // new protocol uses just ioctl, old uses sync (optional) and count
@@ -60,6 +62,21 @@ typedef struct _fs_user_mount_t {
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    // set once fast seek was turned off, or couldn't be turned on, so that
+    // seeking doesn't try to turn it on again
+    bool fastseek_off;
+    #if MICROPY_VFS_FAT_WRITEBEHIND
+    // write-behind buffer, NULL if writes go straight to FatFs
+    byte *wbuf;
+    mp_uint_t wbuf_size;
+    mp_uint_t wbuf_len;
+    // autosync policy: commit the file once this many bytes were written, or
+    // this many ms passed, since the last commit (0 to not check)
+    mp_uint_t sync_bytes;
+    mp_uint_t sync_ms;
+    mp_uint_t unsynced;
+    mp_uint_t last_sync;
+    #endif
 } pyb_file_obj_t;
 
 extern const byte fresult_to_errno_table[20];
@@ -68,8 +85,9 @@ extern const mp_obj_type_t mp_type_vfs_fat_fileio;
 extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
 mp_import_stat_t fat_vfs_import_stat(void *vfs, const char *path);
+void vfs_fat_file_fastseek_auto(pyb_file_obj_t *self);
 
-MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
+MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_open_obj);
 
 mp_obj_t fat_vfs_ilistdir2(struct _fs_user_mount_t *vfs, const char *path, bool is_str_type);
 
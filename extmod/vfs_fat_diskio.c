@@ -53,22 +53,16 @@ STATIC fs_user_mount_t *disk_get_device(void *bdev) {
     return (fs_user_mount_t*)bdev;
 }
 
-/*-----------------------------------------------------------------------*/
-/* Read Sector(s)                                                        */
-/*-----------------------------------------------------------------------*/
-
-DRESULT disk_read (
-    bdev_t pdrv,      /* Physical drive nmuber (0..) */
-    BYTE *buff,        /* Data buffer to store read data */
-    DWORD sector,    /* Sector address (LBA) */
-    UINT count        /* Number of sectors to read (1..128) */
-)
-{
-    fs_user_mount_t *vfs = disk_get_device(pdrv);
-    if (vfs == NULL) {
-        return RES_PARERR;
+// Split a transfer into calls of at most the block device's preferred
+// number of blocks, so that it can take whole runs of contiguous sectors.
+STATIC UINT disk_xfer_count(fs_user_mount_t *vfs, UINT count) {
+    if (vfs->xfer_count != 0 && count > vfs->xfer_count) {
+        return vfs->xfer_count;
     }
+    return count;
+}
 
+STATIC DRESULT disk_read_blocks(fs_user_mount_t *vfs, BYTE *buff, DWORD sector, UINT count) {
     if (vfs->flags & FSUSER_NATIVE) {
         mp_uint_t (*f)(uint8_t*, uint32_t, uint32_t) = (void*)(uintptr_t)vfs->readblocks[2];
         if (f(buff, sector, count) != 0) {
@@ -90,6 +84,60 @@ DRESULT disk_read (
             return RES_ERROR;
         }
     }
+    return RES_OK;
+}
+
+STATIC DRESULT disk_write_blocks(fs_user_mount_t *vfs, const BYTE *buff, DWORD sector, UINT count) {
+    if (vfs->flags & FSUSER_NATIVE) {
+        mp_uint_t (*f)(const uint8_t*, uint32_t, uint32_t) = (void*)(uintptr_t)vfs->writeblocks[2];
+        if (f(buff, sector, count) != 0) {
+            return RES_ERROR;
+        }
+    } else {
+        mp_obj_array_t ar = {{&mp_type_bytearray}, BYTEARRAY_TYPECODE, 0, count * SECSIZE(&vfs->fatfs), (void*)buff};
+        vfs->writeblocks[2] = MP_OBJ_NEW_SMALL_INT(sector);
+        vfs->writeblocks[3] = MP_OBJ_FROM_PTR(&ar);
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            mp_obj_t ret = mp_call_method_n_kw(2, 0, vfs->writeblocks);
+            nlr_pop();
+            if (ret != mp_const_none && MP_OBJ_SMALL_INT_VALUE(ret) != 0) {
+                return RES_ERROR;
+            }
+        } else {
+            // Exception thrown by writeblocks or something it calls.
+            return RES_ERROR;
+        }
+    }
+    return RES_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+/* Read Sector(s)                                                        */
+/*-----------------------------------------------------------------------*/
+
+DRESULT disk_read (
+    bdev_t pdrv,      /* Physical drive nmuber (0..) */
+    BYTE *buff,        /* Data buffer to store read data */
+    DWORD sector,    /* Sector address (LBA) */
+    UINT count        /* Number of sectors to read */
+)
+{
+    fs_user_mount_t *vfs = disk_get_device(pdrv);
+    if (vfs == NULL) {
+        return RES_PARERR;
+    }
+
+    while (count > 0) {
+        UINT n = disk_xfer_count(vfs, count);
+        DRESULT res = disk_read_blocks(vfs, buff, sector, n);
+        if (res != RES_OK) {
+            return res;
+        }
+        buff += n * SECSIZE(&vfs->fatfs);
+        sector += n;
+        count -= n;
+    }
 
     return RES_OK;
 }
@@ -102,7 +150,7 @@ DRESULT disk_write (
     bdev_t pdrv,          /* Physical drive nmuber (0..) */
     const BYTE *buff,    /* Data to be written */
     DWORD sector,        /* Sector address (LBA) */
-    UINT count            /* Number of sectors to write (1..128) */
+    UINT count            /* Number of sectors to write */
 )
 {
     fs_user_mount_t *vfs = disk_get_device(pdrv);
@@ -115,26 +163,15 @@ DRESULT disk_write (
         return RES_WRPRT;
     }
 
-    if (vfs->flags & FSUSER_NATIVE) {
-        mp_uint_t (*f)(const uint8_t*, uint32_t, uint32_t) = (void*)(uintptr_t)vfs->writeblocks[2];
-        if (f(buff, sector, count) != 0) {
-            return RES_ERROR;
-        }
-    } else {
-        mp_obj_array_t ar = {{&mp_type_bytearray}, BYTEARRAY_TYPECODE, 0, count * SECSIZE(&vfs->fatfs), (void*)buff};
-        vfs->writeblocks[2] = MP_OBJ_NEW_SMALL_INT(sector);
-        vfs->writeblocks[3] = MP_OBJ_FROM_PTR(&ar);
-        nlr_buf_t nlr;
-        if (nlr_push(&nlr) == 0) {
-            mp_obj_t ret = mp_call_method_n_kw(2, 0, vfs->writeblocks);
-            nlr_pop();
-            if (ret != mp_const_none && MP_OBJ_SMALL_INT_VALUE(ret) != 0) {
-                return RES_ERROR;
-            }
-        } else {
-            // Exception thrown by writeblocks or something it calls.
-            return RES_ERROR;
+    while (count > 0) {
+        UINT n = disk_xfer_count(vfs, count);
+        DRESULT res = disk_write_blocks(vfs, buff, sector, n);
+        if (res != RES_OK) {
+            return res;
         }
+        buff += n * SECSIZE(&vfs->fatfs);
+        sector += n;
+        count -= n;
     }
 
     return RES_OK;
@@ -172,6 +209,14 @@ DRESULT disk_ioctl (
             vfs->u.ioctl[3] = MP_OBJ_NEW_SMALL_INT(0); // unused
             ret = mp_call_method_n_kw(2, 0, vfs->u.ioctl);
         }
+        if (cmd == IOCTL_INIT) {
+            // ask for the preferred number of blocks per transfer, if any
+            vfs->u.ioctl[2] = MP_OBJ_NEW_SMALL_INT(BP_IOCTL_XFER_SIZE);
+            vfs->u.ioctl[3] = MP_OBJ_NEW_SMALL_INT(0); // unused
+            mp_obj_t xfer = mp_call_method_n_kw(2, 0, vfs->u.ioctl);
+            mp_int_t n = xfer == mp_const_none ? 0 : mp_obj_get_int(xfer);
+            vfs->xfer_count = (n > 0 && n <= 0xffff) ? n : 0;
+        }
     } else {
         // old protocol with sync and count
         switch (cmd) {
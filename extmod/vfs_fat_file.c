@@ -31,7 +31,9 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "py/builtin.h"
 #include "py/stream.h"
+#include "py/mphal.h"
 #include "py/mperrno.h"
 #include "lib/oofatfs/ff.h"
 #include "extmod/vfs_fat.h"
@@ -61,13 +63,140 @@ const byte fresult_to_errno_table[20] = {
     [FR_INVALID_PARAMETER] = MP_EINVAL,
 };
 
+// Fast seek: a cluster link map table lets f_lseek (and f_read) find the
+// cluster for any offset without following the FAT chain from the start of
+// the file.  The table is built on the first seek in a file that's open
+// read-only and spans more than FASTSEEK_MIN_CLUSTERS clusters (or when a
+// native random-access reader asks), or on fastseek(True).  FatFs can't grow
+// a file while the table is in use, so it is dropped before a write or seek
+// past the end of a file open for writing.
+#define FASTSEEK_MIN_CLUSTERS (4)
+// table length tried first; this covers a file in up to 6 fragments
+#define FASTSEEK_FIRST_TABLE_LEN (16)
+
+#if _MAX_SS == _MIN_SS
+#define FAT_SECTOR_SIZE(fs) (_MAX_SS)
+#else
+#define FAT_SECTOR_SIZE(fs) ((fs)->ssize)
+#endif
+
+STATIC void file_fastseek_disable(pyb_file_obj_t *self) {
+    if (self->fp.cltbl != NULL) {
+        m_del(DWORD, self->fp.cltbl, self->fp.cltbl[0]);
+        self->fp.cltbl = NULL;
+    }
+}
+
+STATIC FRESULT file_fastseek_enable(pyb_file_obj_t *self) {
+    DWORD len = FASTSEEK_FIRST_TABLE_LEN;
+    while (self->fp.cltbl == NULL) {
+        DWORD *tbl = m_new_maybe(DWORD, len);
+        if (tbl == NULL) {
+            return FR_NOT_ENOUGH_CORE;
+        }
+        tbl[0] = len;
+        self->fp.cltbl = tbl;
+        FRESULT res = f_lseek(&self->fp, CREATE_LINKMAP);
+        if (res == FR_OK) {
+            // FatFs stored the length used there, but only reads the rest
+            // of the table from now on, so keep the allocated length
+            tbl[0] = len;
+        } else {
+            // on FR_NOT_ENOUGH_CORE the first entry holds the length needed
+            DWORD needed = tbl[0];
+            self->fp.cltbl = NULL;
+            m_del(DWORD, tbl, len);
+            if (res != FR_NOT_ENOUGH_CORE) {
+                return res;
+            }
+            len = needed;
+        }
+    }
+    return FR_OK;
+}
+
+void vfs_fat_file_fastseek_auto(pyb_file_obj_t *self) {
+    FATFS *fs = self->fp.obj.fs;
+    if (fs != NULL && self->fp.cltbl == NULL && !self->fastseek_off && !(self->fp.flag & FA_WRITE)
+        && f_size(&self->fp) > (FSIZE_t)FASTSEEK_MIN_CLUSTERS * fs->csize * FAT_SECTOR_SIZE(fs)) {
+        if (file_fastseek_enable(self) != FR_OK) {
+            self->fastseek_off = true;
+        }
+    }
+}
+
 STATIC void file_obj_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
     (void)kind;
     mp_printf(print, "<io.%s %p>", mp_obj_get_type_str(self_in), MP_OBJ_TO_PTR(self_in));
 }
 
+// Hand data to FatFs, dropping the fast seek table first if the file grows.
+// Returns 0 or an errno.
+STATIC int file_write_fatfs(pyb_file_obj_t *self, const void *buf, mp_uint_t size) {
+    if (self->fp.cltbl != NULL && f_tell(&self->fp) + size > f_size(&self->fp)) {
+        file_fastseek_disable(self);
+    }
+    UINT sz_out;
+    FRESULT res = f_write(&self->fp, buf, size, &sz_out);
+    if (res != FR_OK) {
+        return fresult_to_errno_table[res];
+    }
+    if (sz_out != size) {
+        // The FatFS documentation says that this means disk full.
+        return MP_ENOSPC;
+    }
+    return 0;
+}
+
+#if MICROPY_VFS_FAT_WRITEBEHIND
+// Write-behind: writes smaller than the buffer collect there and reach FatFs
+// a buffer at a time, so appending short records doesn't interleave data,
+// FAT and directory sector writes (each of which can cost a flash erase).
+// Anything that needs the file position or contents from FatFs drains the
+// buffer first.
+
+STATIC int file_drain(pyb_file_obj_t *self) {
+    mp_uint_t len = self->wbuf_len;
+    if (len == 0) {
+        return 0;
+    }
+    self->wbuf_len = 0;
+    return file_write_fatfs(self, self->wbuf, len);
+}
+
+STATIC void file_wbuf_free(pyb_file_obj_t *self) {
+    if (self->wbuf != NULL) {
+        m_del(byte, self->wbuf, self->wbuf_size);
+        self->wbuf = NULL;
+        self->wbuf_size = 0;
+        self->wbuf_len = 0;
+    }
+}
+#else
+#define file_drain(self) (0)
+#endif
+
+// Write out buffered data and commit the FAT and directory entry.
+STATIC int file_sync(pyb_file_obj_t *self) {
+    int err = file_drain(self);
+    if (err != 0) {
+        return err;
+    }
+    FRESULT res = f_sync(&self->fp);
+    #if MICROPY_VFS_FAT_WRITEBEHIND
+    self->unsynced = 0;
+    self->last_sync = mp_hal_ticks_ms();
+    #endif
+    return fresult_to_errno_table[res];
+}
+
 STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    int err = file_drain(self);
+    if (err != 0) {
+        *errcode = err;
+        return MP_STREAM_ERROR;
+    }
     UINT sz_out;
     FRESULT res = f_read(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -79,18 +208,43 @@ STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
 
 STATIC mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    UINT sz_out;
-    FRESULT res = f_write(&self->fp, buf, size, &sz_out);
-    if (res != FR_OK) {
-        *errcode = fresult_to_errno_table[res];
-        return MP_STREAM_ERROR;
+    int err;
+    #if MICROPY_VFS_FAT_WRITEBEHIND
+    if (self->wbuf != NULL && size < self->wbuf_size) {
+        // top the buffer up, and if that fills it write it out and keep the rest
+        mp_uint_t n = MIN(size, self->wbuf_size - self->wbuf_len);
+        memcpy(self->wbuf + self->wbuf_len, buf, n);
+        self->wbuf_len += n;
+        err = 0;
+        if (self->wbuf_len == self->wbuf_size) {
+            err = file_drain(self);
+            if (err == 0) {
+                memcpy(self->wbuf, (const byte*)buf + n, size - n);
+                self->wbuf_len = size - n;
+            }
+        }
+    } else {
+        // too big to buffer, so it goes straight through after what's buffered
+        err = file_drain(self);
+        if (err == 0) {
+            err = file_write_fatfs(self, buf, size);
+        }
     }
-    if (sz_out != size) {
-        // The FatFS documentation says that this means disk full.
-        *errcode = MP_ENOSPC;
+    if (err == 0 && (self->sync_bytes != 0 || self->sync_ms != 0)) {
+        self->unsynced += size;
+        if ((self->sync_bytes != 0 && self->unsynced >= self->sync_bytes)
+            || (self->sync_ms != 0 && mp_hal_ticks_ms() - self->last_sync >= self->sync_ms)) {
+            err = file_sync(self);
+        }
+    }
+    #else
+    err = file_write_fatfs(self, buf, size);
+    #endif
+    if (err != 0) {
+        *errcode = err;
         return MP_STREAM_ERROR;
     }
-    return sz_out;
+    return size;
 }
 
 
@@ -105,28 +259,46 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
 
     if (request == MP_STREAM_SEEK) {
         struct mp_stream_seek_t *s = (struct mp_stream_seek_t*)(uintptr_t)arg;
+        #if MICROPY_VFS_FAT_WRITEBEHIND
+        if (s->whence == 1 && s->offset == 0) {
+            // tell() doesn't need to drain the write buffer
+            s->offset = f_tell(&self->fp) + self->wbuf_len;
+            return 0;
+        }
+        #endif
+        int err = file_drain(self);
+        if (err != 0) {
+            *errcode = err;
+            return MP_STREAM_ERROR;
+        }
+        FSIZE_t ofs = s->offset;
 
         switch (s->whence) {
-            case 0: // SEEK_SET
-                f_lseek(&self->fp, s->offset);
-                break;
-
             case 1: // SEEK_CUR
-                f_lseek(&self->fp, f_tell(&self->fp) + s->offset);
+                ofs += f_tell(&self->fp);
                 break;
 
             case 2: // SEEK_END
-                f_lseek(&self->fp, f_size(&self->fp) + s->offset);
+                ofs += f_size(&self->fp);
                 break;
         }
 
+        if (ofs > f_size(&self->fp) && (self->fp.flag & FA_WRITE)) {
+            // the fast seek path would clip this rather than extend the file;
+            // a file that isn't writable is clipped by both paths
+            file_fastseek_disable(self);
+        } else {
+            vfs_fat_file_fastseek_auto(self);
+        }
+        f_lseek(&self->fp, ofs);
+
         s->offset = f_tell(&self->fp);
         return 0;
 
     } else if (request == MP_STREAM_FLUSH) {
-        FRESULT res = f_sync(&self->fp);
-        if (res != FR_OK) {
-            *errcode = fresult_to_errno_table[res];
+        int err = file_sync(self);
+        if (err != 0) {
+            *errcode = err;
             return MP_STREAM_ERROR;
         }
         return 0;
@@ -134,9 +306,17 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
+            int err = file_drain(self);
+            #if MICROPY_VFS_FAT_WRITEBEHIND
+            file_wbuf_free(self);
+            #endif
+            file_fastseek_disable(self);
             FRESULT res = f_close(&self->fp);
-            if (res != FR_OK) {
-                *errcode = fresult_to_errno_table[res];
+            if (err == 0) {
+                err = fresult_to_errno_table[res];
+            }
+            if (err != 0) {
+                *errcode = err;
                 return MP_STREAM_ERROR;
             }
         }
@@ -153,6 +333,7 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
 STATIC const mp_arg_t file_open_args[] = {
     { MP_QSTR_file, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_rom_obj = MP_ROM_PTR(&mp_const_none_obj)} },
     { MP_QSTR_mode, MP_ARG_OBJ, {.u_obj = MP_OBJ_NEW_QSTR(MP_QSTR_r)} },
+    { MP_QSTR_buffering, MP_ARG_INT, {.u_int = -1} },
     { MP_QSTR_encoding, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_rom_obj = MP_ROM_PTR(&mp_const_none_obj)} },
 };
 #define FILE_OPEN_NUM_ARGS MP_ARRAY_SIZE(file_open_args)
@@ -202,23 +383,28 @@ STATIC mp_obj_t file_open(fs_user_mount_t *vfs, const mp_obj_type_t *type, mp_ar
         m_del_obj(pyb_file_obj_t, o);
         mp_raise_OSError_errno_str(fresult_to_errno_table[res], args[0].u_obj);
     }
-    // If we're reading, turn on fast seek.
-    if (mode == FA_READ) {
-        // one call to determine how much space we need.
-        DWORD temp_table[2];
-        temp_table[0] = 2;
-        o->fp.cltbl = temp_table;
-        f_lseek(&o->fp, CREATE_LINKMAP);
-        DWORD size = (temp_table[0] + 1) * 2;
-        o->fp.cltbl = m_malloc_maybe(size * sizeof(DWORD), false);
-        if (o->fp.cltbl != NULL) {
-            o->fp.cltbl[0] = size;
-            res = f_lseek(&o->fp, CREATE_LINKMAP);
-            if (res != FR_OK) {
-                o->fp.cltbl = NULL;
-            }
+    if ((mode & FA_WRITE) != 0) {
+        mp_import_stat_cache_file_opened(fname);
+    }
+    o->fastseek_off = false;
+    #if MICROPY_VFS_FAT_WRITEBEHIND
+    // a buffer size of 0 or 1 (line buffering, for text) means unbuffered,
+    // and so does running short of memory for the buffer
+    o->wbuf = NULL;
+    o->wbuf_size = 0;
+    o->wbuf_len = 0;
+    o->sync_bytes = 0;
+    o->sync_ms = 0;
+    o->unsynced = 0;
+    o->last_sync = 0;
+    mp_int_t buffering = args[2].u_int;
+    if ((mode & FA_WRITE) != 0 && buffering > 1) {
+        o->wbuf = m_new_maybe(byte, buffering);
+        if (o->wbuf != NULL) {
+            o->wbuf_size = buffering;
         }
     }
+    #endif
 
     // for 'a' mode, we must begin at the end of the file
     if ((mode & FA_OPEN_ALWAYS) != 0) {
@@ -234,6 +420,60 @@ STATIC mp_obj_t file_obj_make_new(const mp_obj_type_t *type, size_t n_args, cons
     return file_open(NULL, type, arg_vals);
 }
 
+// fastseek([enable]): with no argument return whether fast seek is on, else
+// turn it on or off.  Turning it on raises OSError(ENOMEM) if the table
+// can't be allocated.
+STATIC mp_obj_t file_obj_fastseek(size_t n_args, const mp_obj_t *args) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (self->fp.obj.fs == NULL) {
+        mp_raise_ValueError(translate("I/O operation on closed file"));
+    }
+    if (n_args == 1) {
+        return mp_obj_new_bool(self->fp.cltbl != NULL);
+    }
+    if (mp_obj_is_true(args[1])) {
+        FRESULT res = file_fastseek_enable(self);
+        if (res != FR_OK) {
+            mp_raise_OSError(fresult_to_errno_table[res]);
+        }
+        self->fastseek_off = false;
+    } else {
+        file_fastseek_disable(self);
+        self->fastseek_off = true;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(file_obj_fastseek_obj, 1, 2, file_obj_fastseek);
+
+#if MICROPY_VFS_FAT_WRITEBEHIND
+// autosync(ms=0, nbytes=0): commit the file (as flush() does) during a write
+// once ms milliseconds or nbytes bytes have gone by since the last commit.
+// 0 turns a check off; with both off the file is only committed by flush()
+// and close().
+STATIC mp_obj_t file_obj_autosync(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_ms, ARG_nbytes };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_ms, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_nbytes, MP_ARG_INT, {.u_int = 0} },
+    };
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    if (self->fp.obj.fs == NULL) {
+        mp_raise_ValueError(translate("I/O operation on closed file"));
+    }
+    if (args[ARG_ms].u_int < 0 || args[ARG_nbytes].u_int < 0) {
+        mp_raise_ValueError(NULL);
+    }
+    self->sync_ms = args[ARG_ms].u_int;
+    self->sync_bytes = args[ARG_nbytes].u_int;
+    self->unsynced = 0;
+    self->last_sync = mp_hal_ticks_ms();
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(file_obj_autosync_obj, 1, file_obj_autosync);
+#endif
+
 // TODO gc hook to close the file if not already closed
 
 STATIC const mp_rom_map_elem_t rawfile_locals_dict_table[] = {
@@ -246,6 +486,10 @@ STATIC const mp_rom_map_elem_t rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
     { MP_ROM_QSTR(MP_QSTR_tell), MP_ROM_PTR(&mp_stream_tell_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fastseek), MP_ROM_PTR(&file_obj_fastseek_obj) },
+    #if MICROPY_VFS_FAT_WRITEBEHIND
+    { MP_ROM_QSTR(MP_QSTR_autosync), MP_ROM_PTR(&file_obj_autosync_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&mp_identity_obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&file_obj___exit___obj) },
@@ -293,15 +537,15 @@ const mp_obj_type_t mp_type_vfs_fat_textio = {
 };
 
 // Factory function for I/O stream classes
-STATIC mp_obj_t fatfs_builtin_open_self(mp_obj_t self_in, mp_obj_t path, mp_obj_t mode) {
-    // TODO: analyze buffering args and instantiate appropriate type
-    fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
+STATIC mp_obj_t fatfs_builtin_open_self(size_t n_args, const mp_obj_t *args) {
+    fs_user_mount_t *self = MP_OBJ_TO_PTR(args[0]);
     mp_arg_val_t arg_vals[FILE_OPEN_NUM_ARGS];
-    arg_vals[0].u_obj = path;
-    arg_vals[1].u_obj = mode;
-    arg_vals[2].u_obj = mp_const_none;
+    arg_vals[0].u_obj = args[1];
+    arg_vals[1].u_obj = args[2];
+    arg_vals[2].u_int = n_args > 3 ? mp_obj_get_int(args[3]) : -1;
+    arg_vals[3].u_obj = mp_const_none;
     return file_open(self, &mp_type_vfs_fat_textio, arg_vals);
 }
-MP_DEFINE_CONST_FUN_OBJ_3(fat_vfs_open_obj, fatfs_builtin_open_self);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_open_obj, 3, 4, fatfs_builtin_open_self);
 
 #endif // MICROPY_VFS && MICROPY_VFS_FAT
@@ -53,6 +53,18 @@ STATIC const char *vfs_posix_get_path_str(mp_obj_vfs_posix_t *self, mp_obj_t pat
     }
 }
 
+// Get the host's name for a path within the given VfsPosix object.  The result
+// is only valid until the next call that uses the object.
+const char *mp_vfs_posix_get_host_path(mp_obj_t self_in, const char *path) {
+    mp_obj_vfs_posix_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->root_len == 0) {
+        return path;
+    }
+    self->root.len = self->root_len;
+    vstr_add_str(&self->root, path);
+    return vstr_null_terminated_str(&self->root);
+}
+
 STATIC mp_obj_t vfs_posix_get_path_obj(mp_obj_vfs_posix_t *self, mp_obj_t path) {
     if (self->root_len == 0) {
         return path;
@@ -73,12 +85,7 @@ STATIC mp_obj_t vfs_posix_fun1_helper(mp_obj_t self_in, mp_obj_t path_in, int (*
 }
 
 STATIC mp_import_stat_t mp_vfs_posix_import_stat(void *self_in, const char *path) {
-    mp_obj_vfs_posix_t *self = self_in;
-    if (self->root_len != 0) {
-        self->root.len = self->root_len;
-        vstr_add_str(&self->root, path);
-        path = vstr_null_terminated_str(&self->root);
-    }
+    path = mp_vfs_posix_get_host_path(MP_OBJ_FROM_PTR(self_in), path);
     struct stat st;
     if (stat(path, &st) == 0) {
         if (S_ISDIR(st.st_mode)) {
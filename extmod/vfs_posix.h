@@ -35,5 +35,6 @@ extern const mp_obj_type_t mp_type_vfs_posix_fileio;
 extern const mp_obj_type_t mp_type_vfs_posix_textio;
 
 mp_obj_t mp_vfs_posix_file_open(const mp_obj_type_t *type, mp_obj_t file_in, mp_obj_t mode_in);
+const char *mp_vfs_posix_get_host_path(mp_obj_t self_in, const char *path);
 
 #endif // MICROPY_INCLUDED_EXTMOD_VFS_POSIX_H
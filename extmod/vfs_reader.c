@@ -36,19 +36,20 @@
 
 typedef struct _mp_reader_vfs_t {
     mp_obj_t file;
+    uint16_t size;
     uint16_t len;
     uint16_t pos;
-    byte buf[24];
+    byte buf[];
 } mp_reader_vfs_t;
 
 STATIC mp_uint_t mp_reader_vfs_readbyte(void *data) {
     mp_reader_vfs_t *reader = (mp_reader_vfs_t*)data;
     if (reader->pos >= reader->len) {
-        if (reader->len < sizeof(reader->buf)) {
+        if (reader->len < reader->size) {
             return MP_READER_EOF;
         } else {
             int errcode;
-            reader->len = mp_stream_rw(reader->file, reader->buf, sizeof(reader->buf),
+            reader->len = mp_stream_rw(reader->file, reader->buf, reader->size,
                 &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
             if (errcode != 0) {
                 // TODO handle errors properly
@@ -63,24 +64,59 @@ STATIC mp_uint_t mp_reader_vfs_readbyte(void *data) {
     return reader->buf[reader->pos++];
 }
 
+#if MICROPY_LEXER_FAST_SCAN
+STATIC size_t mp_reader_vfs_readblock(void *data, const byte **buf) {
+    mp_reader_vfs_t *reader = (mp_reader_vfs_t*)data;
+    if (reader->pos >= reader->len) {
+        if (reader->len < reader->size) {
+            return 0;
+        }
+        int errcode;
+        reader->len = mp_stream_rw(reader->file, reader->buf, reader->size,
+            &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
+        if (errcode != 0 || reader->len == 0) {
+            // TODO handle errors properly
+            reader->len = 0;
+            return 0;
+        }
+        reader->pos = 0;
+    }
+    size_t len = reader->len - reader->pos;
+    *buf = reader->buf + reader->pos;
+    reader->pos = reader->len;
+    return len;
+}
+#endif
+
 STATIC void mp_reader_vfs_close(void *data) {
     mp_reader_vfs_t *reader = (mp_reader_vfs_t*)data;
     mp_stream_close(reader->file);
-    m_del_obj(mp_reader_vfs_t, reader);
+    m_del_var(mp_reader_vfs_t, byte, reader->size, reader);
 }
 
 void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
-    mp_reader_vfs_t *rf = m_new_obj(mp_reader_vfs_t);
+    // A big buffer means few calls down to the filesystem, which each have a
+    // fixed cost, but the reader can work with a small one if it has to.
+    size_t size = MICROPY_READER_VFS_BUF_SIZE;
+    mp_reader_vfs_t *rf = m_new_obj_var_maybe(mp_reader_vfs_t, byte, size);
+    if (rf == NULL) {
+        size = MICROPY_READER_VFS_BUF_SIZE_MIN;
+        rf = m_new_obj_var(mp_reader_vfs_t, byte, size);
+    }
+    rf->size = size;
     mp_obj_t arg = mp_obj_new_str(filename, strlen(filename));
     rf->file = mp_vfs_open(1, &arg, (mp_map_t*)&mp_const_empty_map);
     int errcode;
-    rf->len = mp_stream_rw(rf->file, rf->buf, sizeof(rf->buf), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
+    rf->len = mp_stream_rw(rf->file, rf->buf, size, &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
     if (errcode != 0) {
         mp_raise_OSError(errcode);
     }
     rf->pos = 0;
     reader->data = rf;
     reader->readbyte = mp_reader_vfs_readbyte;
+    #if MICROPY_LEXER_FAST_SCAN
+    reader->readblock = mp_reader_vfs_readblock;
+    #endif
     reader->close = mp_reader_vfs_close;
 }
 
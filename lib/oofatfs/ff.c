@@ -3331,6 +3331,50 @@ FRESULT f_open (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Clip a direct transfer at the end of a contiguous cluster run         */
+/*-----------------------------------------------------------------------*/
+
+static
+UINT clip_xfer (    /* Number of sectors that can be transferred in one go */
+    FIL* fp,        /* Pointer to the file object */
+    UINT csect,     /* Sector offset in the current cluster */
+    UINT cc,        /* Number of sectors wanted */
+    int stretch     /* 1:Allocate clusters at the end of the chain (write) */
+)
+{
+    FATFS *fs = fp->obj.fs;
+    DWORD nclst;
+    UINT n;
+
+
+    if (csect + cc <= fs->csize) return cc;
+    n = fs->csize - csect;                  /* Sectors up to the cluster boundary */
+    while (n + fs->csize <= cc) {           /* Take in following clusters while they are contiguous */
+#if _USE_FASTSEEK
+        if (fp->cltbl) {
+            if (stretch) break;
+            nclst = clmt_clust(fp, fp->fptr + (FSIZE_t)n * SS(fs));
+        } else
+#endif
+#if !_FS_READONLY
+        if (stretch) {
+            nclst = create_chain(&fp->obj, fp->clust);
+        } else
+#endif
+        {
+            nclst = get_fat(&fp->obj, fp->clust);
+        }
+        if (nclst != fp->clust + 1) break;  /* Fragmented, end of chain or error: left to the caller's next round */
+        fp->clust = nclst;
+        n += fs->csize;
+    }
+    return n;
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Read File                                                             */
 /*-----------------------------------------------------------------------*/
@@ -3383,9 +3427,7 @@ FRESULT f_read (
             sect += csect;
             cc = btr / SS(fs);                  /* When remaining bytes >= sector size, */
             if (cc) {/* Read maximum contiguous sectors directly */
-                if (csect + cc > fs->csize) {   /* Clip at cluster boundary */
-                    cc = fs->csize - csect;
-                }
+                cc = clip_xfer(fp, csect, cc, 0);   /* Clip at the end of the contiguous clusters */
                 if (disk_read(fs->drv, rbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if !_FS_READONLY && _FS_MINIMIZE <= 2          /* Replace one of the read sectors with cached data if it contains a dirty sector */
 #if _FS_TINY
@@ -3498,9 +3540,7 @@ FRESULT f_write (
             sect += csect;
             cc = btw / SS(fs);              /* When remaining bytes >= sector size, */
             if (cc) {                       /* Write maximum contiguous sectors directly */
-                if (csect + cc > fs->csize) {   /* Clip at cluster boundary */
-                    cc = fs->csize - csect;
-                }
+                cc = clip_xfer(fp, csect, cc, 1);   /* Clip at the end of the contiguous clusters */
                 if (disk_write(fs->drv, wbuff, sect, cc) != RES_OK) ABORT(fs, FR_DISK_ERR);
 #if _FS_MINIMIZE <= 2
 #if _FS_TINY
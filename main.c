@@ -38,6 +38,7 @@
 #include "py/runtime.h"
 #include "py/repl.h"
 #include "py/gc.h"
+#include "py/profile.h"
 #include "py/stackctrl.h"
 
 #include "lib/mp-readline/readline.h"
@@ -155,6 +156,11 @@ void stop_mp(void) {
     MP_STATE_VM(vfs_cur) = vfs;
     #endif
 
+    #if MICROPY_PY_UPROFILE
+    // the profile table is about to be freed with the heap
+    mp_prof_reset();
+    #endif
+
     gc_deinit();
 }
 
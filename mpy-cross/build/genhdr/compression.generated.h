@@ -0,0 +1,2 @@
+const uint8_t lengths[] = { 0, 0, 1, 8, 6, 5, 8, 3, 7, 12, 14, 10, 4, 0 };
+const uint8_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 99, 100, 108, 109, 112, 117, 39, 95, 98, 102, 103, 37, 69, 104, 113, 118, 119, 120, 121, 78, 106, 107, 40, 41, 45, 65, 73, 79, 83, 42, 44, 47, 48, 58, 60, 62, 67, 68, 82, 84, 85, 35, 49, 50, 51, 61, 66, 70, 71, 76, 77, 80, 86, 122, 125, 10, 13, 34, 46, 54, 56, 72, 75, 90, 123, 52, 59, 88, 89 };
@@ -0,0 +1,1127 @@
+// 32   939 000 0
+// 97 a 478 0010 2
+// 101 e 881 0011 3
+// 105 i 496 0100 4
+// 110 n 616 0101 5
+// 111 o 598 0110 6
+// 114 r 560 0111 7
+// 115 s 451 1000 8
+// 116 t 780 1001 9
+// 99 c 322 10100 20
+// 100 d 285 10101 21
+// 108 l 283 10110 22
+// 109 m 216 10111 23
+// 112 p 252 11000 24
+// 117 u 272 11001 25
+// 39 \' 162 110100 52
+// 95 _ 208 110101 53
+// 98 b 142 110110 54
+// 102 f 160 110111 55
+// 103 g 152 111000 56
+// 37 % 89 1110010 114
+// 69 E 70 1110011 115
+// 104 h 80 1110100 116
+// 113 q 57 1110101 117
+// 118 v 70 1110110 118
+// 119 w 62 1110111 119
+// 120 x 76 1111000 120
+// 121 y 114 1111001 121
+// 78 N 34 11110100 244
+// 106 j 37 11110101 245
+// 107 k 44 11110110 246
+// 40 ( 24 111101110 494
+// 41 ) 24 111101111 495
+// 45 - 23 111110000 496
+// 65 A 14 111110001 497
+// 73 I 18 111110010 498
+// 79 O 19 111110011 499
+// 83 S 17 111110100 500
+// 42 * 9 1111101010 1002
+// 44 , 11 1111101011 1003
+// 47 / 9 1111101100 1004
+// 48 0 8 1111101101 1005
+// 58 : 10 1111101110 1006
+// 60 < 9 1111101111 1007
+// 62 > 9 1111110000 1008
+// 67 C 9 1111110001 1009
+// 68 D 10 1111110010 1010
+// 82 R 13 1111110011 1011
+// 84 T 14 1111110100 1012
+// 85 U 9 1111110101 1013
+// 35 # 5 11111101100 2028
+// 49 1 6 11111101101 2029
+// 50 2 5 11111101110 2030
+// 51 3 4 11111101111 2031
+// 61 = 4 11111110000 2032
+// 66 B 5 11111110001 2033
+// 70 F 6 11111110010 2034
+// 71 G 4 11111110011 2035
+// 76 L 4 11111110100 2036
+// 77 M 6 11111110101 2037
+// 80 P 6 11111110110 2038
+// 86 V 5 11111110111 2039
+// 122 z 6 11111111000 2040
+// 125 } 4 11111111001 2041
+// 10 \n 3 111111110100 4084
+// 13 \r 2 111111110101 4085
+// 34 \" 2 111111110110 4086
+// 46 . 3 111111110111 4087
+// 54 6 2 111111111000 4088
+// 56 8 2 111111111001 4089
+// 72 H 3 111111111010 4090
+// 75 K 2 111111111011 4091
+// 90 Z 1 111111111100 4092
+// 123 { 2 111111111101 4093
+// 52 4 1 1111111111100 8188
+// 59 ; 1 1111111111101 8189
+// 88 X 1 1111111111110 8190
+// 89 Y 1 1111111111111 8191
+// length count {3: 1, 4: 8, 5: 6, 6: 5, 7: 8, 8: 3, 9: 7, 10: 12, 11: 14, 12: 10, 13: 4}
+// values [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', "'", '_', 'b', 'f', 'g', '%', 'E', 'h', 'q', 'v', 'w', 'x', 'y', 'N', 'j', 'k', '(', ')', '-', 'A', 'I', 'O', 'S', '*', ',', '/', '0', ':', '<', '>', 'C', 'D', 'R', 'T', 'U', '#', '1', '2', '3', '=', 'B', 'F', 'G', 'L', 'M', 'P', 'V', 'z', '}', '\n', '\r', '"', '.', '6', '8', 'H', 'K', 'Z', '{', '4', ';', 'X', 'Y'] lengths 14 bytearray(b'\x00\x00\x01\x08\x06\x05\x08\x03\x07\x0c\x0e\n\x04\x00')
+// estimated total memory size 44304
+// [' ', 'a', 'e', 'i', 'n', 'o', 'r', 's', 't', 'c', 'd', 'l', 'm', 'p', 'u', "'", '_', 'b', 'f', 'g', '%', 'E', 'h', 'q', 'v', 'w', 'x', 'y', 'N', 'j', 'k', '(', ')', '-', 'A', 'I', 'O', 'S', '*', ',', '/', '0', ':', '<', '>', 'C', 'D', 'R', 'T', 'U', '#', '1', '2', '3', '=', 'B', 'F', 'G', 'L', 'M', 'P', 'V', 'z', '}', '\n', '\r', '"', '.', '6', '8', 'H', 'K', 'Z', '{', '4', ';', 'X', 'Y'] bytearray(b'\x00\x00\x01\x08\x06\x05\x08\x03\x07\x0c\x0e\n\x04\x00')
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00\x00" "")
+QDEF(MP_QSTR_, (const byte*)"\x05\x15\x00" "")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x82\x07" "__add__")
+QDEF(MP_QSTR___aenter__, (const byte*)"\x4c\x84\x0a" "__aenter__")
+QDEF(MP_QSTR___aexit__, (const byte*)"\xc4\xcf\x09" "__aexit__")
+QDEF(MP_QSTR___aiter__, (const byte*)"\x4e\x2b\x09" "__aiter__")
+QDEF(MP_QSTR___anext__, (const byte*)"\x83\xb4\x09" "__anext__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x65\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x88\x0f" "__build_class__")
+QDEF(MP_QSTR___bytes__, (const byte*)"\xdc\x81\x09" "__bytes__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\xf9\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\xc5\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x5f\x0c" "__contains__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x35\x0b" "__delitem__")
+QDEF(MP_QSTR___dict__, (const byte*)"\x7f\x54\x08" "__dict__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\xba\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x3e\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\xf8\x08" "__exit__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x46\x06" "__ge__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\xf8\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x39\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x82\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\xc8\x08" "__hash__")
+QDEF(MP_QSTR___iadd__, (const byte*)"\x6d\x4a\x08" "__iadd__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x3e\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\xa5\x08" "__init__")
+QDEF(MP_QSTR___isub__, (const byte*)"\x08\x78\x08" "__isub__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x32\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x13\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\xb0\x07" "__len__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x68\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x13\x08" "__main__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x30\x0a" "__module__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x38\x08" "__name__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x15\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x73\x08" "__next__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x23\x08" "__path__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x00\x0c" "__qualname__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x00\xbb\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x0b\x08" "__repr__")
+QDEF(MP_QSTR___reversed__, (const byte*)"\x61\xff\x0c" "__reversed__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x3e\x0b" "__setitem__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\xcd\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x09\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\xcf\x0d" "__traceback__")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\xb5\x01" "*")
+QDEF(MP_QSTR__, (const byte*)"\xfa\xb5\x01" "_")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\xb5\x01" "/")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x1a\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x1a\x03" "%#x")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\x58\x37\x05" "{:#b}")
+QDEF(MP_QSTR__space_, (const byte*)"\x85\xb5\x01" " ")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\xb5\x01" "\x0a")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x1e\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x94\x08" "<module>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x8c\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x15\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x8d\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x51\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x6a\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x53\x08" "<string>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x63\x07" "<stdin>")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x82\x05" "utf-8")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x8c\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x5a\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\xde\x0e" "AttributeError")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x92\x0d" "BaseException")
+QDEF(MP_QSTR_EACCES, (const byte*)"\x37\xc2\x06" "EACCES")
+QDEF(MP_QSTR_EADDRINUSE, (const byte*)"\x17\x11\x0a" "EADDRINUSE")
+QDEF(MP_QSTR_EAGAIN, (const byte*)"\x20\xec\x06" "EAGAIN")
+QDEF(MP_QSTR_EALREADY, (const byte*)"\x46\x15\x08" "EALREADY")
+QDEF(MP_QSTR_EBADF, (const byte*)"\x61\xa3\x05" "EBADF")
+QDEF(MP_QSTR_ECONNABORTED, (const byte*)"\x27\xab\x0c" "ECONNABORTED")
+QDEF(MP_QSTR_ECONNREFUSED, (const byte*)"\x3a\x2c\x0c" "ECONNREFUSED")
+QDEF(MP_QSTR_ECONNRESET, (const byte*)"\x19\xfb\x0a" "ECONNRESET")
+QDEF(MP_QSTR_EEXIST, (const byte*)"\x53\xad\x06" "EEXIST")
+QDEF(MP_QSTR_EHOSTUNREACH, (const byte*)"\x86\x25\x0c" "EHOSTUNREACH")
+QDEF(MP_QSTR_EINPROGRESS, (const byte*)"\x9a\xa0\x0b" "EINPROGRESS")
+QDEF(MP_QSTR_EINVAL, (const byte*)"\x5c\xff\x06" "EINVAL")
+QDEF(MP_QSTR_EIO, (const byte*)"\x86\xa6\x03" "EIO")
+QDEF(MP_QSTR_EISDIR, (const byte*)"\xa5\x4f\x06" "EISDIR")
+QDEF(MP_QSTR_ENOBUFS, (const byte*)"\xe3\x87\x07" "ENOBUFS")
+QDEF(MP_QSTR_ENODEV, (const byte*)"\xb6\x67\x06" "ENODEV")
+QDEF(MP_QSTR_ENOENT, (const byte*)"\x5e\x65\x06" "ENOENT")
+QDEF(MP_QSTR_ENOMEM, (const byte*)"\xa4\x85\x06" "ENOMEM")
+QDEF(MP_QSTR_ENOTCONN, (const byte*)"\x79\xd7\x08" "ENOTCONN")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\xbf\x08" "EOFError")
+QDEF(MP_QSTR_EOPNOTSUPP, (const byte*)"\xac\x97\x0a" "EOPNOTSUPP")
+QDEF(MP_QSTR_EPERM, (const byte*)"\xea\x7f\x05" "EPERM")
+QDEF(MP_QSTR_ETIMEDOUT, (const byte*)"\xff\xf8\x09" "ETIMEDOUT")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\xe0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x29\x09" "Exception")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x62\x0d" "GeneratorExit")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x9c\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x20\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\xad\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x00\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\xe2\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x69\x0b" "LookupError")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x83\x0b" "MemoryError")
+QDEF(MP_QSTR_MpyError, (const byte*)"\x39\x7f\x08" "MpyError")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x2d\x09" "NameError")
+QDEF(MP_QSTR_None, (const byte*)"\x6f\xd1\x04" "None")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x68\x08" "NoneType")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x98\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x65\x07" "OSError")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\xe1\x0d" "OverflowError")
+QDEF(MP_QSTR_ReloadException, (const byte*)"\x03\xc2\x0f" "ReloadException")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\xf1\x0c" "RuntimeError")
+QDEF(MP_QSTR_StopAsyncIteration, (const byte*)"\xec\xf0\x12" "StopAsyncIteration")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x1c\x0d" "StopIteration")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x8f\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\xff\x0a" "SystemExit")
+QDEF(MP_QSTR_TimeoutError, (const byte*)"\x66\x4b\x0c" "TimeoutError")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x96\x09" "TypeError")
+QDEF(MP_QSTR_UnicodeError, (const byte*)"\x22\xd1\x0c" "UnicodeError")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x87\x0a" "ValueError")
+QDEF(MP_QSTR_ViperTypeError, (const byte*)"\xdd\x05\x0e" "ViperTypeError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x27\x11" "ZeroDivisionError")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x32\x03" "abs")
+QDEF(MP_QSTR_add, (const byte*)"\x44\x32\x03" "add")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x33\x03" "all")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x33\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x97\x06" "append")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\xc6\x04" "args")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x48\x03" "bin")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x3c\x04" "bool")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\xa2\x0c" "bound_method")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x31\x08" "builtins")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\xa3\x09" "bytearray")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x7d\x08" "bytecode")
+QDEF(MP_QSTR_byteorder, (const byte*)"\x61\x99\x09" "byteorder")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\xb2\x05" "bytes")
+QDEF(MP_QSTR_calcsize, (const byte*)"\x4d\x38\x08" "calcsize")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x70\x08" "callable")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x4c\x03" "chr")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x8c\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\xa0\x05" "clear")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x67\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\xca\x07" "closure")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x9d\x07" "complex")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\xff\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\xdb\x04" "copy")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x4d\x05" "count")
+QDEF(MP_QSTR_decode, (const byte*)"\xa9\x59\x06" "decode")
+QDEF(MP_QSTR_default, (const byte*)"\xce\x7d\x07" "default")
+QDEF(MP_QSTR_delattr, (const byte*)"\xdb\xc8\x07" "delattr")
+QDEF(MP_QSTR_deleter, (const byte*)"\x6e\xdb\x07" "deleter")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\xfc\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\xa9\x09" "dict_view")
+QDEF(MP_QSTR_difference, (const byte*)"\x72\x24\x0a" "difference")
+QDEF(MP_QSTR_difference_update, (const byte*)"\x9c\xfa\x11" "difference_update")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x1e\x03" "dir")
+QDEF(MP_QSTR_discard, (const byte*)"\x0f\x71\x07" "discard")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x04\x06" "divmod")
+QDEF(MP_QSTR_doc, (const byte*)"\x2d\x1f\x03" "doc")
+QDEF(MP_QSTR_encode, (const byte*)"\x43\xca\x06" "encode")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x23\x03" "end")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\xa3\x08" "endswith")
+QDEF(MP_QSTR_enumerate, (const byte*)"\x71\xba\x09" "enumerate")
+QDEF(MP_QSTR_errno, (const byte*)"\xc1\x11\x05" "errno")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\xa6\x04" "eval")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\xc0\x04" "exec")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\xe8\x06" "extend")
+QDEF(MP_QSTR_filename, (const byte*)"\xe4\x54\x08" "filename")
+QDEF(MP_QSTR_filename2, (const byte*)"\x56\xf1\x09" "filename2")
+QDEF(MP_QSTR_filter, (const byte*)"\x25\xbe\x06" "filter")
+QDEF(MP_QSTR_find, (const byte*)"\x00\x34\x04" "find")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x44\x05" "float")
+QDEF(MP_QSTR_flush, (const byte*)"\x61\xc1\x05" "flush")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x33\x06" "format")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x74\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\xbd\x08" "fromkeys")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x02\x08" "function")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\xc3\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x3b\x03" "get")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x17\x07" "getattr")
+QDEF(MP_QSTR_getter, (const byte*)"\x90\xb2\x06" "getter")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x49\x07" "globals")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\xb0\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x70\x04" "hash")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x8c\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x2d\x0b" "heap_unlock")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x50\x03" "hex")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x6f\x02" "id")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\xb7\x04" "imag")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x28\x05" "index")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x54\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x53\x03" "int")
+QDEF(MP_QSTR_intersection, (const byte*)"\x28\x2a\x0c" "intersection")
+QDEF(MP_QSTR_intersection_update, (const byte*)"\x06\xdd\x13" "intersection_update")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x37\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x9a\x07" "isdigit")
+QDEF(MP_QSTR_isdisjoint, (const byte*)"\xf7\x68\x0a" "isdisjoint")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\xbe\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x80\x07" "islower")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\xf8\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x7f\x0a" "issubclass")
+QDEF(MP_QSTR_issubset, (const byte*)"\xb9\xc1\x08" "issubset")
+QDEF(MP_QSTR_issuperset, (const byte*)"\xfc\xec\x0a" "issuperset")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\xa7\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x53\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x21\x04" "iter")
+QDEF(MP_QSTR_iterable, (const byte*)"\x25\x92\x08" "iterable")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\xbe\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x5c\x04" "join")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x6d\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x13\x04" "keys")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x40\x03" "len")
+QDEF(MP_QSTR_length, (const byte*)"\x59\x87\x06" "length")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x1d\x04" "list")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x6a\x06" "little")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\xa1\x06" "locals")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\xcb\x05" "lower")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\xb9\x06" "lstrip")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x43\x03" "map")
+QDEF(MP_QSTR_max, (const byte*)"\xb1\x43\x03" "max")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x7c\x0b" "micropython")
+QDEF(MP_QSTR_min, (const byte*)"\xaf\x42\x03" "min")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x99\x06" "module")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x0b\x06" "native")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x88\x04" "next")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x8d\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x5c\x03" "oct")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x67\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x5e\x03" "ord")
+QDEF(MP_QSTR_pack, (const byte*)"\xbc\xd1\x04" "pack")
+QDEF(MP_QSTR_pack_into, (const byte*)"\x1f\xa9\x09" "pack_into")
+QDEF(MP_QSTR_pend_throw, (const byte*)"\xf3\x74\x0a" "pend_throw")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x73\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x2c\x07" "popitem")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x73\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\xc6\x05" "print")
+QDEF(MP_QSTR_property, (const byte*)"\xc2\x29\x08" "property")
+QDEF(MP_QSTR_protocol_pin, (const byte*)"\x1b\x57\x0c" "protocol_pin")
+QDEF(MP_QSTR_protocol_stream, (const byte*)"\x90\x24\x0f" "protocol_stream")
+QDEF(MP_QSTR_ptr, (const byte*)"\x53\x70\x03" "ptr")
+QDEF(MP_QSTR_ptr16, (const byte*)"\xf4\xca\x05" "ptr16")
+QDEF(MP_QSTR_ptr32, (const byte*)"\xb2\xca\x05" "ptr32")
+QDEF(MP_QSTR_ptr8, (const byte*)"\x8b\x7a\x04" "ptr8")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x5e\x05" "range")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\xf9\x04" "real")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x8a\x06" "remove")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x25\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\xf7\x04" "repr")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x2a\x07" "reverse")
+QDEF(MP_QSTR_reversed, (const byte*)"\xa1\x6e\x08" "reversed")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x9c\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x2b\x06" "rindex")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x25\x05" "round")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x00\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x95\x06" "rstrip")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x76\x04" "send")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x8f\x03" "sep")
+QDEF(MP_QSTR_set, (const byte*)"\x27\x8f\x03" "set")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\xa8\x07" "setattr")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\xa3\x0a" "setdefault")
+QDEF(MP_QSTR_setter, (const byte*)"\x04\x59\x06" "setter")
+QDEF(MP_QSTR_signed, (const byte*)"\x37\x01\x06" "signed")
+QDEF(MP_QSTR_slice, (const byte*)"\xb5\xf4\x05" "slice")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x9d\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x15\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x33\x05" "split")
+QDEF(MP_QSTR_start, (const byte*)"\x85\xef\x05" "start")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\xe8\x0a" "startswith")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\xaf\x0c" "staticmethod")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x36\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x36\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x8d\x03" "str")
+QDEF(MP_QSTR_strerror, (const byte*)"\x48\x71\x08" "strerror")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x1e\x05" "strip")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x8d\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\xb2\x05" "super")
+QDEF(MP_QSTR_symmetric_difference, (const byte*)"\xce\x67\x14" "symmetric_difference")
+QDEF(MP_QSTR_symmetric_difference_update, (const byte*)"\x60\xf8\x1b" "symmetric_difference_update")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x44\x05" "throw")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x3e\x08" "to_bytes")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x41\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x7f\x04" "type")
+QDEF(MP_QSTR_uint, (const byte*)"\xe3\x3d\x04" "uint")
+QDEF(MP_QSTR_union, (const byte*)"\xf6\x7c\x05" "union")
+QDEF(MP_QSTR_unpack, (const byte*)"\x07\x3c\x06" "unpack")
+QDEF(MP_QSTR_unpack_from, (const byte*)"\x0e\x6d\x0b" "unpack_from")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x76\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x94\x05" "upper")
+QDEF(MP_QSTR_ustruct, (const byte*)"\x47\x08\x07" "ustruct")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x34\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\xbe\x06" "values")
+QDEF(MP_QSTR_viper, (const byte*)"\x5d\x23\x05" "viper")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\xac\x03" "zip")
+QHASH(168)
+QHASH(0)
+QHASH(0)
+QHASH(108)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(67)
+QHASH(27)
+QHASH(282)
+QHASH(0)
+QHASH(218)
+QHASH(0)
+QHASH(135)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(188)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(93)
+QHASH(104)
+QHASH(0)
+QHASH(0)
+QHASH(241)
+QHASH(0)
+QHASH(226)
+QHASH(0)
+QHASH(163)
+QHASH(0)
+QHASH(70)
+QHASH(66)
+QHASH(94)
+QHASH(0)
+QHASH(0)
+QHASH(115)
+QHASH(167)
+QHASH(174)
+QHASH(190)
+QHASH(204)
+QHASH(246)
+QHASH(271)
+QHASH(285)
+QHASH(64)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(42)
+QHASH(0)
+QHASH(60)
+QHASH(169)
+QHASH(172)
+QHASH(68)
+QHASH(25)
+QHASH(0)
+QHASH(74)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(149)
+QHASH(20)
+QHASH(0)
+QHASH(9)
+QHASH(157)
+QHASH(121)
+QHASH(18)
+QHASH(222)
+QHASH(205)
+QHASH(286)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(4)
+QHASH(134)
+QHASH(287)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(237)
+QHASH(233)
+QHASH(0)
+QHASH(0)
+QHASH(267)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(197)
+QHASH(95)
+QHASH(31)
+QHASH(133)
+QHASH(0)
+QHASH(275)
+QHASH(0)
+QHASH(209)
+QHASH(164)
+QHASH(243)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(38)
+QHASH(49)
+QHASH(16)
+QHASH(24)
+QHASH(0)
+QHASH(184)
+QHASH(17)
+QHASH(151)
+QHASH(54)
+QHASH(140)
+QHASH(160)
+QHASH(265)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(50)
+QHASH(138)
+QHASH(187)
+QHASH(288)
+QHASH(15)
+QHASH(56)
+QHASH(0)
+QHASH(0)
+QHASH(7)
+QHASH(0)
+QHASH(0)
+QHASH(80)
+QHASH(0)
+QHASH(0)
+QHASH(212)
+QHASH(0)
+QHASH(240)
+QHASH(180)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(178)
+QHASH(236)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(120)
+QHASH(0)
+QHASH(65)
+QHASH(128)
+QHASH(0)
+QHASH(78)
+QHASH(162)
+QHASH(152)
+QHASH(268)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(247)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(251)
+QHASH(0)
+QHASH(19)
+QHASH(193)
+QHASH(206)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(182)
+QHASH(0)
+QHASH(98)
+QHASH(219)
+QHASH(0)
+QHASH(239)
+QHASH(276)
+QHASH(137)
+QHASH(260)
+QHASH(22)
+QHASH(63)
+QHASH(155)
+QHASH(181)
+QHASH(195)
+QHASH(253)
+QHASH(284)
+QHASH(55)
+QHASH(0)
+QHASH(231)
+QHASH(0)
+QHASH(0)
+QHASH(125)
+QHASH(0)
+QHASH(3)
+QHASH(273)
+QHASH(105)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(28)
+QHASH(0)
+QHASH(0)
+QHASH(248)
+QHASH(0)
+QHASH(256)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(277)
+QHASH(0)
+QHASH(0)
+QHASH(147)
+QHASH(136)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(126)
+QHASH(0)
+QHASH(30)
+QHASH(34)
+QHASH(165)
+QHASH(0)
+QHASH(290)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(97)
+QHASH(111)
+QHASH(110)
+QHASH(127)
+QHASH(0)
+QHASH(0)
+QHASH(91)
+QHASH(0)
+QHASH(0)
+QHASH(229)
+QHASH(238)
+QHASH(0)
+QHASH(281)
+QHASH(23)
+QHASH(194)
+QHASH(0)
+QHASH(153)
+QHASH(0)
+QHASH(196)
+QHASH(200)
+QHASH(224)
+QHASH(33)
+QHASH(39)
+QHASH(90)
+QHASH(36)
+QHASH(208)
+QHASH(258)
+QHASH(2)
+QHASH(191)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(158)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(283)
+QHASH(154)
+QHASH(40)
+QHASH(0)
+QHASH(0)
+QHASH(123)
+QHASH(0)
+QHASH(0)
+QHASH(189)
+QHASH(69)
+QHASH(0)
+QHASH(75)
+QHASH(0)
+QHASH(159)
+QHASH(235)
+QHASH(0)
+QHASH(0)
+QHASH(228)
+QHASH(113)
+QHASH(44)
+QHASH(116)
+QHASH(131)
+QHASH(254)
+QHASH(0)
+QHASH(21)
+QHASH(73)
+QHASH(171)
+QHASH(185)
+QHASH(211)
+QHASH(8)
+QHASH(12)
+QHASH(150)
+QHASH(156)
+QHASH(230)
+QHASH(232)
+QHASH(255)
+QHASH(207)
+QHASH(139)
+QHASH(176)
+QHASH(272)
+QHASH(0)
+QHASH(173)
+QHASH(259)
+QHASH(101)
+QHASH(0)
+QHASH(213)
+QHASH(252)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(122)
+QHASH(0)
+QHASH(71)
+QHASH(186)
+QHASH(270)
+QHASH(244)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(6)
+QHASH(45)
+QHASH(269)
+QHASH(0)
+QHASH(61)
+QHASH(76)
+QHASH(59)
+QHASH(0)
+QHASH(166)
+QHASH(183)
+QHASH(51)
+QHASH(210)
+QHASH(0)
+QHASH(0)
+QHASH(79)
+QHASH(289)
+QHASH(84)
+QHASH(26)
+QHASH(262)
+QHASH(41)
+QHASH(72)
+QHASH(109)
+QHASH(132)
+QHASH(170)
+QHASH(114)
+QHASH(266)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(124)
+QHASH(257)
+QHASH(0)
+QHASH(148)
+QHASH(103)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(130)
+QHASH(0)
+QHASH(0)
+QHASH(35)
+QHASH(86)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(107)
+QHASH(0)
+QHASH(96)
+QHASH(221)
+QHASH(52)
+QHASH(77)
+QHASH(225)
+QHASH(264)
+QHASH(0)
+QHASH(48)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(32)
+QHASH(46)
+QHASH(203)
+QHASH(87)
+QHASH(223)
+QHASH(0)
+QHASH(112)
+QHASH(0)
+QHASH(117)
+QHASH(175)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(179)
+QHASH(279)
+QHASH(0)
+QHASH(0)
+QHASH(106)
+QHASH(0)
+QHASH(0)
+QHASH(85)
+QHASH(81)
+QHASH(144)
+QHASH(11)
+QHASH(0)
+QHASH(145)
+QHASH(0)
+QHASH(0)
+QHASH(88)
+QHASH(0)
+QHASH(0)
+QHASH(53)
+QHASH(0)
+QHASH(217)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(198)
+QHASH(83)
+QHASH(119)
+QHASH(263)
+QHASH(199)
+QHASH(102)
+QHASH(216)
+QHASH(227)
+QHASH(0)
+QHASH(0)
+QHASH(220)
+QHASH(142)
+QHASH(161)
+QHASH(177)
+QHASH(234)
+QHASH(5)
+QHASH(141)
+QHASH(13)
+QHASH(214)
+QHASH(37)
+QHASH(242)
+QHASH(261)
+QHASH(0)
+QHASH(29)
+QHASH(58)
+QHASH(146)
+QHASH(274)
+QHASH(43)
+QHASH(245)
+QHASH(0)
+QHASH(0)
+QHASH(57)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(10)
+QHASH(100)
+QHASH(118)
+QHASH(201)
+QHASH(143)
+QHASH(0)
+QHASH(0)
+QHASH(62)
+QHASH(82)
+QHASH(202)
+QHASH(215)
+QHASH(250)
+QHASH(280)
+QHASH(249)
+QHASH(89)
+QHASH(192)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(92)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(0)
+QHASH(129)
+QHASH(0)
+QHASH(0)
+QHASH(47)
+QHASH(0)
+QHASH(0)
+QHASH(14)
+QHASH(278)
+QHASH(99)
+TRANSLATION("can't do binary op between '%q' and '%q'", 41, { 0xa1, 0x2e, 0x92, 0x2a, 0xc3, 0x64, 0x52, 0x7f, 0x21, 0xb0, 0x36, 0x39, 0xee, 0x66, 0xa3, 0x4e, 0x5d, 0x74, 0x04, 0xb5, 0x1a, 0x72, 0xeb, 0xa0 }) // can\'t do binary op between \'%q\' and \'%q\'
+TRANSLATION("can't convert inf to int", 25, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x42, 0x2e, 0xe2, 0x58, 0x22, 0xc8 }) // can\'t convert inf to int
+TRANSLATION("only slices with step=1 (aka None) are supported", 49, { 0x65, 0xb7, 0x91, 0x16, 0x4a, 0x1c, 0x0e, 0xe9, 0x3d, 0x04, 0x49, 0xe3, 0xf8, 0x7e, 0xd1, 0xee, 0x2f, 0x62, 0x1e, 0x8c, 0xa7, 0xef, 0x04, 0xe6, 0x23, 0x38, 0xc3, 0x3c, 0x9d, 0x40 }) // only slices with step=1 (aka None) are supported
+TRANSLATION("bytes value out of range", 25, { 0xdb, 0xcc, 0x9c, 0x0e, 0xc5, 0x6c, 0x98, 0x6c, 0xc8, 0x6d, 0xc3, 0x92, 0xf0, 0x60 }) // bytes value out of range
+TRANSLATION("Unable to init parser", 22, { 0xfd, 0x54, 0xb6, 0xb1, 0x89, 0x60, 0x8a, 0x92, 0x30, 0x4f, 0x06, 0xe0 }) // Unable to init parser
+TRANSLATION("name reused for argument", 25, { 0x52, 0xb9, 0x87, 0x3c, 0xc1, 0xd4, 0x6e, 0xce, 0x09, 0xf8, 0xcd, 0xcd, 0x64 }) // name reused for argument
+TRANSLATION("  File \"%q\", line %d", 21, { 0x03, 0xf9, 0x25, 0x8c, 0x7f, 0xb7, 0x2e, 0xbf, 0xed, 0xf5, 0x8b, 0x22, 0x98, 0xe5, 0x50 }) //   File \"%q\", line %d
+TRANSLATION("__init__() should return None", 30, { 0xd7, 0x54, 0x54, 0x9d, 0x75, 0xf7, 0x7b, 0xc4, 0x74, 0x6c, 0xda, 0xa1, 0xce, 0x72, 0xea, 0x3d, 0x19, 0x4c }) // __init__() should return None
+TRANSLATION("object '%s' is not a tuple or list", 35, { 0x6d, 0xbd, 0x4e, 0x92, 0x34, 0xe5, 0x1a, 0x04, 0x80, 0xad, 0x20, 0x84, 0xe7, 0x16, 0x30, 0xce, 0x2c, 0x91, 0x20 }) // object \'%s\' is not a tuple or list
+TRANSLATION("can't do truncated division of a complex number", 48, { 0xa1, 0x2e, 0x92, 0x2a, 0xc2, 0x5f, 0x2b, 0x42, 0x93, 0xa8, 0xaa, 0x76, 0x48, 0x46, 0x50, 0xdb, 0x82, 0x14, 0x6b, 0xe2, 0xc7, 0xe0, 0x2e, 0x6f, 0xb1, 0xb8 }) // can\'t do truncated division of a complex number
+TRANSLATION("3-arg pow() not supported", 26, { 0xfd, 0xff, 0x02, 0x7e, 0x06, 0x1b, 0xbf, 0xbb, 0xde, 0x15, 0xa4, 0x46, 0x71, 0x86, 0x79, 0x3a, 0x80 }) // 3-arg pow() not supported
+TRANSLATION("zero step", 10, { 0xff, 0x06, 0xec, 0x22, 0x4f, 0x00 }) // zero step
+TRANSLATION("sign not allowed in string format specifier", 44, { 0x84, 0xe1, 0x42, 0xb4, 0x82, 0xb5, 0x9b, 0xb9, 0xd4, 0x22, 0x88, 0x97, 0x45, 0xe0, 0x6e, 0xcf, 0x72, 0x91, 0x18, 0x3a, 0x26, 0xe8, 0x6e }) // sign not allowed in string format specifier
+TRANSLATION("can only save bytecode", 23, { 0xa1, 0x28, 0x65, 0xb7, 0x91, 0x05, 0xd8, 0xc6, 0xde, 0x64, 0xe8, 0xd5, 0x30 }) // can only save bytecode
+TRANSLATION("division by zero", 17, { 0xaa, 0x76, 0x48, 0x46, 0x51, 0xb7, 0x91, 0xfe, 0x0d, 0xd8 }) // division by zero
+TRANSLATION("issubclass() arg 1 must be a class", 35, { 0x48, 0x8c, 0xed, 0x4b, 0x14, 0x47, 0xbb, 0xde, 0x09, 0xf8, 0x1f, 0xb4, 0x5f, 0x31, 0x23, 0x63, 0x04, 0x29, 0x62, 0x88 }) // issubclass() arg 1 must be a class
+TRANSLATION("object has no len", 18, { 0x6d, 0xbd, 0x4e, 0x92, 0x3a, 0x14, 0x05, 0x61, 0x63, 0x50 }) // object has no len
+TRANSLATION("File exists", 12, { 0xfe, 0x49, 0x63, 0x07, 0xe1, 0x22, 0x60 }) // File exists
+TRANSLATION("'async for' or 'async with' outside async function", 51, { 0xd0, 0xa3, 0xca, 0xd0, 0x6e, 0xcf, 0xa0, 0x67, 0x1a, 0x14, 0x79, 0x5a, 0x0e, 0xe9, 0x3d, 0x34, 0x0d, 0x99, 0x84, 0xa9, 0x82, 0x8f, 0x2b, 0x41, 0xbe, 0x56, 0x92, 0x8c, 0xa0 }) // \'async for\' or \'async with\' outside async function
+TRANSLATION("type '%q' is not an acceptable base type", 41, { 0x9f, 0x38, 0x31, 0xa7, 0x2e, 0xba, 0x04, 0x80, 0xad, 0x20, 0x94, 0x15, 0x28, 0x78, 0x92, 0xda, 0xc6, 0x36, 0x28, 0x31, 0x3e, 0x70, 0x60 }) // type \'%q\' is not an acceptable base type
+TRANSLATION("too many values to unpack (expected %d)", 40, { 0x96, 0x61, 0x72, 0x5f, 0x23, 0xb1, 0x5b, 0x27, 0x02, 0x58, 0x65, 0x70, 0x54, 0xf6, 0x1e, 0xe3, 0xf1, 0x83, 0xa4, 0x9d, 0x47, 0x2a, 0xfb, 0xc0 }) // too many values to unpack (expected %d)
+TRANSLATION("unknown type '%q'", 18, { 0xca, 0xfb, 0x2b, 0x77, 0x51, 0x3e, 0x70, 0x63, 0x4e, 0x5d, 0x74 }) // unknown type \'%q\'
+TRANSLATION("unknown conversion specifier %c", 32, { 0xca, 0xfb, 0x2b, 0x77, 0x51, 0x46, 0x5e, 0xc6, 0xf0, 0x8c, 0xa2, 0x30, 0x74, 0x4d, 0xd0, 0xdc, 0x72, 0xa0 }) // unknown conversion specifier %c
+TRANSLATION("object with buffer protocol required", 37, { 0x6d, 0xbd, 0x4e, 0x92, 0x3b, 0xa4, 0xf4, 0x1b, 0x67, 0x7d, 0xcd, 0xc6, 0x1d, 0xa5, 0xa8, 0xd6, 0x0e, 0x7d, 0x72, 0x8e, 0x75 }) // object with buffer protocol required
+TRANSLATION("attributes not supported yet", 29, { 0x29, 0x97, 0x4d, 0xb3, 0x27, 0x01, 0x5a, 0x44, 0x67, 0x18, 0x67, 0x93, 0xa8, 0xf2, 0x72 }) // attributes not supported yet
+TRANSLATION("f-string expression part cannot include a '#'", 46, { 0xdf, 0xe1, 0x12, 0xe8, 0xbc, 0x03, 0xf1, 0x87, 0x38, 0x84, 0x65, 0x18, 0x27, 0x91, 0x42, 0x55, 0x69, 0x08, 0xb4, 0xb6, 0x6a, 0x60, 0x86, 0x9f, 0xb3, 0x40 }) // f-string expression part cannot include a \'#\'
+TRANSLATION("memory allocation failed, allocating %u bytes", 46, { 0xb9, 0xdd, 0x9f, 0xc8, 0x2b, 0x59, 0xa8, 0x52, 0x8c, 0xa3, 0x72, 0x4b, 0x1d, 0x7e, 0xb0, 0x56, 0xb3, 0x50, 0xa5, 0x17, 0x81, 0xcb, 0x23, 0x6f, 0x32, 0x70 }) // memory allocation failed, allocating %u bytes
+TRANSLATION("unexpected keyword argument '%q'", 33, { 0xca, 0x9f, 0x8c, 0x1d, 0x24, 0xea, 0x3d, 0x8f, 0xcf, 0x76, 0x7a, 0x82, 0x7e, 0x33, 0x73, 0x59, 0x1a, 0x72, 0xeb, 0xa0 }) // unexpected keyword argument \'%q\'
+TRANSLATION("unsupported types for %q: '%s', '%s'", 37, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3a, 0x89, 0xf3, 0x83, 0x81, 0xbb, 0x38, 0xe5, 0xd7, 0xee, 0x1a, 0x72, 0x8d, 0x3e, 0xb1, 0xa7, 0x28, 0xd0 }) // unsupported types for %q: \'%s\', \'%s\'
+TRANSLATION("can't store to '%q'", 20, { 0xa1, 0x2e, 0x92, 0x22, 0x59, 0xcc, 0x4b, 0x0d, 0x39, 0x75, 0xd0 }) // can\'t store to \'%q\'
+TRANSLATION("byte code not implemented", 26, { 0xdb, 0xcc, 0x98, 0xa3, 0x54, 0xc2, 0xb4, 0x84, 0xbe, 0x2c, 0x77, 0x35, 0x93, 0xa8 }) // byte code not implemented
+TRANSLATION("can't have multiple *x", 23, { 0xa1, 0x2e, 0x92, 0x3a, 0x17, 0x63, 0x17, 0xcd, 0xa5, 0x31, 0x63, 0x1f, 0x57, 0x80 }) // can\'t have multiple *x
+TRANSLATION("Permission denied", 18, { 0xfe, 0xc6, 0xf7, 0x48, 0x84, 0x65, 0x15, 0x35, 0x43, 0xa8 }) // Permission denied
+TRANSLATION("local '%q' has type '%q' but source is '%q'", 44, { 0xb3, 0x50, 0xac, 0x34, 0xe5, 0xd7, 0x41, 0xd0, 0xa0, 0x4f, 0x9c, 0x18, 0xd3, 0x97, 0x5d, 0x06, 0xd9, 0x91, 0x0d, 0x97, 0xa1, 0x84, 0x81, 0xa7, 0x2e, 0xba, 0x00 }) // local \'%q\' has type \'%q\' but source is \'%q\'
+TRANSLATION("string index out of range", 26, { 0x89, 0x74, 0x5e, 0x02, 0x2d, 0x4f, 0xc0, 0x6c, 0xc8, 0x6d, 0xc3, 0x92, 0xf0, 0x60 }) // string index out of range
+TRANSLATION("can't convert to int", 21, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x44, 0xb0, 0x45, 0x90 }) // can\'t convert to int
+TRANSLATION("must use keyword argument for key function", 43, { 0xbe, 0x62, 0x46, 0x60, 0xc7, 0xb1, 0xf9, 0xee, 0xcf, 0x50, 0x4f, 0xc6, 0x6e, 0x6b, 0x23, 0x76, 0x71, 0xec, 0x7e, 0x46, 0xf9, 0x5a, 0x4a, 0x32, 0x80 }) // must use keyword argument for key function
+TRANSLATION("tuple/list has wrong length", 28, { 0x9c, 0xe2, 0xc7, 0xf6, 0x59, 0x22, 0x47, 0x42, 0x81, 0xdd, 0xd9, 0x78, 0x16, 0x35, 0xe2, 0x7a, 0x00 }) // tuple/list has wrong length
+TRANSLATION("tuple index out of range", 25, { 0x9c, 0xe2, 0xc6, 0x11, 0x6a, 0x7e, 0x03, 0x66, 0x43, 0x6e, 0x1c, 0x97, 0x83 }) // tuple index out of range
+TRANSLATION("default 'except' must be last", 30, { 0xa9, 0xee, 0x59, 0xb4, 0x8d, 0x0f, 0xc5, 0x0f, 0x13, 0xa0, 0xbe, 0x62, 0x46, 0xc6, 0x2c, 0x51, 0x20 }) // default \'except\' must be last
+TRANSLATION("end of format while looking for conversion specifier", 53, { 0x35, 0xa8, 0x6d, 0xc6, 0xec, 0xf7, 0x29, 0x1d, 0xfa, 0x25, 0x8c, 0x59, 0x9b, 0xd9, 0x17, 0x81, 0xbb, 0x38, 0xa3, 0x2f, 0x63, 0x78, 0x46, 0x51, 0x18, 0x3a, 0x26, 0xe8, 0x6e }) // end of format while looking for conversion specifier
+TRANSLATION("'%s' object is not callable", 28, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x84, 0x80, 0xad, 0x22, 0x85, 0x6b, 0x16, 0xd6, 0x30 }) // \'%s\' object is not callable
+TRANSLATION("can't convert to str implicitly", 32, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x44, 0xb0, 0x89, 0x70, 0x97, 0xc5, 0x92, 0x89, 0x36, 0xf2 }) // can\'t convert to str implicitly
+TRANSLATION("chr() arg not in range(0x110000)", 33, { 0xa7, 0x47, 0xf7, 0x7b, 0xc1, 0x3f, 0x01, 0x5a, 0x42, 0x28, 0x72, 0x5e, 0x0f, 0xdd, 0xf6, 0xf8, 0xfd, 0xbf, 0xb7, 0xed, 0xfb, 0x7e, 0xdf, 0xb7, 0xde }) // chr() arg not in range(0x110000)
+TRANSLATION("invalid syntax for number", 26, { 0x45, 0xec, 0x56, 0x4a, 0x88, 0xf2, 0xb2, 0x5e, 0x06, 0xec, 0xe1, 0x73, 0x7d, 0x8d, 0xc0 }) // invalid syntax for number
+TRANSLATION("can't store '%q'", 17, { 0xa1, 0x2e, 0x92, 0x22, 0x59, 0xcc, 0x69, 0xcb, 0xae, 0x80 }) // can\'t store \'%q\'
+TRANSLATION("rsplit(None,n)", 15, { 0x78, 0xc5, 0x92, 0x7d, 0xde, 0x8c, 0xa7, 0xf5, 0xaf, 0xbc }) // rsplit(None,n)
+TRANSLATION("expected ':' after format specifier", 36, { 0x3f, 0x18, 0x3a, 0x49, 0xd4, 0x69, 0xf7, 0x68, 0x0b, 0x79, 0x37, 0x1b, 0xb3, 0xdc, 0xa4, 0x46, 0x0e, 0x89, 0xba, 0x1b, 0x80 }) // expected \':\' after format specifier
+TRANSLATION("ord expects a character", 24, { 0x67, 0xa8, 0x3f, 0x18, 0x3a, 0x4c, 0x02, 0x14, 0xe8, 0x4e, 0x54, 0x93, 0x70 }) // ord expects a character
+TRANSLATION("No space left on device", 24, { 0xf4, 0x61, 0x18, 0x2a, 0x18, 0xb1, 0xef, 0x21, 0x94, 0x54, 0xfb, 0x25, 0x0c }) // No space left on device
+TRANSLATION("unmatched '{' in format", 24, { 0xca, 0xdc, 0xa6, 0x9d, 0x0e, 0xa3, 0x4f, 0xfd, 0xd0, 0x22, 0x8d, 0xd9, 0xee, 0x52 }) // unmatched \'{\' in format
+TRANSLATION("substring not found", 20, { 0x8c, 0xed, 0x12, 0xe8, 0xbc, 0x05, 0x69, 0x1b, 0xb6, 0x56, 0xa0 }) // substring not found
+TRANSLATION("string indices must be integers, not %s", 40, { 0x89, 0x74, 0x5e, 0x02, 0x2d, 0x52, 0x87, 0x02, 0xf9, 0x89, 0x1b, 0x18, 0x45, 0x93, 0xe0, 0xde, 0x3e, 0xb0, 0xad, 0x23, 0x94, 0x00 }) // string indices must be integers, not %s
+TRANSLATION("f-string: single '}' is not allowed", 36, { 0xdf, 0xe1, 0x12, 0xe8, 0xbc, 0x7d, 0xc2, 0x11, 0x78, 0xb1, 0x8d, 0x3f, 0xce, 0x81, 0x20, 0x2b, 0x48, 0x2b, 0x59, 0xbb, 0x9d, 0x40 }) // f-string: single \'}\' is not allowed
+TRANSLATION("incorrect padding", 18, { 0x45, 0xa3, 0x3b, 0x9d, 0x24, 0x60, 0xab, 0x54, 0x5e, 0x00 }) // incorrect padding
+TRANSLATION("Corrupt raw code", 17, { 0xfc, 0x59, 0xdf, 0x38, 0x90, 0xe5, 0xdc, 0x51, 0xaa, 0x60 }) // Corrupt raw code
+TRANSLATION("must raise an object", 21, { 0xbe, 0x62, 0x43, 0x92, 0x41, 0x82, 0x50, 0xdb, 0x7a, 0x9d, 0x24 }) // must raise an object
+TRANSLATION("return annotation must be an identifier", 40, { 0x73, 0x9c, 0xba, 0x82, 0x55, 0x69, 0x29, 0x46, 0x51, 0x7c, 0xc4, 0x8d, 0x8c, 0x12, 0x84, 0xa9, 0xac, 0xa6, 0xe8, 0x6e }) // return annotation must be an identifier
+TRANSLATION("Traceback (most recent call last):\n", 37, { 0xfd, 0x1c, 0xa8, 0x7b, 0x15, 0x3d, 0x87, 0xba, 0xed, 0x12, 0x1c, 0xe8, 0x6b, 0x22, 0x85, 0x6b, 0x0b, 0x14, 0x4f, 0xbf, 0xee, 0xff, 0x5f, 0xf4 }) // Traceback (most recent call last):\r\n
+TRANSLATION("'%s' object does not support item assignment", 45, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x8a, 0xb1, 0xc0, 0x56, 0x91, 0x19, 0xc6, 0x19, 0xe4, 0x24, 0x9d, 0xc1, 0x44, 0x27, 0x0b, 0x73, 0x59 }) // \'%s\' object does not support item assignment
+TRANSLATION("'return' outside function", 26, { 0xd1, 0xce, 0x72, 0xeb, 0xa0, 0x6c, 0xcc, 0x25, 0x4c, 0x6f, 0x95, 0xa4, 0xa3, 0x28 }) // \'return\' outside function
+TRANSLATION("object is not subscriptable", 28, { 0x6d, 0xbd, 0x4e, 0x92, 0x12, 0x02, 0xb4, 0x88, 0xce, 0xd1, 0x47, 0x4c, 0x49, 0x6d, 0x63 }) // object is not subscriptable
+TRANSLATION("dict update sequence has wrong length", 38, { 0xaa, 0x52, 0x46, 0x71, 0x52, 0x93, 0x10, 0x7d, 0x72, 0x6b, 0x43, 0x1d, 0x0a, 0x07, 0x77, 0x65, 0xe0, 0x58, 0xd7, 0x89, 0xe8 }) // dict update sequence has wrong length
+TRANSLATION("module not found", 17, { 0xbb, 0x57, 0x36, 0x30, 0xad, 0x23, 0x76, 0xca, 0xd4 }) // module not found
+TRANSLATION("Read-only filesystem", 21, { 0xfc, 0xcc, 0xab, 0xf0, 0x65, 0xb7, 0x91, 0xba, 0x58, 0xe3, 0xcc, 0x49, 0xdc }) // Read-only filesystem
+TRANSLATION("invalid arch", 13, { 0x45, 0xec, 0x56, 0x4a, 0x82, 0x7a, 0x74 }) // invalid arch
+TRANSLATION("can't convert to float", 23, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x44, 0xb0, 0xde, 0xcc, 0x52 }) // can\'t convert to float
+TRANSLATION("type is not an acceptable base type", 36, { 0x9f, 0x38, 0x30, 0x90, 0x15, 0xa4, 0x12, 0x82, 0xa5, 0x0f, 0x12, 0x5b, 0x58, 0xc6, 0xc5, 0x06, 0x27, 0xce, 0x0c }) // type is not an acceptable base type
+TRANSLATION("join expects a list of str/bytes objects consistent with self object", 69, { 0xf5, 0x64, 0x50, 0x7e, 0x30, 0x74, 0x98, 0x04, 0x2c, 0x91, 0x21, 0xb7, 0x11, 0x2f, 0xf6, 0x6d, 0xe6, 0x4e, 0x03, 0x6d, 0xea, 0x74, 0x98, 0x14, 0x65, 0x84, 0x89, 0x35, 0x91, 0xdd, 0x27, 0xa0, 0x83, 0xb6, 0xe1, 0xb6, 0xf5, 0x3a, 0x48 }) // join expects a list of str/bytes objects consistent with self object
+TRANSLATION("multiple bases have instance lay-out conflict", 46, { 0xbe, 0x6d, 0x29, 0x8b, 0x18, 0xd8, 0xa0, 0xe0, 0x74, 0x2e, 0xc6, 0x11, 0x62, 0x49, 0x68, 0x62, 0xc5, 0xe7, 0xe0, 0xd9, 0x91, 0x46, 0x5d, 0xec, 0x94, 0x90 }) // multiple bases have instance lay-out conflict
+TRANSLATION("buffer too small", 17, { 0xdb, 0x3b, 0xee, 0x6e, 0x25, 0x98, 0x45, 0xca, 0xd6 }) // buffer too small
+TRANSLATION("wrong number of arguments", 26, { 0xee, 0xec, 0xbc, 0x05, 0xcd, 0xf6, 0x37, 0x0d, 0xb8, 0x27, 0xe3, 0x37, 0x35, 0x98 }) // wrong number of arguments
+TRANSLATION("non-default argument follows default argument", 46, { 0x56, 0x5f, 0x85, 0x4f, 0x72, 0xcd, 0xa4, 0x13, 0xf1, 0x9b, 0x9a, 0xc8, 0xdd, 0xad, 0x66, 0xef, 0x02, 0xa7, 0xb9, 0x66, 0xd2, 0x09, 0xf8, 0xcd, 0xcd, 0x64 }) // non-default argument follows default argument
+TRANSLATION("parameter annotation must be an identifier", 43, { 0xc1, 0x39, 0x5c, 0xe4, 0xdc, 0x12, 0xab, 0x49, 0x4a, 0x32, 0x8b, 0xe6, 0x24, 0x6c, 0x60, 0x94, 0x25, 0x4d, 0x65, 0x37, 0x43, 0x70 }) // parameter annotation must be an identifier
+TRANSLATION("can't load from '%q'", 21, { 0xa1, 0x2e, 0x92, 0x2c, 0xc5, 0x51, 0xbb, 0xb5, 0xc6, 0x9c, 0xba, 0xe8 }) // can\'t load from \'%q\'
+TRANSLATION("start/end indices", 18, { 0x89, 0x27, 0x9f, 0xb0, 0xd6, 0xa1, 0x16, 0xa9, 0x43, 0x80 }) // start/end indices
+TRANSLATION("slice step cannot be zero", 26, { 0x8b, 0x25, 0x0c, 0x44, 0x9e, 0x05, 0x09, 0x55, 0xa4, 0x6c, 0x63, 0xfc, 0x1b, 0xb0 }) // slice step cannot be zero
+TRANSLATION("function missing keyword-only argument", 39, { 0xdf, 0x2b, 0x49, 0x46, 0x51, 0x74, 0x88, 0x45, 0xe0, 0x7b, 0x1f, 0x9e, 0xec, 0xf5, 0xf8, 0x32, 0xdb, 0xc8, 0x27, 0xe3, 0x37, 0x35, 0x90 }) // function missing keyword-only argument
+TRANSLATION("identifier redefined as nonlocal", 33, { 0x4a, 0x9a, 0xca, 0x6e, 0x86, 0xe1, 0xce, 0xa7, 0xba, 0x29, 0xd4, 0x14, 0x05, 0x65, 0xb3, 0x50, 0xac }) // identifier redefined as nonlocal
+TRANSLATION("generator already executing", 28, { 0xe0, 0xd4, 0xdc, 0xa5, 0x9c, 0x15, 0x9c, 0xca, 0xbe, 0x41, 0xf8, 0x3a, 0x66, 0x51, 0x78 }) // generator already executing
+TRANSLATION("raw f-strings are not implemented", 34, { 0x72, 0xee, 0x37, 0xf8, 0x44, 0xba, 0x2f, 0x10, 0x09, 0xcc, 0x2b, 0x48, 0x4b, 0xe2, 0xc7, 0x73, 0x59, 0x3a, 0x80 }) // raw f-strings are not implemented
+TRANSLATION("name '%q' is not defined", 25, { 0x52, 0xb9, 0x8d, 0x39, 0x75, 0xd0, 0x24, 0x05, 0x69, 0x15, 0x3d, 0xd1, 0x4e, 0xa0 }) // name \'%q\' is not defined
+TRANSLATION("extra positional arguments given", 33, { 0x3f, 0x12, 0xe4, 0x30, 0xd0, 0x92, 0x8c, 0xa5, 0x60, 0x4f, 0xc6, 0x6e, 0x6b, 0x30, 0x38, 0x4e, 0xc6, 0xa0 }) // extra positional arguments given
+TRANSLATION("object not in sequence", 23, { 0x6d, 0xbd, 0x4e, 0x92, 0x15, 0xa4, 0x22, 0x88, 0x3e, 0xb9, 0x35, 0xa1, 0x80 }) // object not in sequence
+TRANSLATION("'%s' object has no attribute '%q'", 34, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x8e, 0x85, 0x01, 0x58, 0x14, 0xcb, 0xa6, 0xd9, 0x93, 0x1a, 0x72, 0xeb, 0xa0 }) // \'%s\' object has no attribute \'%q\'
+TRANSLATION("%%c requires int or char", 25, { 0xe5, 0xca, 0x81, 0xcf, 0xae, 0x51, 0xce, 0x02, 0x2c, 0x86, 0x71, 0x4e, 0x84, 0xe0 }) // %%c requires int or char
+TRANSLATION("function expected at most %d arguments, got %d", 47, { 0xdf, 0x2b, 0x49, 0x46, 0x50, 0x7e, 0x30, 0x74, 0x93, 0xa8, 0x29, 0x17, 0x68, 0x91, 0xca, 0xa0, 0x9f, 0x8c, 0xdc, 0xd6, 0x63, 0xeb, 0x1c, 0x34, 0x8e, 0x55 }) // function expected at most %d arguments, got %d
+TRANSLATION("can't convert '%q' object to %q implicitly", 43, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x46, 0x9c, 0xba, 0xe8, 0x1b, 0x6f, 0x53, 0xa4, 0x89, 0x61, 0xcb, 0xa8, 0x4b, 0xe2, 0xc9, 0x44, 0x9b, 0x79 }) // can\'t convert \'%q\' object to %q implicitly
+TRANSLATION("cannot create instance", 23, { 0xa1, 0x2a, 0xb4, 0x8a, 0x39, 0x94, 0x98, 0x45, 0x89, 0x25, 0xa1, 0x80 }) // cannot create instance
+TRANSLATION("object not an iterator", 23, { 0x6d, 0xbd, 0x4e, 0x92, 0x15, 0xa4, 0x12, 0x84, 0x93, 0x72, 0x96, 0x70 }) // object not an iterator
+TRANSLATION("sign not allowed with integer format specifier 'c'", 51, { 0x84, 0xe1, 0x42, 0xb4, 0x82, 0xb5, 0x9b, 0xb9, 0xd4, 0x77, 0x49, 0xe8, 0x11, 0x64, 0xf8, 0x37, 0x1b, 0xb3, 0xdc, 0xa4, 0x46, 0x0e, 0x89, 0xba, 0x1b, 0x8d, 0x29, 0xa0 }) // sign not allowed with integer format specifier \'c\'
+TRANSLATION("unsupported type for operator", 30, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3a, 0x89, 0xf3, 0x83, 0x1b, 0xb3, 0x86, 0xc1, 0xb9, 0x4b, 0x38 }) // unsupported type for operator
+TRANSLATION("can't convert %s to int", 24, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x47, 0x28, 0x12, 0xc1, 0x16, 0x40 }) // can\'t convert %s to int
+TRANSLATION("bad conversion specifier", 25, { 0xd8, 0xaa, 0x28, 0xcb, 0xd8, 0xde, 0x11, 0x94, 0x46, 0x0e, 0x89, 0xba, 0x1b, 0x80 }) // bad conversion specifier
+TRANSLATION("memory allocation failed, heap is locked", 41, { 0xb9, 0xdd, 0x9f, 0xc8, 0x2b, 0x59, 0xa8, 0x52, 0x8c, 0xa3, 0x72, 0x4b, 0x1d, 0x7e, 0xb1, 0xd0, 0xcb, 0x01, 0x20, 0x59, 0xa9, 0xec, 0x75 }) // memory allocation failed, heap is locked
+TRANSLATION("non-hex digit found", 20, { 0x56, 0x5f, 0x87, 0x43, 0xf0, 0x2a, 0x9c, 0x24, 0x8d, 0xdb, 0x2b, 0x50 }) // non-hex digit found
+TRANSLATION("ord() expected a character, but string of length %d found", 58, { 0x67, 0xaf, 0xbb, 0xde, 0x0f, 0xc6, 0x0e, 0x92, 0x75, 0x04, 0x29, 0xd0, 0x9c, 0xa9, 0x26, 0xff, 0x58, 0xdb, 0x32, 0x22, 0x5d, 0x17, 0x80, 0xdb, 0x8b, 0x1a, 0xf1, 0x3d, 0x07, 0x2a, 0x8d, 0xdb, 0x2b, 0x50 }) // ord() expected a character, but string of length %d found
+TRANSLATION("indices must be integers", 25, { 0x45, 0xaa, 0x50, 0xe0, 0x5f, 0x31, 0x23, 0x63, 0x08, 0xb2, 0x7c, 0x1b, 0xc0 }) // indices must be integers
+TRANSLATION("%q index out of range", 22, { 0xe5, 0xd4, 0x22, 0xd4, 0xfc, 0x06, 0xcc, 0x86, 0xdc, 0x39, 0x2f, 0x06 }) // %q index out of range
+TRANSLATION("%q indices must be integers, not %s", 36, { 0xe5, 0xd4, 0x22, 0xd5, 0x28, 0x70, 0x2f, 0x98, 0x91, 0xb1, 0x84, 0x59, 0x3e, 0x0d, 0xe3, 0xeb, 0x0a, 0xd2, 0x39, 0x40 }) // %q indices must be integers, not %s
+TRANSLATION("'yield' outside function", 25, { 0xd3, 0xca, 0x1d, 0xab, 0xa0, 0x6c, 0xcc, 0x25, 0x4c, 0x6f, 0x95, 0xa4, 0xa3, 0x28 }) // \'yield\' outside function
+TRANSLATION("__new__ arg must be a user-type", 32, { 0xd7, 0x55, 0x3e, 0xfa, 0xea, 0x09, 0xf8, 0x17, 0xcc, 0x48, 0xd8, 0xc1, 0x0c, 0xc1, 0xbf, 0xc2, 0x7c, 0xe0, 0xc0 }) // __new__ arg must be a user-type
+TRANSLATION("*x must be assignment target", 29, { 0xfa, 0xbc, 0x0b, 0xe6, 0x24, 0x6c, 0x60, 0xa2, 0x13, 0x85, 0xb9, 0xac, 0x89, 0x27, 0xe0, 0xe4 }) // *x must be assignment target
+TRANSLATION("abort() called", 15, { 0x2d, 0x99, 0xe7, 0xdd, 0xef, 0x14, 0x2b, 0x58, 0xea }) // abort() called
+TRANSLATION("index out of range", 19, { 0x45, 0xa9, 0xf8, 0x0d, 0x99, 0x0d, 0xb8, 0x72, 0x5e, 0x0c }) // index out of range
+TRANSLATION("single '}' encountered in format string", 40, { 0x84, 0x5e, 0x2c, 0x63, 0x4f, 0xf3, 0xa0, 0x35, 0xa3, 0x65, 0x64, 0xdc, 0xea, 0x11, 0x46, 0xec, 0xf7, 0x29, 0x11, 0x2e, 0x8b, 0xc0 }) // single \'}\' encountered in format string
+TRANSLATION("can't pend throw to just-started generator", 43, { 0xa1, 0x2e, 0x92, 0x30, 0x6b, 0x51, 0x3d, 0x1d, 0xbb, 0x89, 0x61, 0xeb, 0x98, 0x9f, 0x84, 0x49, 0x3c, 0x9d, 0x47, 0x06, 0xa6, 0xe5, 0x2c, 0xe0 }) // can\'t pend throw to just-started generator
+TRANSLATION("expected tuple/list", 20, { 0x3f, 0x18, 0x3a, 0x49, 0xd4, 0x4e, 0x71, 0x63, 0xfb, 0x2c, 0x91, 0x20 }) // expected tuple/list
+TRANSLATION("unary op %q not implemented", 28, { 0xca, 0x93, 0xf9, 0x0d, 0x81, 0xcb, 0xa8, 0x56, 0x90, 0x97, 0xc5, 0x8e, 0xe6, 0xb2, 0x75 }) // unary op %q not implemented
+TRANSLATION("no such attribute", 18, { 0x56, 0x11, 0x9a, 0x74, 0x05, 0x32, 0xe9, 0xb6, 0x64, 0xc0 }) // no such attribute
+TRANSLATION("wrong number of values to unpack", 33, { 0xee, 0xec, 0xbc, 0x05, 0xcd, 0xf6, 0x37, 0x0d, 0xb8, 0xec, 0x56, 0xc9, 0xc0, 0x96, 0x19, 0x5c, 0x15, 0x3d, 0x80 }) // wrong number of values to unpack
+TRANSLATION("extra keyword arguments given", 30, { 0x3f, 0x12, 0xe4, 0x3d, 0x8f, 0xcf, 0x76, 0x7a, 0x82, 0x7e, 0x33, 0x73, 0x59, 0x81, 0xc2, 0x76, 0x35 }) // extra keyword arguments given
+TRANSLATION("Call super().__init__() before accessing native object.", 56, { 0xfc, 0x4a, 0xd6, 0x11, 0x9c, 0x1b, 0xfb, 0xbd, 0xff, 0xef, 0xae, 0xa8, 0xa9, 0x3a, 0xeb, 0xee, 0xf7, 0x8d, 0x8f, 0x76, 0x73, 0x05, 0x4a, 0x1c, 0x42, 0x2f, 0x01, 0x4a, 0x53, 0xb1, 0x86, 0xdb, 0xd4, 0xe9, 0x3f, 0xee }) // Call super().__init__() before accessing native object.
+TRANSLATION("can't convert %s to float", 26, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x47, 0x28, 0x12, 0xc3, 0x7b, 0x31, 0x48 }) // can\'t convert %s to float
+TRANSLATION("unexpected indent", 18, { 0xca, 0x9f, 0x8c, 0x1d, 0x24, 0xea, 0x11, 0x6a, 0x6b, 0x20 }) // unexpected indent
+TRANSLATION("pop from an empty set", 22, { 0xc3, 0x60, 0x6e, 0xed, 0x70, 0x4a, 0x0e, 0xf8, 0x9f, 0x22, 0x0e, 0x40 }) // pop from an empty set
+TRANSLATION("'%q' argument required", 23, { 0xd3, 0x97, 0x5d, 0x01, 0x3f, 0x19, 0xb9, 0xac, 0x87, 0x3e, 0xb9, 0x47, 0x3a, 0x80 }) // \'%q\' argument required
+TRANSLATION("unicode name escapes", 21, { 0xca, 0xa5, 0x1a, 0xa6, 0x14, 0xae, 0x60, 0xe2, 0x85, 0x83, 0x80 }) // unicode name escapes
+TRANSLATION("small int overflow", 19, { 0x8b, 0x95, 0xac, 0x11, 0x64, 0x37, 0x63, 0x7d, 0xec, 0xdd, 0xc0 }) // small int overflow
+TRANSLATION("'await' outside function", 25, { 0xd0, 0xbb, 0x92, 0x4e, 0x81, 0xb3, 0x30, 0x95, 0x31, 0xbe, 0x56, 0x92, 0x8c, 0xa0 }) // \'await\' outside function
+TRANSLATION("can't store with '%q' index", 28, { 0xa1, 0x2e, 0x92, 0x22, 0x59, 0xcc, 0x77, 0x49, 0xe8, 0x34, 0xe5, 0xd7, 0x40, 0x8b, 0x53, 0xf0 }) // can\'t store with \'%q\' index
+TRANSLATION("can't have multiple **x", 24, { 0xa1, 0x2e, 0x92, 0x3a, 0x17, 0x63, 0x17, 0xcd, 0xa5, 0x31, 0x63, 0x1f, 0x57, 0xd5, 0xe0 }) // can\'t have multiple **x
+TRANSLATION("argument should be a '%q' not a '%q'", 37, { 0x27, 0xe3, 0x37, 0x35, 0x91, 0x1d, 0x1b, 0x36, 0xa8, 0xd8, 0xc1, 0x0d, 0x39, 0x75, 0xd0, 0x2b, 0x48, 0x21, 0xa7, 0x2e, 0xba, 0x00 }) // argument should be a \'%q\' not a \'%q\'
+TRANSLATION("bad typecode", 13, { 0xd8, 0xaa, 0x27, 0xce, 0x0e, 0x8d, 0x53 }) // bad typecode
+TRANSLATION("exceptions must derive from BaseException", 42, { 0x3f, 0x14, 0x3c, 0x4a, 0x32, 0xc0, 0xbe, 0x62, 0x45, 0x4d, 0xd3, 0xb1, 0x8d, 0xdd, 0xae, 0x3f, 0x89, 0x41, 0xf3, 0xf1, 0x43, 0xc4, 0xa3, 0x28 }) // exceptions must derive from BaseException
+TRANSLATION("Invalid argument", 17, { 0xf9, 0x2f, 0x62, 0xb2, 0x54, 0x13, 0xf1, 0x9b, 0x9a, 0xc8 }) // Invalid argument
+TRANSLATION("local '%q' used before type known", 34, { 0xb3, 0x50, 0xac, 0x34, 0xe5, 0xd7, 0x41, 0x98, 0x3a, 0x8d, 0x8f, 0x76, 0x73, 0x13, 0xe7, 0x06, 0x3d, 0x95, 0xbb, 0xa8 }) // local \'%q\' used before type known
+TRANSLATION("invalid micropython decorator", 30, { 0x45, 0xec, 0x56, 0x4a, 0x8b, 0xa5, 0x1d, 0xb1, 0xe6, 0x7a, 0x32, 0x8a, 0x9d, 0x19, 0xca, 0x59, 0xc0 }) // invalid micropython decorator
+TRANSLATION("constant must be an integer", 28, { 0xa3, 0x2c, 0x49, 0x2c, 0x8b, 0xe6, 0x24, 0x6c, 0x60, 0x94, 0x22, 0xc9, 0xf0, 0x6e }) // constant must be an integer
+TRANSLATION("no active exception to reraise", 31, { 0x56, 0x05, 0x49, 0x4e, 0xc6, 0x0f, 0xc5, 0x0f, 0x12, 0x8c, 0xa2, 0x58, 0x39, 0xb9, 0x24, 0x18 }) // no active exception to reraise
+TRANSLATION("Name too long", 14, { 0xf4, 0x2b, 0x98, 0x96, 0x61, 0x66, 0x5e, 0x00 }) // Name too long
+TRANSLATION("can't add special method to already-subclassed class", 53, { 0xa1, 0x2e, 0x92, 0x0a, 0xb5, 0x11, 0x83, 0xa2, 0x15, 0x85, 0xce, 0x7a, 0x35, 0x44, 0xb0, 0x2b, 0x39, 0x95, 0x7c, 0xfc, 0x23, 0x3b, 0x52, 0xc5, 0x10, 0x75, 0x14, 0xb1, 0x44, 0x00 }) // can\'t add special method to already-subclassed class
+TRANSLATION("function missing required keyword argument '%q'", 48, { 0xdf, 0x2b, 0x49, 0x46, 0x51, 0x74, 0x88, 0x45, 0xe0, 0x39, 0xf5, 0xca, 0x39, 0xd4, 0x7b, 0x1f, 0x9e, 0xec, 0xf5, 0x04, 0xfc, 0x66, 0xe6, 0xb2, 0x34, 0xe5, 0xd7, 0x40 }) // function missing required keyword argument \'%q\'
+TRANSLATION("invalid syntax", 15, { 0x45, 0xec, 0x56, 0x4a, 0x88, 0xf2, 0xb2, 0x5e, 0x00 }) // invalid syntax
+TRANSLATION("incomplete format key", 22, { 0x45, 0xa3, 0x5f, 0x16, 0x39, 0x31, 0xbb, 0x3d, 0xca, 0x47, 0xb1, 0xf9 }) // incomplete format key
+TRANSLATION("No such file/directory", 23, { 0xf4, 0x61, 0x19, 0xa7, 0x41, 0xba, 0x58, 0xfe, 0xca, 0xa3, 0x9d, 0x25, 0x9f, 0xc8 }) // No such file/directory
+TRANSLATION("odd-length string", 18, { 0x6a, 0xd7, 0xe1, 0x63, 0x5e, 0x27, 0xa0, 0x89, 0x74, 0x5e, 0x00 }) // odd-length string
+TRANSLATION("string not supported; use bytes or bytearray", 45, { 0x89, 0x74, 0x5e, 0x02, 0xb4, 0x88, 0xce, 0x30, 0xcf, 0x27, 0x5f, 0xfe, 0x8c, 0xc1, 0x8d, 0xbc, 0xc9, 0xc0, 0x67, 0x1b, 0x79, 0x93, 0x27, 0x72, 0xf2 }) // string not supported; use bytes or bytearray
+TRANSLATION("Unsupported operation", 22, { 0xfd, 0x56, 0x33, 0x8c, 0x33, 0xc9, 0xd4, 0x36, 0x0d, 0xca, 0x51, 0x94 }) // Unsupported operation
+TRANSLATION("not enough arguments for format string", 39, { 0x56, 0x90, 0x6a, 0xd9, 0xe3, 0xa0, 0x27, 0xe3, 0x37, 0x35, 0x98, 0x1b, 0xb3, 0x8d, 0xd9, 0xee, 0x52, 0x22, 0x5d, 0x17, 0x80 }) // not enough arguments for format string
+TRANSLATION("local variable referenced before assignment", 44, { 0xb3, 0x50, 0xac, 0x3b, 0x13, 0xa1, 0x6d, 0x63, 0x0e, 0x7b, 0x9b, 0x9a, 0xd0, 0xea, 0x36, 0x3d, 0xd9, 0xcc, 0x14, 0x42, 0x70, 0xb7, 0x35, 0x90 }) // local variable referenced before assignment
+TRANSLATION("type takes 1 or 3 arguments", 28, { 0x9f, 0x38, 0x31, 0x25, 0xec, 0x70, 0x3f, 0x68, 0x67, 0x1f, 0xbc, 0x13, 0xf1, 0x9b, 0x9a, 0xcc, 0x00 }) // type takes 1 or 3 arguments
+TRANSLATION("return expected '%q' but got '%q'", 34, { 0x73, 0x9c, 0xba, 0x83, 0xf1, 0x83, 0xa4, 0x9d, 0x46, 0x9c, 0xba, 0xe8, 0x36, 0xcc, 0x8e, 0x1a, 0x46, 0x9c, 0xba, 0xe8 }) // return expected \'%q\' but got \'%q\'
+TRANSLATION("can't convert %s to complex", 28, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x47, 0x28, 0x12, 0xc2, 0x8d, 0x7c, 0x58, 0xfc, 0x00 }) // can\'t convert %s to complex
+TRANSLATION("expecting key:value for dict", 29, { 0x3f, 0x18, 0x3a, 0x4a, 0x2f, 0x03, 0xd8, 0xfc, 0xfd, 0xdd, 0x8a, 0xd9, 0x31, 0xbb, 0x38, 0xaa, 0x52, 0x40 }) // expecting key:value for dict
+TRANSLATION("can't declare nonlocal in outer code", 37, { 0xa1, 0x2e, 0x92, 0x2a, 0x74, 0xb1, 0x39, 0x85, 0x65, 0xb3, 0x50, 0xac, 0x11, 0x43, 0x66, 0x4d, 0xc5, 0x1a, 0xa6 }) // can\'t declare nonlocal in outer code
+TRANSLATION("cannot import name %q", 22, { 0xa1, 0x2a, 0xb4, 0x84, 0xbe, 0x19, 0xe4, 0x29, 0x5c, 0xc7, 0x2e, 0xa0 }) // cannot import name %q
+TRANSLATION("non-keyword arg after keyword arg", 34, { 0x56, 0x5f, 0x87, 0xb1, 0xf9, 0xee, 0xcf, 0x50, 0x4f, 0xc0, 0x2d, 0xe4, 0xdc, 0x7b, 0x1f, 0x9e, 0xec, 0xf5, 0x04, 0xfc, 0x00 }) // non-keyword arg after keyword arg
+TRANSLATION("can't load with '%q' index", 27, { 0xa1, 0x2e, 0x92, 0x2c, 0xc5, 0x51, 0xdd, 0x27, 0xa0, 0xd3, 0x97, 0x5d, 0x02, 0x2d, 0x4f, 0xc0 }) // can\'t load with \'%q\' index
+TRANSLATION("'break' outside loop", 21, { 0xd3, 0x67, 0x32, 0xf6, 0xd0, 0x36, 0x66, 0x12, 0xa6, 0x2c, 0xcd, 0x80 }) // \'break\' outside loop
+TRANSLATION("function does not take keyword arguments", 41, { 0xdf, 0x2b, 0x49, 0x46, 0x51, 0x56, 0x38, 0x0a, 0xd2, 0x24, 0xbd, 0x8c, 0x7b, 0x1f, 0x9e, 0xec, 0xf5, 0x04, 0xfc, 0x66, 0xe6, 0xb3, 0x00 }) // function does not take keyword arguments
+TRANSLATION("'%s' object is not subscriptable", 33, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x84, 0x80, 0xad, 0x22, 0x33, 0xb4, 0x51, 0xd3, 0x12, 0x5b, 0x58, 0xc0 }) // \'%s\' object is not subscriptable
+TRANSLATION("function takes %d positional arguments but %d were given", 57, { 0xdf, 0x2b, 0x49, 0x46, 0x51, 0x25, 0xec, 0x70, 0x39, 0x54, 0x61, 0xa1, 0x25, 0x19, 0x4a, 0xc0, 0x9f, 0x8c, 0xdc, 0xd6, 0x60, 0x6d, 0x99, 0x1c, 0xaa, 0x3b, 0x9b, 0x98, 0xe1, 0x3b, 0x1a, 0x80 }) // function takes %d positional arguments but %d were given
+TRANSLATION("no module named '%q'", 21, { 0x56, 0x17, 0x6a, 0xe6, 0xc6, 0x14, 0xae, 0x75, 0x1a, 0x72, 0xeb, 0xa0 }) // no module named \'%q\'
+TRANSLATION("function missing %d required positional arguments", 50, { 0xdf, 0x2b, 0x49, 0x46, 0x51, 0x74, 0x88, 0x45, 0xe0, 0x72, 0xa8, 0x73, 0xeb, 0x94, 0x73, 0xa8, 0xc3, 0x42, 0x4a, 0x32, 0x95, 0x81, 0x3f, 0x19, 0xb9, 0xac, 0xc0 }) // function missing %d required positional arguments
+TRANSLATION("multiple *x in assignment", 26, { 0xbe, 0x6d, 0x29, 0x8b, 0x18, 0xfa, 0xbc, 0x04, 0x50, 0x51, 0x09, 0xc2, 0xdc, 0xd6, 0x40 }) // multiple *x in assignment
+TRANSLATION("negative shift count", 21, { 0x53, 0xe0, 0xa5, 0x3b, 0x18, 0x8e, 0x89, 0xbc, 0x8a, 0x36, 0x56, 0x40 }) // negative shift count
+TRANSLATION("unreadable attribute", 21, { 0xca, 0xb9, 0x95, 0x4b, 0x6b, 0x18, 0x29, 0x97, 0x4d, 0xb3, 0x26 }) // unreadable attribute
+TRANSLATION("'continue' outside loop", 24, { 0xd2, 0x8c, 0xb2, 0x8b, 0x93, 0xd0, 0x36, 0x66, 0x12, 0xa6, 0x2c, 0xcd, 0x80 }) // \'continue\' outside loop
+TRANSLATION(", in %q\n", 10, { 0xfa, 0xc2, 0x28, 0xe5, 0xd7, 0xfd, 0x7f, 0xd0 }) // , in %q\r\n
+TRANSLATION("a bytes-like object is required", 32, { 0x21, 0xb7, 0x99, 0x38, 0xf8, 0x59, 0x3d, 0x8c, 0x36, 0xde, 0xa7, 0x49, 0x09, 0x01, 0xcf, 0xae, 0x51, 0xce, 0xa0 }) // a bytes-like object is required
+TRANSLATION("f-string: expecting '}'", 24, { 0xdf, 0xe1, 0x12, 0xe8, 0xbc, 0x7d, 0xc0, 0xfc, 0x60, 0xe9, 0x28, 0xbc, 0x0d, 0x3f, 0xce, 0x80 }) // f-string: expecting \'}\'
+TRANSLATION("need more than %d values to unpack", 35, { 0x53, 0x3a, 0x8b, 0xb3, 0x98, 0x9e, 0x84, 0xa3, 0x95, 0x47, 0x62, 0xb6, 0x4e, 0x04, 0xb0, 0xca, 0xe0, 0xa9, 0xec }) // need more than %d values to unpack
+TRANSLATION("incomplete format", 18, { 0x45, 0xa3, 0x5f, 0x16, 0x39, 0x31, 0xbb, 0x3d, 0xca, 0x40 }) // incomplete format
+TRANSLATION("'%s' object does not support '%q'", 34, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x8a, 0xb1, 0xc0, 0x56, 0x91, 0x19, 0xc6, 0x19, 0xe4, 0x69, 0xcb, 0xae, 0x80 }) // \'%s\' object does not support \'%q\'
+TRANSLATION("casting", 8, { 0xa1, 0x44, 0xa2, 0xf0 }) // casting
+TRANSLATION("0.0 to a complex power", 23, { 0xfb, 0x7f, 0xdf, 0xed, 0x12, 0xc0, 0x85, 0x1a, 0xf8, 0xb1, 0xf8, 0x18, 0x6e, 0xe6, 0xe0 }) // 0.0 to a complex power
+TRANSLATION("f-string expression part cannot include a backslash", 52, { 0xdf, 0xe1, 0x12, 0xe8, 0xbc, 0x03, 0xf1, 0x87, 0x38, 0x84, 0x65, 0x18, 0x27, 0x91, 0x42, 0x55, 0x69, 0x08, 0xb4, 0xb6, 0x6a, 0x60, 0x86, 0xc5, 0x4f, 0x68, 0xb1, 0x47, 0x40 }) // f-string expression part cannot include a backslash
+TRANSLATION("can't convert to complex", 25, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x44, 0xb0, 0xa3, 0x5f, 0x16, 0x3f, 0x00 }) // can\'t convert to complex
+TRANSLATION("stream operation not supported", 31, { 0x89, 0x73, 0x2b, 0x86, 0xc1, 0xb9, 0x4a, 0x32, 0x85, 0x69, 0x11, 0x9c, 0x61, 0x9e, 0x4e, 0xa0 }) // stream operation not supported
+TRANSLATION("unknown format code '%c' for object of type '%s'", 49, { 0xca, 0xfb, 0x2b, 0x77, 0x51, 0xbb, 0x3d, 0xca, 0x45, 0x1a, 0xa6, 0x34, 0xe5, 0x4d, 0x06, 0xec, 0xe1, 0xb6, 0xf5, 0x3a, 0x48, 0x6d, 0xc4, 0xf9, 0xc1, 0x8d, 0x39, 0x46, 0x80 }) // unknown format code \'%c\' for object of type \'%s\'
+TRANSLATION("function got multiple values for argument '%q'", 47, { 0xdf, 0x2b, 0x49, 0x46, 0x51, 0xc3, 0x48, 0xbe, 0x6d, 0x29, 0x8b, 0x18, 0xec, 0x56, 0xc9, 0xc0, 0xdd, 0x9c, 0x13, 0xf1, 0x9b, 0x9a, 0xc8, 0xd3, 0x97, 0x5d, 0x00 }) // function got multiple values for argument \'%q\'
+TRANSLATION("LHS of keyword arg must be an id", 33, { 0xfe, 0x9f, 0xf5, 0xf4, 0x0d, 0xb8, 0xf6, 0x3f, 0x3d, 0xd9, 0xea, 0x09, 0xf8, 0x17, 0xcc, 0x48, 0xd8, 0xc1, 0x28, 0x4a, 0x80 }) // LHS of keyword arg must be an id
+TRANSLATION("Viper functions don't currently support more than 4 arguments", 62, { 0xfe, 0xe9, 0x83, 0x71, 0xbe, 0x56, 0x92, 0x8c, 0xb0, 0x2a, 0xcb, 0xa4, 0x8a, 0x65, 0xdc, 0xd6, 0x6d, 0xe4, 0x46, 0x71, 0x86, 0x79, 0x17, 0x67, 0x31, 0x3d, 0x09, 0x47, 0xff, 0x01, 0x3f, 0x19, 0xb9, 0xac, 0xc0 }) // Viper functions don\'t currently support more than 4 arguments
+TRANSLATION("__init__() should return None, not '%s'", 40, { 0xd7, 0x54, 0x54, 0x9d, 0x75, 0xf7, 0x7b, 0xc4, 0x74, 0x6c, 0xda, 0xa1, 0xce, 0x72, 0xea, 0x3d, 0x19, 0x4f, 0xeb, 0x0a, 0xd2, 0x34, 0xe5, 0x1a, 0x00 }) // __init__() should return None, not \'%s\'
+TRANSLATION("can't assign to expression", 27, { 0xa1, 0x2e, 0x92, 0x0a, 0x21, 0x38, 0x51, 0x2c, 0x0f, 0xc6, 0x1c, 0xe2, 0x11, 0x94 }) // can\'t assign to expression
+TRANSLATION("issubclass() arg 2 must be a class or a tuple of classes", 57, { 0x48, 0x8c, 0xed, 0x4b, 0x14, 0x47, 0xbb, 0xde, 0x09, 0xf8, 0x1f, 0xb8, 0x5f, 0x31, 0x23, 0x63, 0x04, 0x29, 0x62, 0x88, 0x0c, 0xe0, 0x84, 0xe7, 0x16, 0x30, 0xdb, 0x8a, 0x58, 0xa2, 0x0e, 0x00 }) // issubclass() arg 2 must be a class or a tuple of classes
+TRANSLATION("object does not support item deletion", 38, { 0x6d, 0xbd, 0x4e, 0x92, 0x2a, 0xc7, 0x01, 0x5a, 0x44, 0x67, 0x18, 0x67, 0x90, 0x92, 0x77, 0x15, 0x3b, 0x1c, 0xa3, 0x28 }) // object does not support item deletion
+TRANSLATION("invalid syntax for integer", 27, { 0x45, 0xec, 0x56, 0x4a, 0x88, 0xf2, 0xb2, 0x5e, 0x06, 0xec, 0xe1, 0x16, 0x4f, 0x83, 0x70 }) // invalid syntax for integer
+TRANSLATION("super() can't find self", 24, { 0x8c, 0xe0, 0xdf, 0xdd, 0xef, 0x14, 0x25, 0xd2, 0x46, 0xe8, 0xb5, 0x10, 0x76, 0xdc }) // super() can\'t find self
+TRANSLATION("empty separator", 16, { 0x3b, 0xe2, 0x7c, 0x88, 0x3c, 0x13, 0x94, 0xb3, 0x80 }) // empty separator
+TRANSLATION("object does not support item assignment", 40, { 0x6d, 0xbd, 0x4e, 0x92, 0x2a, 0xc7, 0x01, 0x5a, 0x44, 0x67, 0x18, 0x67, 0x90, 0x92, 0x77, 0x05, 0x10, 0x9c, 0x2d, 0xcd, 0x64 }) // object does not support item assignment
+TRANSLATION("binary op %q not implemented", 29, { 0xd9, 0x14, 0x9f, 0xc8, 0x6c, 0x0e, 0x5d, 0x42, 0xb4, 0x84, 0xbe, 0x2c, 0x77, 0x35, 0x93, 0xa8 }) // binary op %q not implemented
+TRANSLATION("popitem(): dictionary is empty", 31, { 0xc3, 0x61, 0x24, 0xef, 0xee, 0xf7, 0xfd, 0xc2, 0xa9, 0x49, 0x46, 0x52, 0x7f, 0x21, 0x20, 0x1d, 0xf1, 0x3e, 0x40 }) // popitem(): dictionary is empty
+TRANSLATION("can't delete expression", 24, { 0xa1, 0x2e, 0x92, 0x2a, 0x76, 0x39, 0x30, 0x7e, 0x30, 0xe7, 0x10, 0x8c, 0xa0 }) // can\'t delete expression
+TRANSLATION("not all arguments converted during string formatting", 53, { 0x56, 0x90, 0x56, 0xb0, 0x27, 0xe3, 0x37, 0x35, 0x98, 0x14, 0x65, 0xec, 0x6f, 0x27, 0x51, 0x5c, 0xba, 0x2f, 0x02, 0x25, 0xd1, 0x78, 0x1b, 0xb3, 0xdc, 0xa6, 0x51, 0x78 }) // not all arguments converted during string formatting
+TRANSLATION("type object '%q' has no attribute '%q'", 39, { 0x9f, 0x38, 0x30, 0xdb, 0x7a, 0x9d, 0x24, 0x69, 0xcb, 0xae, 0x83, 0xa1, 0x40, 0x56, 0x05, 0x32, 0xe9, 0xb6, 0x64, 0xc6, 0x9c, 0xba, 0xe8 }) // type object \'%q\' has no attribute \'%q\'
+TRANSLATION("unindent does not match any outer indentation level", 52, { 0xca, 0xa2, 0xd4, 0xd6, 0x45, 0x58, 0xe0, 0x2b, 0x48, 0xb9, 0x4d, 0x3a, 0x02, 0x5f, 0x21, 0xb3, 0x26, 0xe1, 0x16, 0xa6, 0xb2, 0x52, 0x8c, 0xa2, 0xc7, 0xd8, 0xec }) // unindent does not match any outer indentation level
+TRANSLATION("generator ignored GeneratorExit", 32, { 0xe0, 0xd4, 0xdc, 0xa5, 0x9c, 0x27, 0x0a, 0xce, 0x75, 0x1f, 0xcc, 0xd4, 0xdc, 0xa5, 0x9f, 0x9f, 0x84, 0x90 }) // generator ignored GeneratorExit
+TRANSLATION("argument has wrong type", 24, { 0x27, 0xe3, 0x37, 0x35, 0x91, 0xd0, 0xa0, 0x77, 0x76, 0x5e, 0x04, 0xf9, 0xc1, 0x80 }) // argument has wrong type
+TRANSLATION("arg is an empty sequence", 25, { 0x27, 0xe0, 0x24, 0x02, 0x50, 0x77, 0xc4, 0xf9, 0x10, 0x7d, 0x72, 0x6b, 0x43 }) // arg is an empty sequence
+TRANSLATION("pop from empty list", 20, { 0xc3, 0x60, 0x6e, 0xed, 0x70, 0x77, 0xc4, 0xf9, 0x16, 0x48, 0x90 }) // pop from empty list
+TRANSLATION("offset out of bounds", 21, { 0x6d, 0xf7, 0x83, 0x90, 0xd9, 0x90, 0xdb, 0x8d, 0x9b, 0x2b, 0x58 }) // offset out of bounds
+TRANSLATION("can't implicitly convert '%q' to 'bool'", 40, { 0xa1, 0x2e, 0x92, 0x12, 0xf8, 0xb2, 0x51, 0x26, 0xde, 0x45, 0x19, 0x7b, 0x1b, 0xc8, 0xd3, 0x97, 0x5d, 0x04, 0xb0, 0xd3, 0x66, 0x6b, 0x68 }) // can\'t implicitly convert \'%q\' to \'bool\'
+TRANSLATION("function missing required positional argument #%d", 50, { 0xdf, 0x2b, 0x49, 0x46, 0x51, 0x74, 0x88, 0x45, 0xe0, 0x39, 0xf5, 0xca, 0x39, 0xd4, 0x61, 0xa1, 0x25, 0x19, 0x4a, 0xc0, 0x9f, 0x8c, 0xdc, 0xd6, 0x47, 0xec, 0xe5, 0x50 }) // function missing required positional argument #%d
+TRANSLATION("no binding for nonlocal found", 30, { 0x56, 0x1b, 0x22, 0xd5, 0x17, 0x81, 0xbb, 0x38, 0x56, 0x5b, 0x35, 0x0a, 0xc3, 0x76, 0xca, 0xd4 }) // no binding for nonlocal found
+TRANSLATION("expecting just a value for set", 31, { 0x3f, 0x18, 0x3a, 0x4a, 0x2f, 0x03, 0xd7, 0x31, 0x20, 0x87, 0x62, 0xb6, 0x4c, 0x6e, 0xce, 0x20, 0xe4 }) // expecting just a value for set
+TRANSLATION("non-keyword arg after */**", 27, { 0x56, 0x5f, 0x87, 0xb1, 0xf9, 0xee, 0xcf, 0x50, 0x4f, 0xc0, 0x2d, 0xe4, 0xdc, 0x7d, 0x5f, 0x67, 0xd5, 0xf5, 0x00 }) // non-keyword arg after */**
+TRANSLATION("unsupported type for %q: '%s'", 30, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3a, 0x89, 0xf3, 0x83, 0x1b, 0xb3, 0x8e, 0x5d, 0x7e, 0xe1, 0xa7, 0x28, 0xd0 }) // unsupported type for %q: \'%s\'
+TRANSLATION("requested length %d but object has length %d", 45, { 0x73, 0xeb, 0x93, 0x89, 0x3a, 0x8b, 0x1a, 0xf1, 0x3d, 0x07, 0x2a, 0x8d, 0xb3, 0x21, 0xb6, 0xf5, 0x3a, 0x48, 0xe8, 0x50, 0x2c, 0x6b, 0xc4, 0xf4, 0x1c, 0xaa }) // requested length %d but object has length %d
+TRANSLATION("name not defined", 17, { 0x52, 0xb9, 0x85, 0x69, 0x15, 0x3d, 0xd1, 0x4e, 0xa0 }) // name not defined
+TRANSLATION("'%s' object cannot assign attribute '%q'", 41, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x8a, 0x12, 0xab, 0x48, 0x28, 0x84, 0xe1, 0x41, 0x4c, 0xba, 0x6d, 0x99, 0x31, 0xa7, 0x2e, 0xba, 0x00 }) // \'%s\' object cannot assign attribute \'%q\'
+TRANSLATION("cannot perform relative import", 31, { 0xa1, 0x2a, 0xb4, 0x8c, 0x1b, 0xee, 0xcf, 0x70, 0xe7, 0x62, 0x94, 0xec, 0x61, 0x2f, 0x86, 0x79 }) // cannot perform relative import
+TRANSLATION("'%s' object does not support item deletion", 43, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x8a, 0xb1, 0xc0, 0x56, 0x91, 0x19, 0xc6, 0x19, 0xe4, 0x24, 0x9d, 0xc5, 0x4e, 0xc7, 0x28, 0xca }) // \'%s\' object does not support item deletion
+TRANSLATION("can't switch from automatic field numbering to manual field specification", 74, { 0xa1, 0x2e, 0x92, 0x23, 0xba, 0x4d, 0x3a, 0x0d, 0xdd, 0xae, 0x0b, 0x32, 0xd7, 0x29, 0x4a, 0x0d, 0xd0, 0xed, 0x50, 0xb9, 0xbe, 0xc6, 0xe8, 0xbc, 0x09, 0x61, 0x72, 0x5c, 0x95, 0x86, 0xe8, 0x76, 0xa8, 0x8c, 0x1d, 0x13, 0x74, 0xa1, 0x4a, 0x32, 0x80 }) // can\'t switch from automatic field numbering to manual field specification
+TRANSLATION("f-string: empty expression not allowed", 39, { 0xdf, 0xe1, 0x12, 0xe8, 0xbc, 0x7d, 0xc0, 0xef, 0x89, 0xf2, 0x0f, 0xc6, 0x1c, 0xe2, 0x11, 0x94, 0x2b, 0x48, 0x2b, 0x59, 0xbb, 0x9d, 0x40 }) // f-string: empty expression not allowed
+TRANSLATION("keywords must be strings", 25, { 0xf6, 0x3f, 0x3d, 0xd9, 0xeb, 0x02, 0xf9, 0x89, 0x1b, 0x18, 0x89, 0x74, 0x5e, 0x20 }) // keywords must be strings
+TRANSLATION("object not iterable", 20, { 0x6d, 0xbd, 0x4e, 0x92, 0x15, 0xa4, 0x24, 0x9b, 0x96, 0xd6, 0x30 }) // object not iterable
+TRANSLATION("cannot create '%q' instances", 29, { 0xa1, 0x2a, 0xb4, 0x8a, 0x39, 0x94, 0x98, 0xd3, 0x97, 0x5d, 0x02, 0x2c, 0x49, 0x2d, 0x0e, 0x00 }) // cannot create \'%q\' instances
+TRANSLATION("Input/output error", 19, { 0xf9, 0x2e, 0x33, 0x3f, 0x63, 0x66, 0x71, 0x99, 0x06, 0xee, 0xce }) // Input/output error
+TRANSLATION("invalid format specifier", 25, { 0x45, 0xec, 0x56, 0x4a, 0x8d, 0xd9, 0xee, 0x52, 0x23, 0x07, 0x44, 0xdd, 0x0d, 0xc0 }) // invalid format specifier
+TRANSLATION("invalid syntax for integer with base %d", 40, { 0x45, 0xec, 0x56, 0x4a, 0x88, 0xf2, 0xb2, 0x5e, 0x06, 0xec, 0xe1, 0x16, 0x4f, 0x83, 0x71, 0xdd, 0x27, 0xa0, 0xd8, 0xa0, 0xc7, 0x2a, 0x80 }) // invalid syntax for integer with base %d
+TRANSLATION("native yield", 13, { 0x52, 0x94, 0xec, 0x63, 0xca, 0x1d, 0xaa }) // native yield
+TRANSLATION("%q() takes %d positional arguments but %d were given", 53, { 0xe5, 0xd7, 0xdd, 0xef, 0x12, 0x5e, 0xc7, 0x03, 0x95, 0x46, 0x1a, 0x12, 0x51, 0x94, 0xac, 0x09, 0xf8, 0xcd, 0xcd, 0x66, 0x06, 0xd9, 0x91, 0xca, 0xa3, 0xb9, 0xb9, 0x8e, 0x13, 0xb1, 0xa8 }) // %q() takes %d positional arguments but %d were given
+TRANSLATION("conversion to object", 21, { 0xa3, 0x2f, 0x63, 0x78, 0x46, 0x51, 0x2c, 0x1b, 0x6f, 0x53, 0xa4, 0x80 }) // conversion to object
+TRANSLATION("can't switch from manual field specification to automatic field numbering", 74, { 0xa1, 0x2e, 0x92, 0x23, 0xba, 0x4d, 0x3a, 0x0d, 0xdd, 0xae, 0x2e, 0x4b, 0x92, 0xb0, 0xdd, 0x0e, 0xd5, 0x11, 0x83, 0xa2, 0x6e, 0x94, 0x29, 0x46, 0x51, 0x2c, 0x0b, 0x32, 0xd7, 0x29, 0x4a, 0x0d, 0xd0, 0xed, 0x50, 0xb9, 0xbe, 0xc6, 0xe8, 0xbc, 0x00 }) // can\'t switch from manual field specification to automatic field numbering
+TRANSLATION("complex division by zero", 25, { 0xa3, 0x5f, 0x16, 0x3f, 0x02, 0xa9, 0xd9, 0x21, 0x19, 0x46, 0xde, 0x47, 0xf8, 0x37, 0x60 }) // complex division by zero
+TRANSLATION("format requires a dict", 23, { 0xdd, 0x9e, 0xe5, 0x21, 0xcf, 0xae, 0x51, 0xce, 0x01, 0x0a, 0xa5, 0x24 }) // format requires a dict
+TRANSLATION("argument num/types mismatch", 28, { 0x27, 0xe3, 0x37, 0x35, 0x90, 0xb9, 0xbf, 0xd9, 0x3e, 0x70, 0x70, 0x2e, 0x91, 0x72, 0x9a, 0x74 }) // argument num/types mismatch
+TRANSLATION("can't send non-None value to a just-started generator", 54, { 0xa1, 0x2e, 0x92, 0x20, 0xd6, 0xa1, 0x59, 0x7e, 0x1e, 0x8c, 0xa6, 0x3b, 0x15, 0xb2, 0x62, 0x58, 0x10, 0xf5, 0xcc, 0x4f, 0xc2, 0x24, 0x9e, 0x4e, 0xa3, 0x83, 0x53, 0x72, 0x96, 0x70 }) // can\'t send non-None value to a just-started generator
+TRANSLATION("object of type '%s' has no len()", 33, { 0x6d, 0xbd, 0x4e, 0x92, 0x1b, 0x71, 0x3e, 0x70, 0x63, 0x4e, 0x51, 0xa0, 0xe8, 0x50, 0x15, 0x85, 0x8d, 0x7d, 0xde, 0xf0 }) // object of type \'%s\' has no len()
+TRANSLATION("overflow converting long int to machine word", 45, { 0x6e, 0xc6, 0xfb, 0xd9, 0xbb, 0x8a, 0x32, 0xf6, 0x37, 0x94, 0x5e, 0x05, 0x99, 0x78, 0x08, 0xb2, 0x25, 0x85, 0xca, 0x9d, 0x11, 0x4c, 0x77, 0x67, 0xa8 }) // overflow converting long int to machine word
+TRANSLATION("object not callable", 20, { 0x6d, 0xbd, 0x4e, 0x92, 0x15, 0xa4, 0x50, 0xad, 0x62, 0xda, 0xc6 }) // object not callable
+TRANSLATION("keyword argument(s) not yet implemented - use normal args instead", 66, { 0xf6, 0x3f, 0x3d, 0xd9, 0xea, 0x09, 0xf8, 0xcd, 0xcd, 0x67, 0xdd, 0x1e, 0xf0, 0xad, 0x23, 0xc9, 0xc8, 0x4b, 0xe2, 0xc7, 0x73, 0x59, 0x3a, 0x8f, 0x80, 0xcc, 0x18, 0x56, 0x7b, 0x95, 0x81, 0x3f, 0x10, 0x11, 0x62, 0x4c, 0xaa }) // keyword argument(s) not yet implemented - use normal args instead
+TRANSLATION("value must fit in %d byte(s)", 29, { 0xec, 0x56, 0xc9, 0x8b, 0xe6, 0x24, 0x6e, 0x92, 0x11, 0x47, 0x2a, 0x8d, 0xbc, 0xc9, 0xfb, 0xa3, 0xde }) // value must fit in %d byte(s)
+TRANSLATION("maximum recursion depth exceeded", 33, { 0xb9, 0x78, 0x4b, 0xe6, 0xe1, 0xce, 0x99, 0x78, 0x46, 0x51, 0x53, 0xc4, 0xf4, 0x07, 0xe2, 0x86, 0x75, 0x3a, 0x80 }) // maximum recursion depth exceeded
+TRANSLATION("unsupported format character '%c' (0x%x) at index %d", 53, { 0xca, 0xc6, 0x71, 0x86, 0x79, 0x3a, 0x8d, 0xd9, 0xee, 0x52, 0x29, 0xd0, 0x9c, 0xa9, 0x26, 0xe3, 0x4e, 0x54, 0xd0, 0x7b, 0xbe, 0xdf, 0x1c, 0xbc, 0x7b, 0xc1, 0x48, 0x45, 0xa9, 0xf8, 0x1c, 0xaa }) // unsupported format character \'%c\' (0x%x) at index %d
+TRANSLATION("identifier redefined as global", 31, { 0x4a, 0x9a, 0xca, 0x6e, 0x86, 0xe1, 0xce, 0xa7, 0xba, 0x29, 0xd4, 0x14, 0x0e, 0x2c, 0xdb, 0x15, 0x80 }) // identifier redefined as global
+TRANSLATION("length argument not allowed for this type", 42, { 0xb1, 0xaf, 0x13, 0xd0, 0x13, 0xf1, 0x9b, 0x9a, 0xc8, 0x56, 0x90, 0x56, 0xb3, 0x77, 0x3a, 0x8d, 0xd9, 0xc4, 0xf4, 0x48, 0x13, 0xe7, 0x06 }) // length argument not allowed for this type
+TRANSLATION("can't convert NaN to int", 25, { 0xa1, 0x2e, 0x92, 0x28, 0xcb, 0xd8, 0xde, 0x47, 0xa1, 0x7a, 0x09, 0x60, 0x8b, 0x20 }) // can\'t convert NaN to int
+TRANSLATION("integer required", 17, { 0x45, 0x93, 0xe0, 0xdc, 0x39, 0xf5, 0xca, 0x39, 0xd4 }) // integer required
+TRANSLATION("first argument to super() must be type", 39, { 0xdd, 0x1e, 0x24, 0x13, 0xf1, 0x9b, 0x9a, 0xc8, 0x96, 0x11, 0x9c, 0x1b, 0xfb, 0xbd, 0xe2, 0xf9, 0x89, 0x1b, 0x18, 0x9f, 0x38, 0x30 }) // first argument to super() must be type
+TRANSLATION("int() arg 2 must be >= 2 and <= 36", 35, { 0x45, 0x9f, 0x77, 0xbc, 0x13, 0xf0, 0x3f, 0x70, 0xbe, 0x62, 0x46, 0xc6, 0x3f, 0x0f, 0xe0, 0x3f, 0x70, 0x25, 0xa8, 0xfb, 0xff, 0x80, 0xfd, 0xff, 0xf0 }) // int() arg 2 must be >= 2 and <= 36
+TRANSLATION("'%s' object is not iterable", 28, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x84, 0x80, 0xad, 0x21, 0x24, 0xdc, 0xb6, 0xb1, 0x80 }) // \'%s\' object is not iterable
+TRANSLATION("'%s' object is not an iterator", 31, { 0xd3, 0x94, 0x68, 0x1b, 0x6f, 0x53, 0xa4, 0x84, 0x80, 0xad, 0x20, 0x94, 0x24, 0x9b, 0x94, 0xb3, 0x80 }) // \'%s\' object is not an iterator
+TRANSLATION("'=' alignment not allowed in string format specifier", 53, { 0xd3, 0xf8, 0x68, 0x0a, 0xc9, 0xc2, 0xdc, 0xd6, 0x42, 0xb4, 0x82, 0xb5, 0x9b, 0xb9, 0xd4, 0x22, 0x88, 0x97, 0x45, 0xe0, 0x6e, 0xcf, 0x72, 0x91, 0x18, 0x3a, 0x26, 0xe8, 0x6e }) // \'=\' alignment not allowed in string format specifier
+
+// 2163 bytes worth of qstr
+// 7178 bytes worth of translations
+// 4204 bytes worth of translations compressed
+// 2974 bytes saved
@@ -143,9 +143,6 @@ void gc_collect(void) {
     // GC stack (and regs because we captured them)
     void **regs_ptr = (void**)(void*)&regs;
     gc_collect_root(regs_ptr, ((mp_uint_t)MP_STATE_THREAD(stack_top) - (mp_uint_t)&regs) / sizeof(mp_uint_t));
-    #if MICROPY_EMIT_NATIVE
-    mp_unix_mark_exec();
-    #endif
     gc_collect_end();
 }
 
@@ -109,6 +109,7 @@ STATIC int usage(char **argv) {
 "-msmall-int-bits=number : set the maximum bits used to encode a small-int\n"
 "-mno-unicode : don't support unicode in compiled strings\n"
 "-mcache-lookup-bc : cache map lookups in the bytecode\n"
+"-march=<arch> : set architecture for native emitter; x64\n"
 "\n"
 "Implementation specific options:\n", argv[0]
 );
@@ -240,6 +241,14 @@ MP_NOINLINE int main_(int argc, char **argv) {
                 mp_dynamic_compiler.py_builtins_str_unicode = 0;
             } else if (strcmp(argv[a], "-municode") == 0) {
                 mp_dynamic_compiler.py_builtins_str_unicode = 1;
+            } else if (strncmp(argv[a], "-march=", sizeof("-march=") - 1) == 0) {
+                const char *arch = argv[a] + sizeof("-march=") - 1;
+                if (MICROPY_EMIT_X64 && strcmp(arch, "x64") == 0) {
+                    mp_dynamic_compiler.native_arch = MP_NATIVE_ARCH_X64;
+                } else {
+                    mp_printf(&mp_stderr_print, "unrecognised arch\n");
+                    exit(1);
+                }
             } else {
                 return usage(argv);
             }
@@ -257,6 +266,12 @@ MP_NOINLINE int main_(int argc, char **argv) {
         exit(1);
     }
 
+    if ((emit_opt == MP_EMIT_OPT_NATIVE_PYTHON || emit_opt == MP_EMIT_OPT_VIPER)
+        && mp_dynamic_compiler.native_arch == MP_NATIVE_ARCH_NONE) {
+        mp_printf(&mp_stderr_print, "arch not specified\n");
+        exit(1);
+    }
+
     int ret = compile_and_save(input_file, output_file, source_file);
 
     #if MICROPY_PY_MICROPYTHON_MEM_INFO
@@ -30,7 +30,12 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #define MICROPY_PERSISTENT_CODE_SAVE (1)
 
+// native code can be saved for x64, when the host has the same word size
+#if defined(__LP64__) || defined(_WIN64)
+#define MICROPY_EMIT_X64            (1)
+#else
 #define MICROPY_EMIT_X64            (0)
+#endif
 #define MICROPY_EMIT_X86            (0)
 #define MICROPY_EMIT_THUMB          (0)
 #define MICROPY_EMIT_INLINE_THUMB   (0)
@@ -40,11 +45,17 @@
 
 #define MICROPY_DYNAMIC_COMPILER    (1)
 #define MICROPY_COMP_CONST_FOLDING  (1)
+// floats would be folded in double precision, which boards using single
+// precision floats wouldn't give the same result for
+#define MICROPY_COMP_CONST_FLOAT    (0)
+#define MICROPY_COMP_CONST_STR      (1)
+#define MICROPY_COMP_CONST_TUPLE    (1)
 #define MICROPY_COMP_MODULE_CONST   (1)
 #define MICROPY_COMP_CONST          (1)
 #define MICROPY_COMP_DOUBLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_RETURN_IF_EXPR (1)
+#define MICROPY_LEXER_FAST_SCAN     (1)
 
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (0)
 
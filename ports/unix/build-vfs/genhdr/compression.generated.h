@@ -0,0 +1,2 @@
+const uint8_t lengths[] = { 0, 0, 0, 9, 7, 6, 6, 8, 14, 14, 6, 7, 10, 0 };
+const uint8_t values[] = { 32, 97, 101, 105, 110, 111, 114, 115, 116, 95, 99, 100, 108, 109, 112, 117, 39, 98, 102, 103, 104, 121, 37, 69, 107, 118, 119, 120, 65, 73, 78, 79, 83, 84, 106, 113, 40, 41, 45, 48, 50, 66, 67, 68, 70, 76, 80, 82, 85, 122, 10, 42, 44, 46, 47, 49, 51, 54, 58, 60, 62, 71, 77, 86, 13, 35, 52, 56, 75, 87, 34, 53, 61, 72, 88, 89, 125, 33, 55, 57, 59, 74, 90, 91, 93, 96, 123 };
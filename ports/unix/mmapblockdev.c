@@ -0,0 +1,284 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "py/runtime.h"
+#include "py/mperrno.h"
+#include "py/mphal.h"
+#include "extmod/vfs.h"
+
+#include "supervisor/shared/translate.h"
+
+#if MICROPY_UNIX_MMAP_BLOCKDEV
+
+// A block device on a disk image file mapped into memory, for running and
+// measuring filesystems on the host without hardware.  On top of the block
+// protocol it can add a fixed latency to each readblocks/writeblocks call,
+// and model NOR flash: a write over data that isn't erased (all 0xff) counts
+// an erase of each erase unit it touches, and costs erase_us per unit.
+// stats() returns the counts so benchmarks can report them.
+
+typedef struct _mmap_blockdev_obj_t {
+    mp_obj_base_t base;
+    byte *data; // NULL once closed
+    size_t size;
+    mp_uint_t block_size;
+    mp_uint_t erase_size;
+    mp_uint_t latency_us;
+    mp_uint_t erase_us;
+    mp_int_t xfer;
+    // stats
+    mp_uint_t n_reads;
+    mp_uint_t n_writes;
+    mp_uint_t n_blocks_read;
+    mp_uint_t n_blocks_written;
+    mp_uint_t n_erases;
+} mmap_blockdev_obj_t;
+
+// Spin rather than sleep, so that short latencies are kept to.
+STATIC void mmap_blockdev_wait(mp_uint_t us) {
+    if (us != 0) {
+        mp_uint_t start = mp_hal_ticks_us();
+        while (mp_hal_ticks_us() - start < us) {
+        }
+    }
+}
+
+STATIC mmap_blockdev_obj_t *mmap_blockdev_get(mp_obj_t self_in) {
+    mmap_blockdev_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->data == NULL) {
+        mp_raise_ValueError(translate("I/O operation on closed file"));
+    }
+    return self;
+}
+
+// Check the transfer fits the image, returning its byte offset.
+STATIC size_t mmap_blockdev_offset(mmap_blockdev_obj_t *self, mp_obj_t block_num, size_t len) {
+    mp_int_t block = mp_obj_get_int(block_num);
+    if (block < 0 || len % self->block_size != 0
+        || (size_t)block > self->size / self->block_size
+        || len > self->size - block * self->block_size) {
+        mp_raise_OSError(MP_EIO);
+    }
+    return block * self->block_size;
+}
+
+STATIC mp_obj_t mmap_blockdev_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_path, ARG_block_size, ARG_blocks, ARG_latency_us, ARG_erase_size, ARG_erase_us, ARG_xfer };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_path, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_block_size, MP_ARG_INT, {.u_int = 512} },
+        { MP_QSTR_blocks, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_latency_us, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_erase_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_erase_us, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_xfer, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t block_size = args[ARG_block_size].u_int;
+    mp_int_t erase_size = args[ARG_erase_size].u_int;
+    if (block_size <= 0 || (block_size & (block_size - 1)) != 0
+        || erase_size < 0 || (erase_size != 0 && erase_size % block_size != 0)
+        || args[ARG_blocks].u_int < 0 || args[ARG_latency_us].u_int < 0
+        || args[ARG_erase_us].u_int < 0 || args[ARG_xfer].u_int < 0) {
+        mp_raise_ValueError(NULL);
+    }
+
+    // open the image, making it the given number of blocks if that's set
+    const char *path = mp_obj_str_get_str(args[ARG_path].u_obj);
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        mp_raise_OSError(errno);
+    }
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        int err = errno;
+        close(fd);
+        mp_raise_OSError(err);
+    }
+    size_t old_size = st.st_size;
+    size_t size = old_size;
+    if (args[ARG_blocks].u_int > 0) {
+        size = args[ARG_blocks].u_int * block_size;
+        if (ftruncate(fd, size) < 0) {
+            int err = errno;
+            close(fd);
+            mp_raise_OSError(err);
+        }
+    }
+    size -= size % block_size;
+    if (size == 0) {
+        close(fd);
+        mp_raise_ValueError(translate("empty disk image"));
+    }
+    void *data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // the mapping stays valid without the descriptor
+    close(fd);
+    if (data == MAP_FAILED) {
+        mp_raise_OSError(errno);
+    }
+    if (erase_size != 0 && size > old_size) {
+        // new space in a flash image starts out erased
+        memset((byte*)data + old_size, 0xff, size - old_size);
+    }
+
+    mmap_blockdev_obj_t *self = m_new_obj_with_finaliser(mmap_blockdev_obj_t);
+    memset(self, 0, sizeof(*self));
+    self->base.type = type;
+    self->data = data;
+    self->size = size;
+    self->block_size = block_size;
+    self->erase_size = erase_size;
+    self->latency_us = args[ARG_latency_us].u_int;
+    self->erase_us = args[ARG_erase_us].u_int;
+    self->xfer = args[ARG_xfer].u_int;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t mmap_blockdev_readblocks(mp_obj_t self_in, mp_obj_t block_num, mp_obj_t buf_in) {
+    mmap_blockdev_obj_t *self = mmap_blockdev_get(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t ofs = mmap_blockdev_offset(self, block_num, bufinfo.len);
+    mmap_blockdev_wait(self->latency_us);
+    memcpy(bufinfo.buf, self->data + ofs, bufinfo.len);
+    self->n_reads += 1;
+    self->n_blocks_read += bufinfo.len / self->block_size;
+    return MP_OBJ_NEW_SMALL_INT(0);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mmap_blockdev_readblocks_obj, mmap_blockdev_readblocks);
+
+STATIC mp_obj_t mmap_blockdev_writeblocks(mp_obj_t self_in, mp_obj_t block_num, mp_obj_t buf_in) {
+    mmap_blockdev_obj_t *self = mmap_blockdev_get(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    size_t ofs = mmap_blockdev_offset(self, block_num, bufinfo.len);
+    mmap_blockdev_wait(self->latency_us);
+    if (self->erase_size != 0) {
+        // each erase unit the write touches has to be erased first unless
+        // the part being written is still erased
+        size_t end = ofs + bufinfo.len;
+        for (size_t unit = ofs - ofs % self->erase_size; unit < end; unit += self->erase_size) {
+            size_t a = MAX(unit, ofs);
+            size_t b = MIN(unit + self->erase_size, end);
+            for (size_t i = a; i < b; ++i) {
+                if (self->data[i] != 0xff) {
+                    self->n_erases += 1;
+                    mmap_blockdev_wait(self->erase_us);
+                    break;
+                }
+            }
+        }
+    }
+    memcpy(self->data + ofs, bufinfo.buf, bufinfo.len);
+    self->n_writes += 1;
+    self->n_blocks_written += bufinfo.len / self->block_size;
+    return MP_OBJ_NEW_SMALL_INT(0);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mmap_blockdev_writeblocks_obj, mmap_blockdev_writeblocks);
+
+STATIC mp_obj_t mmap_blockdev_ioctl(mp_obj_t self_in, mp_obj_t op_in, mp_obj_t arg_in) {
+    mmap_blockdev_obj_t *self = mmap_blockdev_get(self_in);
+    (void)arg_in;
+    switch (mp_obj_get_int(op_in)) {
+        case BP_IOCTL_INIT:
+        case BP_IOCTL_DEINIT:
+            return MP_OBJ_NEW_SMALL_INT(0);
+        case BP_IOCTL_SYNC:
+            if (msync(self->data, self->size, MS_SYNC) < 0) {
+                return MP_OBJ_NEW_SMALL_INT(-errno);
+            }
+            return MP_OBJ_NEW_SMALL_INT(0);
+        case BP_IOCTL_SEC_COUNT:
+            return MP_OBJ_NEW_SMALL_INT(self->size / self->block_size);
+        case BP_IOCTL_SEC_SIZE:
+            return MP_OBJ_NEW_SMALL_INT(self->block_size);
+        case BP_IOCTL_XFER_SIZE:
+            return self->xfer == 0 ? mp_const_none : MP_OBJ_NEW_SMALL_INT(self->xfer);
+        default:
+            return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(mmap_blockdev_ioctl_obj, mmap_blockdev_ioctl);
+
+// stats([reset]): (reads, writes, blocks_read, blocks_written, erases) since
+// the device was made or the counts were last reset
+STATIC mp_obj_t mmap_blockdev_stats(size_t n_args, const mp_obj_t *args) {
+    mmap_blockdev_obj_t *self = mmap_blockdev_get(args[0]);
+    mp_obj_t items[5] = {
+        mp_obj_new_int_from_uint(self->n_reads),
+        mp_obj_new_int_from_uint(self->n_writes),
+        mp_obj_new_int_from_uint(self->n_blocks_read),
+        mp_obj_new_int_from_uint(self->n_blocks_written),
+        mp_obj_new_int_from_uint(self->n_erases),
+    };
+    if (n_args > 1 && mp_obj_is_true(args[1])) {
+        self->n_reads = 0;
+        self->n_writes = 0;
+        self->n_blocks_read = 0;
+        self->n_blocks_written = 0;
+        self->n_erases = 0;
+    }
+    return mp_obj_new_tuple(MP_ARRAY_SIZE(items), items);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mmap_blockdev_stats_obj, 1, 2, mmap_blockdev_stats);
+
+STATIC mp_obj_t mmap_blockdev_close(mp_obj_t self_in) {
+    mmap_blockdev_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->data != NULL) {
+        munmap(self->data, self->size);
+        self->data = NULL;
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(mmap_blockdev_close_obj, mmap_blockdev_close);
+
+STATIC const mp_rom_map_elem_t mmap_blockdev_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_readblocks), MP_ROM_PTR(&mmap_blockdev_readblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeblocks), MP_ROM_PTR(&mmap_blockdev_writeblocks_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ioctl), MP_ROM_PTR(&mmap_blockdev_ioctl_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&mmap_blockdev_stats_obj) },
+    { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mmap_blockdev_close_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&mmap_blockdev_close_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(mmap_blockdev_locals_dict, mmap_blockdev_locals_dict_table);
+
+const mp_obj_type_t mp_type_mmap_blockdev = {
+    { &mp_type_type },
+    .name = MP_QSTR_MmapBlockDev,
+    .make_new = mmap_blockdev_make_new,
+    .locals_dict = (mp_obj_dict_t*)&mmap_blockdev_locals_dict,
+};
+
+#endif // MICROPY_UNIX_MMAP_BLOCKDEV
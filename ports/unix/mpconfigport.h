@@ -28,6 +28,9 @@
 
 #define MICROPY_ALLOC_PATH_MAX      (PATH_MAX)
 #define MICROPY_PERSISTENT_CODE_LOAD (1)
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_XIP
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (1)
+#endif
 #if !defined(MICROPY_EMIT_X64) && defined(__x86_64__)
     #define MICROPY_EMIT_X64        (1)
 #endif
@@ -43,12 +46,23 @@
 #if !defined(MICROPY_EMIT_ARM) && defined(__arm__) && !defined(__thumb2__)
     #define MICROPY_EMIT_ARM        (1)
 #endif
+// compile hot functions to native code where there's an x64 emitter
+#ifndef MICROPY_JIT
+#define MICROPY_JIT                 (MICROPY_EMIT_X64)
+#endif
+#define MICROPY_COMP_CONST_FLOAT    (1)
+#define MICROPY_COMP_CONST_STR      (1)
+#define MICROPY_COMP_CONST_TUPLE    (1)
 #define MICROPY_COMP_MODULE_CONST   (1)
 #define MICROPY_COMP_TRIPLE_TUPLE_ASSIGN (1)
 #define MICROPY_COMP_RETURN_IF_EXPR (1)
+#define MICROPY_LEXER_FAST_SCAN     (1)
 #define MICROPY_ENABLE_GC           (1)
 #define MICROPY_ENABLE_FINALISER    (1)
 #define MICROPY_STACK_CHECK         (1)
+#ifndef MICROPY_FRAME_ARENA_SIZE
+#define MICROPY_FRAME_ARENA_SIZE    (16 * 1024)
+#endif
 #define MICROPY_MALLOC_USES_ALLOCATED_SIZE (1)
 #define MICROPY_MEM_STATS           (1)
 #define MICROPY_DEBUG_PRINTERS      (1)
@@ -70,6 +84,10 @@
 #ifndef MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (1)
 #endif
+#define MICROPY_QSTR_HASH_INDEX     (1)
+#define MICROPY_OPT_MPZ_LARGE       (1)
+#define MICROPY_OPT_STR_FORMAT_SIMPLE (1)
+#define MICROPY_OPT_STR_INPLACE_ADD (1)
 #define MICROPY_CAN_OVERRIDE_BUILTINS (1)
 #define MICROPY_PY_FUNCTION_ATTRS   (1)
 #define MICROPY_PY_DESCRIPTORS      (1)
@@ -118,10 +136,16 @@
 #define MICROPY_PY_UTIME            (1)
 #define MICROPY_PY_UTIME_MP_HAL     (1)
 #define MICROPY_PY_UERRNO           (1)
+#define MICROPY_PY_UPROFILE         (1)
+#define MICROPY_PY_UPROFILE_HOOK_START mp_hal_prof_timer(true);
+#define MICROPY_PY_UPROFILE_HOOK_STOP mp_hal_prof_timer(false);
 #define MICROPY_PY_UCTYPES          (1)
 #define MICROPY_PY_UZLIB            (1)
 #define MICROPY_PY_UJSON            (1)
+#define MICROPY_PY_UJSON_ITERPARSE  (1)
 #define MICROPY_PY_URE              (1)
+#define MICROPY_PY_URE_CACHE_SIZE   (8)
+#define MICROPY_PY_URE_PIKEVM       (1)
 #define MICROPY_PY_UHEAPQ           (1)
 #define MICROPY_PY_UTIMEQ           (1)
 #define MICROPY_PY_UHASHLIB         (1)
@@ -145,6 +169,10 @@
 #define MICROPY_FATFS_MAX_SS           (4096)
 #define MICROPY_FATFS_LFN_CODE_PAGE    (437) /* 1=SFN/ANSI 437=LFN/U.S.(OEM) */
 #define MICROPY_VFS_FAT                (0)
+// uos.MmapBlockDev, a block device on a disk image to mount FAT filesystems on
+#ifndef MICROPY_UNIX_MMAP_BLOCKDEV
+#define MICROPY_UNIX_MMAP_BLOCKDEV     (MICROPY_VFS_FAT)
+#endif
 
 // Define to MICROPY_ERROR_REPORTING_DETAILED to get function, etc.
 // names in exception messages (may require more RAM).
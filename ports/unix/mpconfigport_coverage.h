@@ -35,6 +35,9 @@
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH (1)
 #define MICROPY_ENABLE_SCHEDULER       (1)
 #define MICROPY_READER_VFS             (1)
+#define MICROPY_PERSISTENT_CODE_SAVE   (1)
+#define MICROPY_MODULE_BYTECODE_CACHE  (1)
+#define MICROPY_MODULE_STAT_CACHE      (1)
 #define MICROPY_PY_DELATTR_SETATTR     (1)
 #define MICROPY_PY_REVERSE_SPECIAL_METHODS (1)
 #define MICROPY_PY_BUILTINS_RANGE_BINOP (1)
@@ -45,6 +48,7 @@
 #define MICROPY_PY_IO_BUFFEREDWRITER (1)
 #define MICROPY_PY_IO_RESOURCE_STREAM (1)
 #define MICROPY_VFS_POSIX              (1)
+#define MICROPY_VFS_FAT_WRITEBEHIND    (1)
 #undef MICROPY_VFS_FAT
 #define MICROPY_VFS_FAT                (1)
 #define MICROPY_FATFS_USE_LABEL        (1)
@@ -23,6 +23,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  * THE SOFTWARE.
  */
+#include <stdbool.h>
 #include <unistd.h>
 
 #ifndef CHAR_CTRL_C
@@ -34,6 +35,8 @@ void mp_hal_set_interrupt_char(char c);
 void mp_hal_stdio_mode_raw(void);
 void mp_hal_stdio_mode_orig(void);
 
+void mp_hal_prof_timer(bool enable);
+
 #if MICROPY_USE_READLINE == 1 && MICROPY_PY_BUILTINS_INPUT
 #include "py/misc.h"
 #include "lib/mp-readline/readline.h"
@@ -161,9 +161,22 @@ void mp_thread_create(void *(*entry)(void*), void *arg, size_t *stack_size) {
 
     pthread_mutex_lock(&thread_mutex);
 
+    #if MICROPY_PY_UPROFILE
+    // the new thread inherits this mask, so that the profiler's SIGPROF is
+    // only delivered to the main thread, which is the one it samples
+    sigset_t prof_set, old_set;
+    sigemptyset(&prof_set);
+    sigaddset(&prof_set, SIGPROF);
+    pthread_sigmask(SIG_BLOCK, &prof_set, &old_set);
+    #endif
+
     // create thread
     pthread_t id;
     ret = pthread_create(&id, &attr, entry, arg);
+
+    #if MICROPY_PY_UPROFILE
+    pthread_sigmask(SIG_SETMASK, &old_set, NULL);
+    #endif
     if (ret != 0) {
         pthread_mutex_unlock(&thread_mutex);
         goto er;
@@ -81,6 +81,38 @@ void mp_hal_set_interrupt_char(char c) {
     }
 }
 
+#if MICROPY_PY_UPROFILE
+#include "py/profile.h"
+
+#ifndef _WIN32
+STATIC void prof_sighandler(int signum) {
+    (void)signum;
+    // other threads block SIGPROF (see mp_thread_create), so this always
+    // runs on the main thread
+    mp_prof_sample();
+}
+#endif
+
+void mp_hal_prof_timer(bool enable) {
+    #ifndef _WIN32
+    // sample every 1ms of CPU time used by the process
+    struct itimerval it = {{0, 0}, {0, 0}};
+    if (enable) {
+        struct sigaction sa;
+        sa.sa_flags = SA_RESTART;
+        sa.sa_handler = prof_sighandler;
+        sigemptyset(&sa.sa_mask);
+        sigaction(SIGPROF, &sa, NULL);
+        it.it_interval.tv_usec = 1000;
+        it.it_value.tv_usec = 1000;
+    }
+    setitimer(ITIMER_PROF, &it, NULL);
+    #else
+    (void)enable;
+    #endif
+}
+#endif
+
 #if MICROPY_USE_READLINE == 1
 
 #include <termios.h>
@@ -197,3 +229,51 @@ mp_uint_t mp_hal_ticks_us(void) {
     gettimeofday(&tv, NULL);
     return tv.tv_sec * 1000000 + tv.tv_usec;
 }
+
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "py/persistentcode.h"
+
+#if MICROPY_READER_VFS
+#include "extmod/vfs.h"
+#include "extmod/vfs_posix.h"
+#endif
+
+const byte *mp_persistent_code_map_file(const char *filename, size_t *len) {
+    #if MICROPY_READER_VFS
+    // the filename is a VFS path; only files on a VfsPosix mount have a name
+    // that the OS knows and can map, others are read into the heap
+    #if defined(MICROPY_VFS_POSIX) && MICROPY_VFS_POSIX
+    const char *path_out;
+    mp_vfs_mount_t *vfs = mp_vfs_lookup_path(filename, &path_out);
+    if (vfs == MP_VFS_NONE || vfs == MP_VFS_ROOT || mp_obj_get_type(vfs->obj) != &mp_type_vfs_posix) {
+        return NULL;
+    }
+    filename = mp_vfs_posix_get_host_path(vfs->obj, path_out);
+    #else
+    (void)len;
+    return NULL;
+    #endif
+    #endif
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    void *buf = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        // a private mapping, so that the VM can write to the bytecode (for
+        // MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE) and only the pages that it
+        // writes to get copied; the code may live forever so it's never unmapped
+        buf = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (buf == MAP_FAILED) {
+        return NULL;
+    }
+    *len = st.st_size;
+    return buf;
+}
+#endif
@@ -404,6 +404,23 @@ void asm_x64_mul_r64_r64(asm_x64_t *as, int dest_r64, int src_r64) {
     asm_x64_write_byte_3(as, 0x0f, 0xaf, MODRM_R64(dest_r64) | MODRM_RM_REG | MODRM_RM_R64(src_r64));
 }
 
+// The operands are the bit patterns of doubles held in general purpose
+// registers; xmm0 and xmm1 are clobbered.
+void asm_x64_float_op_r64_r64(asm_x64_t *as, int op, int dest_r64, int src_r64) {
+    // movq xmm0, dest -- 0x66 0x0f 0x6e /r
+    asm_x64_write_byte_2(as, OP_SIZE_PREFIX, REX_PREFIX | REX_W | REX_B_FROM_R64(dest_r64));
+    asm_x64_write_byte_3(as, 0x0f, 0x6e, MODRM_R64(0) | MODRM_RM_REG | MODRM_RM_R64(dest_r64));
+    // movq xmm1, src
+    asm_x64_write_byte_2(as, OP_SIZE_PREFIX, REX_PREFIX | REX_W | REX_B_FROM_R64(src_r64));
+    asm_x64_write_byte_3(as, 0x0f, 0x6e, MODRM_R64(1) | MODRM_RM_REG | MODRM_RM_R64(src_r64));
+    // <op>sd xmm0, xmm1 -- 0xf2 0x0f op /r
+    asm_x64_write_byte_2(as, 0xf2, 0x0f);
+    asm_x64_write_byte_2(as, op, MODRM_R64(0) | MODRM_RM_REG | 1);
+    // movq dest, xmm0 -- 0x66 0x0f 0x7e /r
+    asm_x64_write_byte_2(as, OP_SIZE_PREFIX, REX_PREFIX | REX_W | REX_B_FROM_R64(dest_r64));
+    asm_x64_write_byte_3(as, 0x0f, 0x7e, MODRM_R64(0) | MODRM_RM_REG | MODRM_RM_R64(dest_r64));
+}
+
 /*
 void asm_x64_sub_i32_from_r32(asm_x64_t *as, int src_i32, int dest_r32) {
     if (SIGNED_FIT8(src_i32)) {
@@ -610,6 +627,11 @@ void asm_x64_call_i1(asm_x64_t *as, void* func, int i1) {
 }
 */
 
+void asm_x64_call_r64(asm_x64_t *as, int src_r64) {
+    assert(src_r64 < 8);
+    asm_x64_write_byte_2(as, OPCODE_CALL_RM32, MODRM_R64(2) | MODRM_RM_REG | MODRM_RM_R64(src_r64));
+}
+
 void asm_x64_call_ind(asm_x64_t *as, void *ptr, int temp_r64) {
     assert(temp_r64 < 8);
 #ifdef __LP64__
@@ -618,7 +640,7 @@ void asm_x64_call_ind(asm_x64_t *as, void *ptr, int temp_r64) {
     // If we get here, sizeof(int) == sizeof(void*).
     asm_x64_mov_i64_to_r64_optimised(as, (int64_t)(unsigned int)ptr, temp_r64);
 #endif
-    asm_x64_write_byte_2(as, OPCODE_CALL_RM32, MODRM_R64(2) | MODRM_RM_REG | MODRM_RM_R64(temp_r64));
+    asm_x64_call_r64(as, temp_r64);
     // this reduces code size by 2 bytes per call, but doesn't seem to speed it up at all
     // doesn't work anymore because calls are 64 bits away
     /*
@@ -70,6 +70,12 @@
 #define ASM_X64_CC_JLE (0xe) // less or equal, signed
 #define ASM_X64_CC_JG  (0xf) // greater, signed
 
+// scalar double precision ops, for asm_x64_float_op_r64_r64
+#define ASM_X64_FLOAT_ADD (0x58)
+#define ASM_X64_FLOAT_MUL (0x59)
+#define ASM_X64_FLOAT_SUB (0x5c)
+#define ASM_X64_FLOAT_DIV (0x5e)
+
 typedef struct _asm_x64_t {
     mp_asm_base_t base;
     int num_locals;
@@ -102,6 +108,7 @@ void asm_x64_sar_r64_cl(asm_x64_t* as, int dest_r64);
 void asm_x64_add_r64_r64(asm_x64_t* as, int dest_r64, int src_r64);
 void asm_x64_sub_r64_r64(asm_x64_t* as, int dest_r64, int src_r64);
 void asm_x64_mul_r64_r64(asm_x64_t* as, int dest_r64, int src_r64);
+void asm_x64_float_op_r64_r64(asm_x64_t *as, int op, int dest_r64, int src_r64);
 void asm_x64_cmp_r64_with_r64(asm_x64_t* as, int src_r64_a, int src_r64_b);
 void asm_x64_test_r8_with_r8(asm_x64_t* as, int src_r64_a, int src_r64_b);
 void asm_x64_setcc_r8(asm_x64_t* as, int jcc_type, int dest_r8);
@@ -112,6 +119,7 @@ void asm_x64_exit(asm_x64_t* as);
 void asm_x64_mov_local_to_r64(asm_x64_t* as, int src_local_num, int dest_r64);
 void asm_x64_mov_r64_to_local(asm_x64_t* as, int src_r64, int dest_local_num);
 void asm_x64_mov_local_addr_to_r64(asm_x64_t* as, int local_num, int dest_r64);
+void asm_x64_call_r64(asm_x64_t* as, int src_r64);
 void asm_x64_call_ind(asm_x64_t* as, void* ptr, int temp_r32);
 
 #if defined(GENERIC_ASM_API) && GENERIC_ASM_API
@@ -161,6 +169,7 @@ void asm_x64_call_ind(asm_x64_t* as, void* ptr, int temp_r32);
         asm_x64_jcc_label(as, ASM_X64_CC_JE, label); \
     } while (0)
 #define ASM_CALL_IND(as, ptr, idx) asm_x64_call_ind(as, ptr, ASM_X64_REG_RAX)
+#define ASM_CALL_REG(as, reg) asm_x64_call_r64((as), (reg))
 
 #define ASM_MOV_LOCAL_REG(as, local_num, reg_src) asm_x64_mov_r64_to_local((as), (reg_src), (local_num))
 #define ASM_MOV_REG_IMM(as, reg_dest, imm) asm_x64_mov_i64_to_r64_optimised((as), (imm), (reg_dest))
@@ -132,6 +132,19 @@ void mp_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw
     code_state->sp = &code_state->state[0] - 1;
     code_state->exc_sp = (mp_exc_stack_t*)(code_state->state + n_state) - 1;
 
+    if ((scope_flags & MP_SCOPE_FLAG_SIMPLE_ARGS) != 0 && n_kw == 0) {
+        // fast path: there's nothing to fill in or check besides the
+        // number of args, so copy them straight into the state
+        if (n_args != n_pos_args) {
+            fun_pos_args_mismatch(self, n_pos_args, n_args);
+        }
+        memset(code_state->state, 0, (n_state - n_args) * sizeof(*code_state->state));
+        for (size_t i = 0; i < n_args; i++) {
+            code_state->state[n_state - 1 - i] = args[i];
+        }
+        goto prelude;
+    }
+
     // zero out the local stack to begin with
     memset(code_state->state, 0, n_state * sizeof(*code_state->state));
 
@@ -273,6 +286,7 @@ continue2:;
         }
     }
 
+prelude:;
     // get the ip and skip argument names
     const byte *ip = code_state->ip;
 
@@ -294,7 +308,55 @@ continue2:;
     dump_args(code_state->state, n_state);
 }
 
-#if MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PERSISTENT_CODE_SAVE
+void mp_bytecode_get_source_info(const mp_obj_fun_bc_t *fun_bc, const byte *ip, qstr *block_name, qstr *source_file, size_t *source_line) {
+    const byte *p = fun_bc->bytecode;
+    p = mp_decode_uint_skip(p); // skip n_state
+    p = mp_decode_uint_skip(p); // skip n_exc_stack
+    p++; // skip scope_params
+    p++; // skip n_pos_args
+    p++; // skip n_kwonly_args
+    p++; // skip n_def_pos_args
+    size_t bc = ip - p;
+    size_t code_info_size = mp_decode_uint_value(p);
+    p = mp_decode_uint_skip(p); // skip code_info_size
+    bc -= code_info_size;
+    #if MICROPY_PERSISTENT_CODE
+    *block_name = MP_OBJ_FUN_BC_QSTR(fun_bc, p[0] | (p[1] << 8));
+    *source_file = MP_OBJ_FUN_BC_QSTR(fun_bc, p[2] | (p[3] << 8));
+    p += 4;
+    #else
+    *block_name = mp_decode_uint_value(p);
+    p = mp_decode_uint_skip(p);
+    *source_file = mp_decode_uint_value(p);
+    p = mp_decode_uint_skip(p);
+    #endif
+    size_t line = 1;
+    size_t c;
+    while ((c = *p)) {
+        size_t b, l;
+        if ((c & 0x80) == 0) {
+            // 0b0LLBBBBB encoding
+            b = c & 0x1f;
+            l = c >> 5;
+            p += 1;
+        } else {
+            // 0b1LLLBBBB 0bLLLLLLLL encoding (l's LSB in second byte)
+            b = c & 0xf;
+            l = ((c << 4) & 0x700) | p[1];
+            p += 2;
+        }
+        if (bc >= b) {
+            bc -= b;
+            line += l;
+        } else {
+            // found source line corresponding to bytecode offset
+            break;
+        }
+    }
+    *source_line = line;
+}
+
+#if MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PERSISTENT_CODE_SAVE || MICROPY_JIT
 
 // The following table encodes the number of bytes that a specific opcode
 // takes up.  There are 3 special opcodes that always have an extra byte:
@@ -422,4 +484,4 @@ uint mp_opcode_format(const byte *ip, size_t *opcode_size) {
     return f;
 }
 
-#endif // MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PERSISTENT_CODE_SAVE
+#endif // MICROPY_PERSISTENT_CODE_LOAD || MICROPY_PERSISTENT_CODE_SAVE || MICROPY_JIT
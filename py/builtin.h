@@ -32,6 +32,17 @@ mp_obj_t mp_builtin___import__(size_t n_args, const mp_obj_t *args);
 mp_obj_t mp_builtin_open(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs);
 mp_obj_t mp_micropython_mem_info(size_t n_args, const mp_obj_t *args);
 
+#if MICROPY_MODULE_STAT_CACHE
+void mp_import_stat_cache_clear(void);
+void mp_import_stat_cache_file_opened(const char *path);
+#else
+static inline void mp_import_stat_cache_clear(void) {
+}
+static inline void mp_import_stat_cache_file_opened(const char *path) {
+    (void)path;
+}
+#endif
+
 MP_DECLARE_CONST_FUN_OBJ_VAR(mp_builtin___build_class___obj);
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_builtin___import___obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_builtin___repl_print___obj);
@@ -95,6 +106,7 @@ extern const mp_obj_module_t mp_module_ustruct;
 extern const mp_obj_module_t mp_module_sys;
 extern const mp_obj_module_t mp_module_gc;
 extern const mp_obj_module_t mp_module_thread;
+extern const mp_obj_module_t mp_module_uprofile;
 
 extern const mp_obj_dict_t mp_module_builtins_globals;
 
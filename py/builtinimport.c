@@ -32,12 +32,29 @@
 #include "py/compile.h"
 #include "py/gc_long_lived.h"
 #include "py/gc.h"
+#include "py/jit.h"
 #include "py/objmodule.h"
+#include "py/objstr.h"
 #include "py/persistentcode.h"
 #include "py/runtime.h"
 #include "py/builtin.h"
 #include "py/frozenmod.h"
 
+#if MICROPY_MODULE_BYTECODE_CACHE
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#if !MICROPY_VFS || !MICROPY_PERSISTENT_CODE_LOAD || !MICROPY_PERSISTENT_CODE_SAVE
+#error MICROPY_MODULE_BYTECODE_CACHE requires MICROPY_VFS and MICROPY_PERSISTENT_CODE_LOAD/SAVE
+#endif
+#endif
+
+#if MICROPY_MODULE_STAT_CACHE
+#include "extmod/vfs.h"
+#if !MICROPY_VFS
+#error MICROPY_MODULE_STAT_CACHE requires MICROPY_VFS
+#endif
+#endif
+
 #include "supervisor/shared/translate.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -48,6 +65,25 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
+#if MICROPY_MODULE_STAT_CACHE
+// Safe to call from an interrupt: the cache is only marked stale here and is
+// emptied by the next import.
+void mp_import_stat_cache_clear(void) {
+    MP_STATE_VM(import_stat_cache_stale) = true;
+}
+
+// Called when a file has been opened for writing.  This can only change the
+// result of an import if it creates a .py or .mpy file, which keeps data
+// logging from flushing the cache.
+void mp_import_stat_cache_file_opened(const char *path) {
+    size_t len = strlen(path);
+    if ((len >= 3 && !memcmp(path + len - 3, ".py", 3))
+        || (len >= 4 && !memcmp(path + len - 4, ".mpy", 4))) {
+        mp_import_stat_cache_clear();
+    }
+}
+#endif
+
 #if MICROPY_ENABLE_EXTERNAL_IMPORT
 
 #define PATH_SEP_CHAR '/'
@@ -71,7 +107,32 @@ STATIC mp_import_stat_t mp_import_stat_any(const char *path) {
         }
     }
     #endif
+    #if MICROPY_MODULE_STAT_CACHE
+    mp_map_t *cache = &MP_STATE_VM(import_stat_cache);
+    if (MP_STATE_VM(import_stat_cache_stale)) {
+        MP_STATE_VM(import_stat_cache_stale) = false;
+        mp_map_clear(cache);
+    }
+    // look up with a str object on the stack so that a hit doesn't allocate
+    size_t len = strlen(path);
+    mp_obj_str_t key = {{&mp_type_str}, qstr_compute_hash((const byte*)path, len), len, (const byte*)path};
+    mp_map_elem_t *elem = mp_map_lookup(cache, MP_OBJ_FROM_PTR(&key), MP_MAP_LOOKUP);
+    if (elem != NULL) {
+        return MP_OBJ_SMALL_INT_VALUE(elem->value);
+    }
+    mp_import_stat_t stat = mp_import_stat(path);
+    if (!mp_vfs_import_stat_cacheable(path)) {
+        return stat;
+    }
+    if (cache->used >= MICROPY_MODULE_STAT_CACHE_MAX) {
+        mp_map_clear(cache);
+    }
+    mp_obj_t key_obj = mp_obj_new_str_copy(&mp_type_str, (const byte*)path, len);
+    mp_map_lookup(cache, key_obj, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = MP_OBJ_NEW_SMALL_INT(stat);
+    return stat;
+    #else
     return mp_import_stat(path);
+    #endif
 }
 
 STATIC mp_import_stat_t stat_file_py_or_mpy(vstr_t *path) {
@@ -122,7 +183,7 @@ STATIC mp_import_stat_t find_file(const char *file_str, uint file_len, vstr_t *d
             vstr_reset(dest);
             size_t p_len;
             const char *p = mp_obj_str_get_data(path_items[i], &p_len);
-            DEBUG_printf("Looking in path: %d =%s=\n", i, p);
+            DEBUG_printf("Looking in path: %d =%.*s=\n", i, (int)p_len, p);
             if (p_len > 0) {
                 vstr_add_strn(dest, p, p_len);
                 vstr_add_char(dest, PATH_SEP_CHAR);
@@ -191,6 +252,149 @@ STATIC void do_execute_raw_code(mp_obj_t module_obj, mp_raw_code_t *raw_code, co
 }
 #endif
 
+#if MICROPY_MODULE_BYTECODE_CACHE
+// The code compiled from dir/mod.py is cached in dir/.mpycache/mod.mpy.  That
+// file starts with a line identifying the source (its size, modification
+// time and path) and the compiler settings, and is only used if the line is
+// the same as for the source being imported.  The .mpy data follows it.
+
+STATIC mp_obj_t bytecode_cache_mtime(mp_obj_t path) {
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(mp_vfs_stat(path), 10, &items);
+    return items[8];
+}
+
+// Make the key for a source file, and return its modification time
+STATIC mp_obj_t bytecode_cache_key(vstr_t *key, const char *file_str) {
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(mp_vfs_stat(mp_obj_new_str(file_str, strlen(file_str))), 10, &items);
+    mp_print_t print;
+    vstr_init_print(key, 32, &print);
+    mp_obj_print_helper(&print, items[6], PRINT_STR); // size
+    vstr_add_char(key, ' ');
+    mp_obj_print_helper(&print, items[8], PRINT_STR); // mtime
+    mp_printf(&print, " %u %s\n", (uint)MP_STATE_VM(mp_optimise_value), file_str);
+    return items[8];
+}
+
+STATIC void bytecode_cache_path(vstr_t *path, const char *file_str, size_t file_len) {
+    const char *base = file_str + file_len;
+    while (base > file_str && base[-1] != PATH_SEP_CHAR) {
+        --base;
+    }
+    vstr_init(path, file_len + sizeof(MICROPY_MODULE_BYTECODE_CACHE_DIR) + 2);
+    vstr_add_strn(path, file_str, base - file_str);
+    vstr_add_str(path, MICROPY_MODULE_BYTECODE_CACHE_DIR);
+    vstr_add_char(path, PATH_SEP_CHAR);
+    vstr_add_strn(path, base, file_str + file_len - base - 2); // drop "py"
+    vstr_add_str(path, "mpy");
+}
+
+// Load the cached code for a module, or return NULL if there isn't any that
+// is up to date.
+STATIC mp_raw_code_t *bytecode_cache_load(const vstr_t *key, const char *cache_str) {
+    mp_raw_code_t *volatile raw_code = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_t reader;
+        mp_reader_new_file(&reader, cache_str);
+        size_t i = 0;
+        while (i < key->len && reader.readbyte(reader.data) == (byte)key->buf[i]) {
+            ++i;
+        }
+        if (i == key->len) {
+            raw_code = mp_raw_code_load(&reader);
+        } else {
+            reader.close(reader.data);
+        }
+        nlr_pop();
+    } else {
+        // no cache file, or it's corrupt or for a different version
+    }
+    return raw_code;
+}
+
+// Save code to the cache.  This is best effort: the filesystem may be
+// read-only or full, and the code may not be saveable (eg if it's native).
+// After a filesystem error nothing more is saved until the next soft reset or
+// micropython.bytecode_cache(True).
+STATIC void bytecode_cache_save(mp_raw_code_t *raw_code, const vstr_t *key, mp_obj_t mtime, vstr_t *cache_path) {
+    mp_obj_t path = mp_obj_new_str(cache_path->buf, cache_path->len);
+    mp_obj_t volatile file = MP_OBJ_NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // make the cache directory if it doesn't exist
+        char *dir_end = cache_path->buf + cache_path->len;
+        while (dir_end[-1] != PATH_SEP_CHAR) {
+            --dir_end;
+        }
+        dir_end[-1] = '\0';
+        if (mp_import_stat(cache_path->buf) != MP_IMPORT_STAT_DIR) {
+            mp_vfs_mkdir(mp_obj_new_str(cache_path->buf, dir_end - 1 - cache_path->buf));
+        }
+        dir_end[-1] = PATH_SEP_CHAR;
+
+        mp_obj_t args[2] = { path, MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+        file = mp_vfs_open(2, args, (mp_map_t*)&mp_const_empty_map);
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+        print.print_strn(print.data, key->buf, key->len);
+        mp_raw_code_save(raw_code, &print);
+        mp_stream_close(file);
+        file = MP_OBJ_NULL;
+
+        // If the source was written in the same tick of the filesystem's clock
+        // as the cache then it could still change without its key changing, so
+        // the cache can't be trusted.  Leave it to be made by a later import.
+        if (mp_obj_equal(bytecode_cache_mtime(path), mtime)) {
+            mp_vfs_remove(path);
+        }
+        nlr_pop();
+    } else {
+        // A filesystem that can't be written, such as CIRCUITPY while the host
+        // has it, fails like this on every import, so stop trying to save.
+        if (mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(mp_obj_get_type(MP_OBJ_FROM_PTR(nlr.ret_val))),
+            MP_OBJ_FROM_PTR(&mp_type_OSError))) {
+            MP_STATE_VM(bytecode_cache_writable) = false;
+        }
+        // don't leave an incomplete file behind
+        if (file != MP_OBJ_NULL && nlr_push(&nlr) == 0) {
+            mp_stream_close(file);
+            mp_vfs_remove(path);
+            nlr_pop();
+        }
+    }
+}
+
+// Import a .py file, using the cached code for it if there is any.
+STATIC void do_load_cached(mp_obj_t module_obj, vstr_t *file) {
+    const char *file_str = vstr_null_terminated_str(file);
+    vstr_t key, cache_path;
+    mp_obj_t mtime = bytecode_cache_key(&key, file_str);
+    bytecode_cache_path(&cache_path, file_str, file->len);
+
+    mp_raw_code_t *raw_code = bytecode_cache_load(&key, vstr_null_terminated_str(&cache_path));
+    if (raw_code == NULL) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        raw_code = mp_compile_to_raw_code(&parse_tree, source_name, MP_EMIT_OPT_NONE, false);
+        if (MP_STATE_VM(bytecode_cache_writable)) {
+            bytecode_cache_save(raw_code, &key, mtime, &cache_path);
+        }
+    }
+    #if MICROPY_JIT
+    else {
+        // the cached code was compiled from the source as it is now
+        mp_jit_note_source(qstr_from_str(file_str));
+    }
+    #endif
+    vstr_clear(&key);
+    vstr_clear(&cache_path);
+
+    do_execute_raw_code(module_obj, raw_code, file_str);
+}
+#endif
+
 STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     #if MICROPY_MODULE_FROZEN || MICROPY_PERSISTENT_CODE_LOAD || MICROPY_ENABLE_COMPILER
     char *file_str = vstr_null_terminated_str(file);
@@ -241,6 +445,12 @@ STATIC void do_load(mp_obj_t module_obj, vstr_t *file) {
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
+        #if MICROPY_MODULE_BYTECODE_CACHE
+        if (MP_STATE_VM(bytecode_cache_enabled)) {
+            do_load_cached(module_obj, file);
+            return;
+        }
+        #endif
         mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
         do_load_from_lexer(module_obj, lex);
         return;
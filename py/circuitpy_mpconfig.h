@@ -191,12 +191,34 @@ typedef long mp_off_t;
 #define MICROPY_COMP_FSTRING_LITERAL          (MICROPY_CPYTHON_COMPAT)
 #endif
 #define MICROPY_MODULE_WEAK_LINKS             (CIRCUITPY_FULL_BUILD)
+#ifndef MICROPY_MODULE_BYTECODE_CACHE
+#define MICROPY_MODULE_BYTECODE_CACHE         (CIRCUITPY_FULL_BUILD)
+#endif
+#define MICROPY_PERSISTENT_CODE_SAVE          (MICROPY_MODULE_BYTECODE_CACHE)
+#ifndef MICROPY_MODULE_STAT_CACHE
+#define MICROPY_MODULE_STAT_CACHE             (CIRCUITPY_FULL_BUILD)
+#endif
+#ifndef MICROPY_PY_UPROFILE
+#define MICROPY_PY_UPROFILE                   (CIRCUITPY_FULL_BUILD)
+#endif
+#ifndef MICROPY_PY_UJSON_ITERPARSE
+#define MICROPY_PY_UJSON_ITERPARSE            (CIRCUITPY_FULL_BUILD)
+#endif
+#ifndef MICROPY_VFS_FAT_WRITEBEHIND
+#define MICROPY_VFS_FAT_WRITEBEHIND           (CIRCUITPY_FULL_BUILD)
+#endif
+#ifndef MICROPY_FRAME_ARENA_SIZE
+#define MICROPY_FRAME_ARENA_SIZE              (CIRCUITPY_FULL_BUILD ? 1024 : 256)
+#endif
 #define MICROPY_PY_ALL_SPECIAL_METHODS        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_COMPLEX           (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_FROZENSET         (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_CENTER        (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_PARTITION     (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_BUILTINS_STR_SPLITLINES    (CIRCUITPY_FULL_BUILD)
+#ifndef MICROPY_QSTR_HASH_INDEX
+#define MICROPY_QSTR_HASH_INDEX               (CIRCUITPY_FULL_BUILD)
+#endif
 #define MICROPY_PY_UERRNO                     (CIRCUITPY_FULL_BUILD)
 // Opposite setting is deliberate.
 #define MICROPY_PY_UERRNO_ERRORCODE           (!CIRCUITPY_FULL_BUILD)
@@ -206,6 +228,8 @@ typedef long mp_off_t;
 #define MICROPY_PY_URE_MATCH_GROUPS           (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_MATCH_SPAN_START_END   (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_SUB                    (CIRCUITPY_FULL_BUILD)
+#define MICROPY_PY_URE_CACHE_SIZE             (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#define MICROPY_PY_URE_PIKEVM                 (CIRCUITPY_FULL_BUILD)
 
 // LONGINT_IMPL_xxx are defined in the Makefile.
 //
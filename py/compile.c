@@ -35,6 +35,13 @@
 #include "py/compile.h"
 #include "py/runtime.h"
 #include "py/asmbase.h"
+#include "py/persistentcode.h"
+#include "py/objtuple.h"
+#if MICROPY_JIT
+#include "py/bc.h"
+#include "py/bc0.h"
+#include "py/gc.h"
+#endif
 
 #include "supervisor/shared/translate.h"
 
@@ -135,6 +142,7 @@ typedef struct _compiler_t {
     uint16_t cur_except_level; // increased for SETUP_EXCEPT, SETUP_FINALLY; decreased for POP_BLOCK, POP_EXCEPT
     uint16_t break_continue_except_level;
 
+    mp_parse_tree_t *parse_tree; // also the arena that scopes are allocated from
     scope_t *scope_head;
     scope_t *scope_cur;
 
@@ -147,6 +155,11 @@ typedef struct _compiler_t {
     emit_inline_asm_t *emit_inline_asm;                                   // current emitter for inline asm
     const emit_inline_asm_method_table_t *emit_inline_asm_method_table;   // current emit method table for inline asm
     #endif
+
+    #if MICROPY_JIT
+    const mp_obj_fun_bc_t *jit_fun; // function to compile as native code, see mp_compile_jit
+    scope_t *jit_scope; // the scope that jit_fun was compiled from, once it's found
+    #endif
 } compiler_t;
 
 STATIC void compile_error_set_line(compiler_t *comp, mp_parse_node_t pn) {
@@ -185,7 +198,7 @@ STATIC void compile_decrease_except_level(compiler_t *comp) {
 }
 
 STATIC scope_t *scope_new_and_link(compiler_t *comp, scope_kind_t kind, mp_parse_node_t pn, uint emit_options) {
-    scope_t *scope = scope_new(kind, pn, comp->source_file, emit_options);
+    scope_t *scope = scope_new(comp->parse_tree, kind, pn, comp->source_file, emit_options);
     scope->parent = comp->scope_cur;
     scope->next = NULL;
     if (comp->scope_head == NULL) {
@@ -262,7 +275,102 @@ STATIC void compile_delete_id(compiler_t *comp, qstr qst) {
     }
 }
 
+#if MICROPY_COMP_CONST_TUPLE
+STATIC mp_obj_t get_const_object(mp_parse_node_struct_t *pns);
+
+STATIC bool mp_parse_node_is_const(mp_parse_node_t pn) {
+    if (MP_PARSE_NODE_IS_SMALL_INT(pn)) {
+        return true;
+    } else if (MP_PARSE_NODE_IS_LEAF(pn)) {
+        uintptr_t kind = MP_PARSE_NODE_LEAF_KIND(pn);
+        uintptr_t arg = MP_PARSE_NODE_LEAF_ARG(pn);
+        return kind == MP_PARSE_NODE_STRING
+            || kind == MP_PARSE_NODE_BYTES
+            || (kind == MP_PARSE_NODE_TOKEN
+                && (arg == MP_TOKEN_KW_NONE
+                    || arg == MP_TOKEN_KW_FALSE
+                    || arg == MP_TOKEN_KW_TRUE
+                    || arg == MP_TOKEN_ELLIPSIS));
+    } else {
+        return MP_PARSE_NODE_IS_STRUCT_KIND(pn, PN_const_object);
+    }
+}
+
+STATIC mp_obj_t mp_parse_node_convert_to_obj(mp_parse_node_t pn) {
+    if (MP_PARSE_NODE_IS_SMALL_INT(pn)) {
+        return MP_OBJ_NEW_SMALL_INT(MP_PARSE_NODE_LEAF_SMALL_INT(pn));
+    } else if (MP_PARSE_NODE_IS_LEAF(pn)) {
+        uintptr_t arg = MP_PARSE_NODE_LEAF_ARG(pn);
+        switch (MP_PARSE_NODE_LEAF_KIND(pn)) {
+            case MP_PARSE_NODE_STRING:
+                return MP_OBJ_NEW_QSTR(arg);
+            case MP_PARSE_NODE_BYTES: {
+                size_t len;
+                const byte *data = qstr_data(arg, &len);
+                return mp_obj_new_bytes(data, len);
+            }
+            default:
+                if (arg == MP_TOKEN_KW_NONE) {
+                    return mp_const_none;
+                } else if (arg == MP_TOKEN_KW_FALSE) {
+                    return mp_const_false;
+                } else if (arg == MP_TOKEN_KW_TRUE) {
+                    return mp_const_true;
+                } else {
+                    assert(arg == MP_TOKEN_ELLIPSIS);
+                    return MP_OBJ_FROM_PTR(&mp_const_ellipsis_obj);
+                }
+        }
+    } else {
+        return get_const_object((mp_parse_node_struct_t*)pn);
+    }
+}
+
+// a tuple of constants is made once, here, rather than built each time it's evaluated
+STATIC bool c_tuple_const(compiler_t *comp, mp_parse_node_t pn, mp_parse_node_struct_t *pns_list) {
+    size_t n = 0;
+    if (!MP_PARSE_NODE_IS_NULL(pn)) {
+        if (!mp_parse_node_is_const(pn)) {
+            return false;
+        }
+        n += 1;
+    }
+    if (pns_list != NULL) {
+        for (size_t i = 0; i < MP_PARSE_NODE_STRUCT_NUM_NODES(pns_list); i++) {
+            if (!mp_parse_node_is_const(pns_list->nodes[i])) {
+                return false;
+            }
+        }
+        n += MP_PARSE_NODE_STRUCT_NUM_NODES(pns_list);
+    }
+
+    // only create and load the actual tuple object on the last pass
+    if (comp->pass != MP_PASS_EMIT) {
+        EMIT_ARG(load_const_obj, mp_const_none);
+    } else {
+        mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(n, NULL));
+        size_t i = 0;
+        if (!MP_PARSE_NODE_IS_NULL(pn)) {
+            tuple->items[i++] = mp_parse_node_convert_to_obj(pn);
+        }
+        if (pns_list != NULL) {
+            for (size_t j = 0; j < MP_PARSE_NODE_STRUCT_NUM_NODES(pns_list); j++) {
+                tuple->items[i++] = mp_parse_node_convert_to_obj(pns_list->nodes[j]);
+            }
+        }
+        EMIT_ARG(load_const_obj, MP_OBJ_FROM_PTR(tuple));
+    }
+    return true;
+}
+#endif
+
 STATIC void c_tuple(compiler_t *comp, mp_parse_node_t pn, mp_parse_node_struct_t *pns_list) {
+    #if MICROPY_COMP_CONST_TUPLE
+    if (c_tuple_const(comp, pn, pns_list)) {
+        return;
+    }
+    #endif
+
     int total = 0;
     if (!MP_PARSE_NODE_IS_NULL(pn)) {
         compile_node(comp, pn);
@@ -798,6 +906,18 @@ STATIC bool compile_built_in_decorator(compiler_t *comp, int name_len, mp_parse_
         compile_syntax_error(comp, name_nodes[1], translate("invalid micropython decorator"));
     }
 
+    #if MICROPY_DYNAMIC_COMPILER && MICROPY_EMIT_NATIVE
+    // native code can only be emitted once the target architecture is known
+    if (mp_dynamic_compiler.native_arch == MP_NATIVE_ARCH_NONE) {
+        if (*emit_options == MP_EMIT_OPT_NATIVE_PYTHON) {
+            // like above when native support isn't compiled, fall back to bytecode
+            *emit_options = MP_EMIT_OPT_BYTECODE;
+        } else if (*emit_options == MP_EMIT_OPT_VIPER) {
+            compile_syntax_error(comp, name_nodes[1], translate("invalid arch"));
+        }
+    }
+    #endif
+
     return true;
 }
 
@@ -3261,7 +3381,11 @@ STATIC void compile_scope_inline_asm(compiler_t *comp, scope_t *scope, pass_kind
             void *f = mp_asm_base_get_code((mp_asm_base_t*)comp->emit_inline_asm);
             mp_emit_glue_assign_native(comp->scope_cur->raw_code, MP_CODE_NATIVE_ASM,
                 f, mp_asm_base_get_code_size((mp_asm_base_t*)comp->emit_inline_asm),
-                NULL, comp->scope_cur->num_pos_args, 0, type_sig);
+                NULL,
+                #if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+                NULL, 0,
+                #endif
+                comp->scope_cur->num_pos_args, 0, type_sig);
         }
     }
 
@@ -3351,20 +3475,254 @@ STATIC void scope_compute_things(scope_t *scope) {
             scope->num_locals += num_free;
         }
     }
+
+    // let the call path copy the args straight in if there are only positional ones
+    if ((scope->scope_flags & (MP_SCOPE_FLAG_VARARGS | MP_SCOPE_FLAG_VARKEYWORDS | MP_SCOPE_FLAG_DEFKWARGS)) == 0
+        && scope->num_kwonly_args == 0 && scope->num_def_pos_args == 0) {
+        scope->scope_flags |= MP_SCOPE_FLAG_SIMPLE_ARGS;
+    }
 }
 
-#if !MICROPY_PERSISTENT_CODE_SAVE
-STATIC
+#if MICROPY_JIT
+// Whether two constants loaded by LOAD_CONST_OBJ are the same.  They must be
+// of the same type, because eg 1.0 == 1, and floats are compared by their bits
+// so that 0.0 and -0.0 differ.
+STATIC bool compile_jit_const_matches(mp_obj_t a, mp_obj_t b) {
+    if (mp_obj_get_type(a) != mp_obj_get_type(b)) {
+        return false;
+    }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (mp_obj_is_float(a)) {
+        mp_float_t fa = mp_obj_float_get(a);
+        mp_float_t fb = mp_obj_float_get(b);
+        return memcmp(&fa, &fb, sizeof(mp_float_t)) == 0;
+    }
+    #endif
+    if (MP_OBJ_IS_TYPE(a, &mp_type_tuple)) {
+        size_t len_a, len_b;
+        mp_obj_t *items_a, *items_b;
+        mp_obj_tuple_get(a, &len_a, &items_a);
+        mp_obj_tuple_get(b, &len_b, &items_b);
+        if (len_a != len_b) {
+            return false;
+        }
+        for (size_t i = 0; i < len_a; ++i) {
+            if (!compile_jit_const_matches(items_a[i], items_b[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+    return mp_obj_equal(a, b);
+}
+
+// Size of the opcode at ip, and in *n the size of the part of it that doesn't
+// change as the VM runs
+STATIC size_t compile_jit_opcode_size(const byte *ip, size_t *n) {
+    size_t sz;
+    uint f = mp_opcode_format(ip, &sz);
+    *n = sz;
+    #if MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE
+    if (f == MP_OPCODE_QSTR && (*ip == MP_BC_LOAD_NAME || *ip == MP_BC_LOAD_GLOBAL
+        || *ip == MP_BC_LOAD_ATTR || *ip == MP_BC_STORE_ATTR)) {
+        sz += 1; // cache byte
+    }
+    #else
+    (void)f;
+    #endif
+    return sz;
+}
+
+// Whether the bytecode emitted for scope s, and for the scopes it makes
+// functions from, is the same as fun_code with fun_const_table.  Constant
+// objects and child raw code are loaded by their index in the const table, so
+// the entries they index are compared too.  The VM writes to the bytes that
+// cache map lookups, so they aren't compared.
+STATIC bool compile_jit_code_matches(compiler_t *comp, scope_t *s, const byte *fun_code, const mp_uint_t *fun_const_table) {
+    if (s->raw_code->kind != MP_CODE_BYTECODE) {
+        return false;
+    }
+    const byte *code = s->raw_code->data.u_byte.bytecode;
+    const mp_uint_t *const_table = s->raw_code->data.u_byte.const_table;
+    const byte *top = code + s->jit_code_size;
+
+    // the function's bytecode is on the heap, so it can be read up to the end
+    // of its allocation even if it's shorter than this code
+    if ((size_t)(top - code) > gc_nbytes(fun_code)) {
+        return false;
+    }
+
+    // the prelude, code info and closed over locals must be the same
+    const byte *ip = code;
+    ip = mp_decode_uint_skip(ip); // skip n_state
+    ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+    ip += 4; // skip scope_flags, n_pos_args, n_kwonly_args, n_def_pos_args
+    ip += mp_decode_uint_value(ip); // skip code info
+    while (*ip++ != 255) {
+    }
+    if (memcmp(code, fun_code, ip - code) != 0) {
+        return false;
+    }
+
+    // so are the names of the args, at the start of the const table
+    for (size_t i = 0; i < (size_t)s->num_pos_args + s->num_kwonly_args; ++i) {
+        if (const_table[i] != fun_const_table[i]) {
+            return false;
+        }
+    }
+
+    // then each opcode, and the constants and raw code it refers to
+    while (ip < top) {
+        size_t n;
+        size_t sz = compile_jit_opcode_size(ip, &n);
+        if (memcmp(ip, fun_code + (ip - code), n) != 0) {
+            return false;
+        }
+        if (*ip == MP_BC_LOAD_CONST_OBJ) {
+            mp_uint_t i = mp_decode_uint_value(ip + 1);
+            if (!compile_jit_const_matches((mp_obj_t)const_table[i], (mp_obj_t)fun_const_table[i])) {
+                return false;
+            }
+        } else if (*ip == MP_BC_MAKE_FUNCTION || *ip == MP_BC_MAKE_FUNCTION_DEFARGS
+            || *ip == MP_BC_MAKE_CLOSURE || *ip == MP_BC_MAKE_CLOSURE_DEFARGS) {
+            mp_uint_t i = mp_decode_uint_value(ip + 1);
+            const mp_raw_code_t *fun_rc = (const mp_raw_code_t*)fun_const_table[i];
+            if (fun_rc->kind != MP_CODE_BYTECODE) {
+                return false;
+            }
+            scope_t *child = comp->scope_head;
+            while (child->raw_code != (mp_raw_code_t*)const_table[i]) {
+                child = child->next;
+            }
+            if (!compile_jit_code_matches(comp, child, fun_rc->data.u_byte.bytecode, fun_rc->data.u_byte.const_table)) {
+                return false;
+            }
+        }
+        ip += sz;
+    }
+    return true;
+}
+
+// Whether the native emitter can compile scope s to code that behaves as its
+// bytecode does.  Native code doesn't check for unbound locals, and doesn't
+// fully support exception handlers, with, or raise without exactly one
+// argument, so functions that use any of these, or del a local, or may load a
+// local that no path to the load has stored, are left as bytecode.
+STATIC bool compile_jit_code_supported(scope_t *s) {
+    if (s->num_locals > 8 * sizeof(mp_uint_t)) {
+        return false;
+    }
+
+    const byte *code = s->raw_code->data.u_byte.bytecode;
+    const byte *ip = code;
+    ip = mp_decode_uint_skip(ip); // skip n_state
+    ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+    ip += 4; // skip scope_flags, n_pos_args, n_kwonly_args, n_def_pos_args
+    ip += mp_decode_uint_value(ip); // skip code info
+    while (*ip++ != 255) {
+    }
+    const byte *start = ip;
+    size_t len = code + s->jit_code_size - start;
+
+    // the locals stored on every path to each offset found so far, a bit per
+    // local; the args are stored on entry
+    mp_uint_t *assigned = m_new(mp_uint_t, len);
+    for (size_t i = 0; i < len; ++i) {
+        assigned[i] = ~(mp_uint_t)0;
+    }
+    size_t n_args = s->num_pos_args + s->num_kwonly_args
+        + ((s->scope_flags & MP_SCOPE_FLAG_VARARGS) != 0)
+        + ((s->scope_flags & MP_SCOPE_FLAG_VARKEYWORDS) != 0);
+    if (len > 0 && n_args < 8 * sizeof(mp_uint_t)) {
+        assigned[0] = ((mp_uint_t)1 << n_args) - 1;
+    }
+
+    // go over the code until what's stored at each offset stops changing
+    bool supported = true;
+    bool changed = true;
+    while (supported && changed) {
+        changed = false;
+        for (ip = start; ip < start + len && supported;) {
+            size_t n;
+            size_t sz = compile_jit_opcode_size(ip, &n);
+            mp_uint_t stored = assigned[ip - start];
+            const byte *target = NULL;
+            bool falls_through = true;
+            byte op = *ip;
+            if (op == MP_BC_LOAD_FAST_N || op == MP_BC_LOAD_DEREF) {
+                supported = (stored >> mp_decode_uint_value(ip + 1)) & 1;
+            } else if (op >= MP_BC_LOAD_FAST_MULTI && op < MP_BC_LOAD_FAST_MULTI + 16) {
+                supported = (stored >> (op - MP_BC_LOAD_FAST_MULTI)) & 1;
+            } else if (op == MP_BC_STORE_FAST_N || op == MP_BC_STORE_DEREF) {
+                stored |= (mp_uint_t)1 << mp_decode_uint_value(ip + 1);
+            } else if (op >= MP_BC_STORE_FAST_MULTI && op < MP_BC_STORE_FAST_MULTI + 16) {
+                stored |= (mp_uint_t)1 << (op - MP_BC_STORE_FAST_MULTI);
+            } else if (op == MP_BC_JUMP || op == MP_BC_UNWIND_JUMP
+                || op == MP_BC_POP_JUMP_IF_TRUE || op == MP_BC_POP_JUMP_IF_FALSE
+                || op == MP_BC_JUMP_IF_TRUE_OR_POP || op == MP_BC_JUMP_IF_FALSE_OR_POP) {
+                target = ip + 3 + (ip[1] | (ip[2] << 8)) - 0x8000;
+                falls_through = op != MP_BC_JUMP && op != MP_BC_UNWIND_JUMP;
+            } else if (op == MP_BC_FOR_ITER) {
+                target = ip + 3 + (ip[1] | (ip[2] << 8));
+            } else if (op == MP_BC_RETURN_VALUE) {
+                falls_through = false;
+            } else if (op == MP_BC_RAISE_VARARGS) {
+                supported = ip[1] == 1;
+                falls_through = false;
+            } else if (op == MP_BC_DELETE_FAST || op == MP_BC_DELETE_DEREF
+                || op == MP_BC_SETUP_WITH || op == MP_BC_SETUP_EXCEPT || op == MP_BC_SETUP_FINALLY) {
+                supported = false;
+            }
+            if (target != NULL) {
+                if (target < start || target >= start + len) {
+                    supported = false;
+                } else if ((assigned[target - start] & stored) != assigned[target - start]) {
+                    assigned[target - start] &= stored;
+                    changed = true;
+                }
+            }
+            ip += sz;
+            if (falls_through && ip < start + len && (assigned[ip - start] & stored) != assigned[ip - start]) {
+                assigned[ip - start] &= stored;
+                changed = true;
+            }
+        }
+    }
+
+    m_del(mp_uint_t, assigned, len);
+    return supported;
+}
+
+// Whether scope s is the function comp->jit_fun was made from, and can be
+// compiled to native code
+STATIC bool compile_jit_scope_matches(compiler_t *comp, scope_t *s) {
+    if (!SCOPE_IS_FUNC_LIKE(s->kind)
+        || (s->scope_flags & MP_SCOPE_FLAG_GENERATOR) != 0
+        || s->emit_options != MP_EMIT_OPT_NONE) {
+        return false;
+    }
+    return compile_jit_code_matches(comp, s, comp->jit_fun->bytecode, comp->jit_fun->const_table)
+        && compile_jit_code_supported(s);
+}
 #endif
-mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl) {
+
+STATIC mp_raw_code_t *compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl
+    #if MICROPY_JIT
+    , const mp_obj_fun_bc_t *jit_fun
+    #endif
+    ) {
     // put compiler state on the stack, it's relatively small
     compiler_t comp_state = {0};
     compiler_t *comp = &comp_state;
 
     comp->source_file = source_file;
+    comp->parse_tree = parse_tree;
     comp->is_repl = is_repl;
     comp->break_label = INVALID_LABEL;
     comp->continue_label = INVALID_LABEL;
+    #if MICROPY_JIT
+    comp->jit_fun = jit_fun;
+    #endif
 
     // create the module scope
     scope_t *module_scope = scope_new_and_link(comp, SCOPE_MODULE, parse_tree->root, emit_opt);
@@ -3468,8 +3826,47 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
             if (comp->compile_error == MP_OBJ_NULL) {
                 compile_scope(comp, s, MP_PASS_EMIT);
             }
+
+            #if MICROPY_JIT
+            if (comp->emit == emit_bc && comp->compile_error == MP_OBJ_NULL) {
+                s->jit_code_size = mp_emit_bc_get_code_size(emit_bc);
+            }
+            #endif
+        }
+    }
+
+    #if MICROPY_JIT
+    // child scopes are emitted after their parent, so only now can a function
+    // be compared with the one to compile, along with the functions it makes
+    if (comp->jit_fun != NULL && comp->compile_error == MP_OBJ_NULL) {
+        for (scope_t *s = comp->scope_head; s != NULL; s = s->next) {
+            if (compile_jit_scope_matches(comp, s)) {
+                comp->jit_scope = s;
+                break;
+            }
+        }
+    }
+    if (comp->jit_scope != NULL && comp->compile_error == MP_OBJ_NULL) {
+        // compile the function again as native code, which replaces the
+        // bytecode in its raw code
+        scope_t *s = comp->jit_scope;
+        s->emit_options = MP_EMIT_OPT_NATIVE_PYTHON;
+        if (emit_native == NULL) {
+            emit_native = NATIVE_EMITTER(new)(&comp->compile_error, max_num_labels);
+        }
+        comp->emit_method_table = &NATIVE_EMITTER(method_table);
+        comp->emit = emit_native;
+        EMIT_ARG(set_native_type, MP_EMIT_NATIVE_TYPE_ENABLE, false, 0);
+        EMIT_ARG(set_native_type, MP_EMIT_NATIVE_TYPE_JIT, 0, 0);
+        compile_scope(comp, s, MP_PASS_STACK_SIZE);
+        if (comp->compile_error == MP_OBJ_NULL) {
+            compile_scope(comp, s, MP_PASS_CODE_SIZE);
+        }
+        if (comp->compile_error == MP_OBJ_NULL) {
+            compile_scope(comp, s, MP_PASS_EMIT);
         }
     }
+    #endif
 
     if (comp->compile_error != MP_OBJ_NULL) {
         // if there is no line number for the error then use the line
@@ -3494,16 +3891,15 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
     }
     #endif
 
-    // free the parse tree
-    mp_parse_tree_clear(parse_tree);
-
-    // free the scopes
     mp_raw_code_t *outer_raw_code = module_scope->raw_code;
-    for (scope_t *s = module_scope; s;) {
-        scope_t *next = s->next;
-        scope_free(s);
-        s = next;
+    #if MICROPY_JIT
+    if (comp->jit_fun != NULL) {
+        outer_raw_code = comp->jit_scope == NULL ? NULL : comp->jit_scope->raw_code;
     }
+    #endif
+
+    // free the parse tree, and with it the scopes
+    mp_parse_tree_clear(parse_tree);
 
     if (comp->compile_error != MP_OBJ_NULL) {
         nlr_raise(comp->compile_error);
@@ -3512,6 +3908,23 @@ mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_f
     }
 }
 
+#if !MICROPY_PERSISTENT_CODE_SAVE
+STATIC
+#endif
+mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl) {
+    return compile_to_raw_code(parse_tree, source_file, emit_opt, is_repl
+        #if MICROPY_JIT
+        , NULL
+        #endif
+        );
+}
+
+#if MICROPY_JIT
+mp_raw_code_t *mp_compile_jit(mp_parse_tree_t *parse_tree, qstr source_file, const mp_obj_fun_bc_t *fun) {
+    return compile_to_raw_code(parse_tree, source_file, MP_EMIT_OPT_NONE, false, fun);
+}
+#endif
+
 mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl) {
     mp_raw_code_t *rc = mp_compile_to_raw_code(parse_tree, source_file, emit_opt, is_repl);
     // return function that executes the outer module
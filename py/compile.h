@@ -29,6 +29,7 @@
 #include "py/lexer.h"
 #include "py/parse.h"
 #include "py/emitglue.h"
+#include "py/objfun.h"
 
 // These must fit in 8 bits; see scope.h
 enum {
@@ -48,6 +49,12 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt
 mp_raw_code_t *mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, uint emit_opt, bool is_repl);
 #endif
 
+#if MICROPY_JIT
+// compile the module again, with the function whose bytecode is that of fun
+// compiled as native code, and return its raw code (or NULL if fun isn't found)
+mp_raw_code_t *mp_compile_jit(mp_parse_tree_t *parse_tree, qstr source_file, const mp_obj_fun_bc_t *fun);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
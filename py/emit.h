@@ -54,6 +54,7 @@ typedef enum {
 #define MP_EMIT_NATIVE_TYPE_ENABLE (0)
 #define MP_EMIT_NATIVE_TYPE_RETURN (1)
 #define MP_EMIT_NATIVE_TYPE_ARG    (2)
+#define MP_EMIT_NATIVE_TYPE_JIT    (3)
 
 // Kind for emit_id_ops->local()
 #define MP_EMIT_IDOP_LOCAL_FAST (0)
@@ -196,6 +197,9 @@ void emit_native_xtensa_free(emit_t *emit);
 void mp_emit_bc_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope);
 void mp_emit_bc_end_pass(emit_t *emit);
 bool mp_emit_bc_last_emit_was_return_value(emit_t *emit);
+#if MICROPY_JIT
+size_t mp_emit_bc_get_code_size(emit_t *emit);
+#endif
 void mp_emit_bc_adjust_stack_size(emit_t *emit, mp_int_t delta);
 void mp_emit_bc_set_source_line(emit_t *emit, mp_uint_t line);
 
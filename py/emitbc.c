@@ -452,6 +452,12 @@ bool mp_emit_bc_last_emit_was_return_value(emit_t *emit) {
     return emit->last_emit_was_return_value;
 }
 
+#if MICROPY_JIT
+size_t mp_emit_bc_get_code_size(emit_t *emit) {
+    return emit->code_info_size + emit->bytecode_size;
+}
+#endif
+
 void mp_emit_bc_adjust_stack_size(emit_t *emit, mp_int_t delta) {
     if (emit->pass == MP_PASS_SCOPE) {
         return;
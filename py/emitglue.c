@@ -86,7 +86,11 @@ void mp_emit_glue_assign_bytecode(mp_raw_code_t *rc, const byte *code,
 }
 
 #if MICROPY_EMIT_NATIVE || MICROPY_EMIT_INLINE_ASM
-void mp_emit_glue_assign_native(mp_raw_code_t *rc, mp_raw_code_kind_t kind, void *fun_data, mp_uint_t fun_len, const mp_uint_t *const_table, mp_uint_t n_pos_args, mp_uint_t scope_flags, mp_uint_t type_sig) {
+void mp_emit_glue_assign_native(mp_raw_code_t *rc, mp_raw_code_kind_t kind, void *fun_data, mp_uint_t fun_len, const mp_uint_t *const_table,
+    #if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+    const mp_native_reloc_t *reloc, size_t n_reloc,
+    #endif
+    mp_uint_t n_pos_args, mp_uint_t scope_flags, mp_uint_t type_sig) {
     assert(kind == MP_CODE_NATIVE_PY || kind == MP_CODE_NATIVE_VIPER || kind == MP_CODE_NATIVE_ASM);
     rc->kind = kind;
     rc->scope_flags = scope_flags;
@@ -94,6 +98,11 @@ void mp_emit_glue_assign_native(mp_raw_code_t *rc, mp_raw_code_kind_t kind, void
     rc->data.u_native.fun_data = fun_data;
     rc->data.u_native.const_table = const_table;
     rc->data.u_native.type_sig = type_sig;
+    #if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+    rc->data.u_native.fun_len = fun_len;
+    rc->data.u_native.reloc = reloc;
+    rc->data.u_native.n_reloc = n_reloc;
+    #endif
 
 #ifdef DEBUG_PRINT
     DEBUG_printf("assign native: kind=%d fun=%p len=" UINT_FMT " n_pos_args=" UINT_FMT " flags=%x\n", kind, fun_data, fun_len, n_pos_args, (uint)scope_flags);
@@ -144,6 +153,9 @@ mp_obj_t mp_make_function_from_raw_code(const mp_raw_code_t *rc, mp_obj_t def_ar
         #endif
         case MP_CODE_BYTECODE:
             fun = mp_obj_new_fun_bc(def_args, def_kw_args, rc->data.u_byte.bytecode, rc->data.u_byte.const_table);
+            #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+            ((mp_obj_fun_bc_t*)MP_OBJ_TO_PTR(fun))->qstr_map = rc->data.u_byte.qstr_map;
+            #endif
             break;
         default:
             // All other kinds are invalid.
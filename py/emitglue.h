@@ -39,6 +39,32 @@ typedef enum {
     MP_CODE_NATIVE_ASM,
 } mp_raw_code_kind_t;
 
+#if MICROPY_PERSISTENT_CODE_SAVE_NATIVE || MICROPY_PERSISTENT_CODE_LOAD_NATIVE
+// Kinds of value in native code that are only known once the code is loaded
+typedef enum {
+    MP_NATIVE_RELOC_FUN, // mp_fun_table[value], a machine word
+    MP_NATIVE_RELOC_QSTR, // qstr value, a machine word
+    MP_NATIVE_RELOC_QSTR16, // qstr value, 2 bytes in the prelude
+    MP_NATIVE_RELOC_QSTR_OBJ, // MP_OBJ_NEW_QSTR(value), a machine word
+    MP_NATIVE_RELOC_OBJ, // constant object, a machine word
+    MP_NATIVE_RELOC_RAW_CODE, // child raw code, a machine word
+} mp_native_reloc_kind_t;
+
+// Number of machine words that saved native code reserves for an nlr_buf_t,
+// since it doesn't know the nlr config of the runtime that loads it: enough
+// for any x64 one, with prev, ret_val, up to 10 registers, and the pystack or
+// frame arena pointer.  A runtime with a bigger nlr_buf_t can't load it.
+#define MP_NATIVE_NLR_BUF_SIZE (2 + 10 + 1)
+#endif
+
+#if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+typedef struct _mp_native_reloc_t {
+    uint32_t offset; // of the value within the code
+    uint32_t kind; // of type mp_native_reloc_kind_t
+    mp_uint_t value; // as described by the kind, in this runtime
+} mp_native_reloc_t;
+#endif
+
 typedef struct _mp_raw_code_t {
     mp_uint_t kind : 3; // of type mp_raw_code_kind_t
     mp_uint_t scope_flags : 7;
@@ -47,6 +73,9 @@ typedef struct _mp_raw_code_t {
         struct {
             const byte *bytecode;
             const mp_uint_t *const_table;
+            #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+            const uint16_t *qstr_map;
+            #endif
             #if MICROPY_PERSISTENT_CODE_SAVE
             mp_uint_t bc_len;
             uint16_t n_obj;
@@ -57,6 +86,11 @@ typedef struct _mp_raw_code_t {
             void *fun_data;
             const mp_uint_t *const_table;
             mp_uint_t type_sig; // for viper, compressed as 2-bit types; ret is MSB, then arg0, arg1, etc
+            #if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+            mp_uint_t fun_len;
+            const mp_native_reloc_t *reloc;
+            size_t n_reloc;
+            #endif
         } u_native;
     } data;
 } mp_raw_code_t;
@@ -72,7 +106,11 @@ void mp_emit_glue_assign_bytecode(mp_raw_code_t *rc, const byte *code,
     uint16_t n_obj, uint16_t n_raw_code,
     #endif
     mp_uint_t scope_flags);
-void mp_emit_glue_assign_native(mp_raw_code_t *rc, mp_raw_code_kind_t kind, void *fun_data, mp_uint_t fun_len, const mp_uint_t *const_table, mp_uint_t n_pos_args, mp_uint_t scope_flags, mp_uint_t type_sig);
+void mp_emit_glue_assign_native(mp_raw_code_t *rc, mp_raw_code_kind_t kind, void *fun_data, mp_uint_t fun_len, const mp_uint_t *const_table,
+    #if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+    const mp_native_reloc_t *reloc, size_t n_reloc,
+    #endif
+    mp_uint_t n_pos_args, mp_uint_t scope_flags, mp_uint_t type_sig);
 
 mp_obj_t mp_make_function_from_raw_code(const mp_raw_code_t *rc, mp_obj_t def_args, mp_obj_t def_kw_args);
 mp_obj_t mp_make_closure_from_raw_code(const mp_raw_code_t *rc, mp_uint_t n_closed_over, const mp_obj_t *args);
@@ -77,6 +77,23 @@
 // wrapper around everything in this file
 #if N_X64 || N_X86 || N_THUMB || N_ARM || N_XTENSA
 
+#if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+#if !N_X64
+#error "saving native code is only supported for x64"
+#endif
+// Emit code that can be saved to a .mpy file and relocated when it's loaded
+#define EMIT_NATIVE_LINK (1)
+#else
+#define EMIT_NATIVE_LINK (0)
+#endif
+
+// Number of stack slots taken by an nlr_buf_t
+#if EMIT_NATIVE_LINK
+#define NLR_BUF_SIZE (MP_NATIVE_NLR_BUF_SIZE)
+#else
+#define NLR_BUF_SIZE (sizeof(nlr_buf_t) / sizeof(mp_uint_t))
+#endif
+
 // define additional generic helper macros
 #define ASM_MOV_LOCAL_IMM_VIA(as, local_num, imm, reg_temp) \
     do { \
@@ -105,6 +122,7 @@ typedef enum {
     VTYPE_PTR8 = 0x00 | MP_NATIVE_TYPE_PTR8,
     VTYPE_PTR16 = 0x00 | MP_NATIVE_TYPE_PTR16,
     VTYPE_PTR32 = 0x00 | MP_NATIVE_TYPE_PTR32,
+    VTYPE_FLOAT = 0x00 | MP_NATIVE_TYPE_FLOAT,
 
     VTYPE_PTR_NONE = 0x50 | MP_NATIVE_TYPE_PTR,
 
@@ -122,6 +140,9 @@ STATIC qstr vtype_to_qstr(vtype_kind_t vtype) {
         case VTYPE_PTR8: return MP_QSTR_ptr8;
         case VTYPE_PTR16: return MP_QSTR_ptr16;
         case VTYPE_PTR32: return MP_QSTR_ptr32;
+        #if MICROPY_EMIT_NATIVE_FLOAT
+        case VTYPE_FLOAT: return MP_QSTR_float;
+        #endif
         case VTYPE_PTR_NONE: default: return MP_QSTR_None;
     }
 }
@@ -141,6 +162,12 @@ struct _emit_t {
 
     bool do_viper_types;
 
+    #if MICROPY_JIT
+    // compiling for the JIT, which needs line numbers stored as the code runs
+    bool jit;
+    mp_uint_t last_source_line;
+    #endif
+
     vtype_kind_t return_vtype;
 
     mp_uint_t local_vtype_alloc;
@@ -160,6 +187,12 @@ struct _emit_t {
 
     scope_t *scope;
 
+    #if EMIT_NATIVE_LINK
+    size_t reloc_alloc;
+    size_t reloc_len;
+    mp_native_reloc_t *reloc;
+    #endif
+
     ASM_T *as;
 };
 
@@ -176,6 +209,9 @@ void EXPORT_FUN(free)(emit_t *emit) {
     m_del_obj(ASM_T, emit->as);
     m_del(vtype_kind_t, emit->local_vtype, emit->local_vtype_alloc);
     m_del(stack_info_t, emit->stack_info, emit->stack_info_alloc);
+    #if EMIT_NATIVE_LINK
+    m_del(mp_native_reloc_t, emit->reloc, emit->reloc_alloc);
+    #endif
     m_del_obj(emit_t, emit);
 }
 
@@ -183,8 +219,17 @@ STATIC void emit_native_set_native_type(emit_t *emit, mp_uint_t op, mp_uint_t ar
     switch (op) {
         case MP_EMIT_NATIVE_TYPE_ENABLE:
             emit->do_viper_types = arg1;
+            #if MICROPY_JIT
+            emit->jit = false;
+            #endif
             break;
 
+        #if MICROPY_JIT
+        case MP_EMIT_NATIVE_TYPE_JIT:
+            emit->jit = true;
+            break;
+        #endif
+
         default: {
             vtype_kind_t type;
             switch (arg2) {
@@ -196,6 +241,9 @@ STATIC void emit_native_set_native_type(emit_t *emit, mp_uint_t op, mp_uint_t ar
                 case MP_QSTR_ptr8: type = VTYPE_PTR8; break;
                 case MP_QSTR_ptr16: type = VTYPE_PTR16; break;
                 case MP_QSTR_ptr32: type = VTYPE_PTR32; break;
+                #if MICROPY_EMIT_NATIVE_FLOAT
+                case MP_QSTR_float: type = VTYPE_FLOAT; break;
+                #endif
                 default: EMIT_NATIVE_VIPER_TYPE_ERROR(emit, translate("unknown type '%q'"), arg2); return;
             }
             if (op == MP_EMIT_NATIVE_TYPE_RETURN) {
@@ -209,6 +257,82 @@ STATIC void emit_native_set_native_type(emit_t *emit, mp_uint_t op, mp_uint_t ar
     }
 }
 
+#if EMIT_NATIVE_LINK
+STATIC void emit_native_add_reloc(emit_t *emit, mp_native_reloc_kind_t kind, mp_uint_t value, size_t size) {
+    if (emit->pass != MP_PASS_EMIT) {
+        return;
+    }
+    if (emit->reloc_len >= emit->reloc_alloc) {
+        emit->reloc = m_renew(mp_native_reloc_t, emit->reloc, emit->reloc_alloc, emit->reloc_alloc + 16);
+        emit->reloc_alloc += 16;
+    }
+    mp_native_reloc_t *r = &emit->reloc[emit->reloc_len++];
+    // the value was just written, and ends at the current position
+    r->offset = mp_asm_base_get_code_pos(&emit->as->base) - size;
+    r->kind = kind;
+    r->value = value;
+}
+
+// Load a value that's only known when the code is loaded.  It's stored in the
+// code as an aligned word and recorded so the loader can patch it.
+STATIC void emit_native_mov_reg_link(emit_t *emit, int reg_dest, mp_native_reloc_kind_t kind, mp_uint_t value) {
+    mp_uint_t imm;
+    switch (kind) {
+        case MP_NATIVE_RELOC_FUN: imm = (mp_uint_t)mp_fun_table[value]; break;
+        case MP_NATIVE_RELOC_QSTR_OBJ: imm = (mp_uint_t)MP_OBJ_NEW_QSTR(value); break;
+        default: imm = value; break;
+    }
+    ASM_MOV_REG_ALIGNED_IMM(emit->as, reg_dest, imm);
+    emit_native_add_reloc(emit, kind, value, ASM_WORD_SIZE);
+}
+
+// Whether an object pushed as an immediate lives in the runtime that loads the code
+STATIC bool emit_native_is_runtime_obj(mp_obj_t obj) {
+    return obj == mp_const_none || obj == mp_const_false || obj == mp_const_true
+        || obj == MP_OBJ_FROM_PTR(&mp_const_ellipsis_obj);
+}
+#endif
+
+// Load an immediate of the given type into a register
+STATIC void emit_native_mov_reg_imm(emit_t *emit, int reg_dest, vtype_kind_t vtype, mp_uint_t imm) {
+    #if EMIT_NATIVE_LINK
+    if (vtype == VTYPE_PYOBJ && MP_OBJ_IS_QSTR((mp_obj_t)imm)) {
+        emit_native_mov_reg_link(emit, reg_dest, MP_NATIVE_RELOC_QSTR_OBJ, MP_OBJ_QSTR_VALUE((mp_obj_t)imm));
+        return;
+    }
+    if (vtype == VTYPE_PYOBJ && emit_native_is_runtime_obj((mp_obj_t)imm)) {
+        emit_native_mov_reg_link(emit, reg_dest, MP_NATIVE_RELOC_OBJ, imm);
+        return;
+    }
+    #else
+    (void)vtype;
+    #endif
+    ASM_MOV_REG_IMM(emit->as, reg_dest, imm);
+}
+
+STATIC void emit_native_mov_local_imm_via(emit_t *emit, int local_num, vtype_kind_t vtype, mp_uint_t imm, int reg_temp) {
+    emit_native_mov_reg_imm(emit, reg_temp, vtype, imm);
+    ASM_MOV_LOCAL_REG(emit->as, local_num, reg_temp);
+}
+
+STATIC void emit_native_call_ind(emit_t *emit, mp_fun_kind_t fun_kind) {
+    #if EMIT_NATIVE_LINK
+    emit_native_mov_reg_link(emit, REG_TEMP0, MP_NATIVE_RELOC_FUN, fun_kind);
+    ASM_CALL_REG(emit->as, REG_TEMP0);
+    #else
+    ASM_CALL_IND(emit->as, mp_fun_table[fun_kind], fun_kind);
+    #endif
+}
+
+// Load a qstr argument for a runtime call
+STATIC void emit_native_mov_reg_qstr(emit_t *emit, int reg_dest, qstr qst) {
+    #if EMIT_NATIVE_LINK
+    emit_native_mov_reg_link(emit, reg_dest, MP_NATIVE_RELOC_QSTR, qst);
+    #else
+    ASM_MOV_REG_IMM(emit->as, reg_dest, qst);
+    #endif
+}
+
 STATIC void emit_pre_pop_reg(emit_t *emit, vtype_kind_t *vtype, int reg_dest);
 STATIC void emit_post_push_reg(emit_t *emit, vtype_kind_t vtype, int reg);
 STATIC void emit_native_load_fast(emit_t *emit, qstr qst, mp_uint_t local_num);
@@ -224,6 +348,12 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
     emit->stack_size = 0;
     emit->last_emit_was_return_value = false;
     emit->scope = scope;
+    #if EMIT_NATIVE_LINK
+    emit->reloc_len = 0;
+    #endif
+    #if MICROPY_JIT
+    emit->last_source_line = 0;
+    #endif
 
     // allocate memory for keeping track of the types of locals
     if (emit->local_vtype_alloc < scope->num_locals) {
@@ -328,6 +458,14 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
         // work out size of state (locals plus stack)
         emit->n_state = scope->num_locals + scope->stack_size;
 
+        #if MICROPY_JIT
+        if (emit->jit) {
+            // the value stack would otherwise overlap code_state.ip, where
+            // JIT code keeps the address it stores line numbers at
+            emit->stack_start = STATE_START;
+        }
+        #endif
+
         // allocate space on C-stack for code_state structure, which includes state
         ASM_ENTRY(emit->as, STATE_START + emit->n_state);
 
@@ -358,12 +496,18 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
         ASM_MOV_REG_LOCAL_ADDR(emit->as, REG_ARG_1, 0);
 
         // call mp_setup_code_state to prepare code_state structure
+        int setup_code_state = MP_F_SETUP_CODE_STATE;
+        #if MICROPY_JIT
+        if (emit->jit) {
+            setup_code_state = MP_F_JIT_SETUP_CODE_STATE;
+        }
+        #endif
         #if N_THUMB
-        asm_thumb_bl_ind(emit->as, mp_fun_table[MP_F_SETUP_CODE_STATE], MP_F_SETUP_CODE_STATE, ASM_THUMB_REG_R4);
+        asm_thumb_bl_ind(emit->as, mp_fun_table[setup_code_state], setup_code_state, ASM_THUMB_REG_R4);
         #elif N_ARM
-        asm_arm_bl_ind(emit->as, mp_fun_table[MP_F_SETUP_CODE_STATE], MP_F_SETUP_CODE_STATE, ASM_ARM_REG_R4);
+        asm_arm_bl_ind(emit->as, mp_fun_table[setup_code_state], setup_code_state, ASM_ARM_REG_R4);
         #else
-        ASM_CALL_IND(emit->as, mp_fun_table[MP_F_SETUP_CODE_STATE], MP_F_SETUP_CODE_STATE);
+        emit_native_call_ind(emit, setup_code_state);
         #endif
 
         // cache some locals in registers
@@ -408,8 +552,14 @@ STATIC void emit_native_end_pass(emit_t *emit) {
         mp_asm_base_data(&emit->as->base, 1, 5);
         mp_asm_base_data(&emit->as->base, 1, emit->scope->simple_name);
         mp_asm_base_data(&emit->as->base, 1, emit->scope->simple_name >> 8);
+        #if EMIT_NATIVE_LINK
+        emit_native_add_reloc(emit, MP_NATIVE_RELOC_QSTR16, emit->scope->simple_name, 2);
+        #endif
         mp_asm_base_data(&emit->as->base, 1, emit->scope->source_file);
         mp_asm_base_data(&emit->as->base, 1, emit->scope->source_file >> 8);
+        #if EMIT_NATIVE_LINK
+        emit_native_add_reloc(emit, MP_NATIVE_RELOC_QSTR16, emit->scope->source_file, 2);
+        #endif
         #else
         mp_asm_base_data(&emit->as->base, 1, 1);
         #endif
@@ -439,6 +589,9 @@ STATIC void emit_native_end_pass(emit_t *emit) {
                 }
             }
             mp_asm_base_data(&emit->as->base, ASM_WORD_SIZE, (mp_uint_t)MP_OBJ_NEW_QSTR(qst));
+            #if EMIT_NATIVE_LINK
+            emit_native_add_reloc(emit, MP_NATIVE_RELOC_QSTR_OBJ, qst, ASM_WORD_SIZE);
+            #endif
         }
 
     }
@@ -459,11 +612,21 @@ STATIC void emit_native_end_pass(emit_t *emit) {
             type_sig |= (emit->local_vtype[i] & 0xf) << (i * 4 + 4);
         }
 
+        #if EMIT_NATIVE_LINK
+        // the raw code takes ownership of the relocations
+        mp_native_reloc_t *reloc = m_renew(mp_native_reloc_t, emit->reloc, emit->reloc_alloc, emit->reloc_len);
+        emit->reloc = NULL;
+        emit->reloc_alloc = 0;
+        #endif
+
         #pragma GCC diagnostic push
         #pragma GCC diagnostic ignored "-Wcast-align"
         mp_emit_glue_assign_native(emit->scope->raw_code,
             emit->do_viper_types ? MP_CODE_NATIVE_VIPER : MP_CODE_NATIVE_PY,
             f, f_len, (mp_uint_t*)((byte*)f + emit->const_table_offset),
+            #if EMIT_NATIVE_LINK
+            reloc, emit->reloc_len,
+            #endif
             emit->scope->num_pos_args, emit->scope->scope_flags, type_sig);
         #pragma GCC diagnostic pop
     }
@@ -510,11 +673,6 @@ STATIC void emit_native_adjust_stack_size(emit_t *emit, mp_int_t delta) {
     adjust_stack(emit, delta);
 }
 
-STATIC void emit_native_set_source_line(emit_t *emit, mp_uint_t source_line) {
-    (void)emit;
-    (void)source_line;
-}
-
 // this must be called at start of emit functions
 STATIC void emit_native_pre(emit_t *emit) {
     emit->last_emit_was_return_value = false;
@@ -570,11 +728,36 @@ STATIC void need_stack_settled(emit_t *emit) {
         if (si->kind == STACK_IMM) {
             DEBUG_printf("    imm(" INT_FMT ") to local(%u)\n", si->data.u_imm, emit->stack_start + i);
             si->kind = STACK_VALUE;
-            ASM_MOV_LOCAL_IMM_VIA(emit->as, emit->stack_start + i, si->data.u_imm, REG_TEMP0);
+            emit_native_mov_local_imm_via(emit, emit->stack_start + i, si->vtype, si->data.u_imm, REG_TEMP0);
         }
     }
 }
 
+#if MICROPY_JIT
+// Store line in the variable that mp_jit_call reads it from if an exception
+// leaves the function; mp_jit_setup_code_state left its address in code_state.ip
+STATIC void emit_native_store_source_line(emit_t *emit, mp_uint_t line) {
+    need_reg_single(emit, REG_TEMP0, 0);
+    need_reg_single(emit, REG_TEMP1, 0);
+    ASM_MOV_REG_LOCAL(emit->as, REG_TEMP0, offsetof(mp_code_state_t, ip) / sizeof(uintptr_t));
+    ASM_MOV_REG_IMM(emit->as, REG_TEMP1, line);
+    ASM_STORE_REG_REG(emit->as, REG_TEMP1, REG_TEMP0);
+}
+#endif
+
+STATIC void emit_native_set_source_line(emit_t *emit, mp_uint_t source_line) {
+    #if MICROPY_JIT
+    // as for bytecode, a line only takes effect if it's after the ones before
+    if (emit->jit && MP_STATE_VM(mp_optimise_value) < 3 && source_line > emit->last_source_line) {
+        emit->last_source_line = source_line;
+        emit_native_store_source_line(emit, source_line);
+    }
+    #else
+    (void)emit;
+    (void)source_line;
+    #endif
+}
+
 // pos=1 is TOS, pos=2 is next, etc
 STATIC void emit_access_stack(emit_t *emit, int pos, vtype_kind_t *vtype, int reg_dest) {
     need_reg_single(emit, reg_dest, pos);
@@ -592,7 +775,7 @@ STATIC void emit_access_stack(emit_t *emit, int pos, vtype_kind_t *vtype, int re
             break;
 
         case STACK_IMM:
-            ASM_MOV_REG_IMM(emit->as, reg_dest, si->data.u_imm);
+            emit_native_mov_reg_imm(emit, reg_dest, si->vtype, si->data.u_imm);
             break;
     }
 }
@@ -693,36 +876,49 @@ STATIC void emit_post_push_reg_reg_reg_reg(emit_t *emit, vtype_kind_t vtypea, in
 
 STATIC void emit_call(emit_t *emit, mp_fun_kind_t fun_kind) {
     need_reg_all(emit);
-    ASM_CALL_IND(emit->as, mp_fun_table[fun_kind], fun_kind);
+    emit_native_call_ind(emit, fun_kind);
 }
 
 STATIC void emit_call_with_imm_arg(emit_t *emit, mp_fun_kind_t fun_kind, mp_int_t arg_val, int arg_reg) {
     need_reg_all(emit);
     ASM_MOV_REG_IMM(emit->as, arg_reg, arg_val);
-    ASM_CALL_IND(emit->as, mp_fun_table[fun_kind], fun_kind);
+    emit_native_call_ind(emit, fun_kind);
 }
 
-// the first arg is stored in the code aligned on a mp_uint_t boundary
-STATIC void emit_call_with_imm_arg_aligned(emit_t *emit, mp_fun_kind_t fun_kind, mp_int_t arg_val, int arg_reg) {
+STATIC void emit_call_with_qstr_arg(emit_t *emit, mp_fun_kind_t fun_kind, qstr qst, int arg_reg) {
     need_reg_all(emit);
-    ASM_MOV_REG_ALIGNED_IMM(emit->as, arg_reg, arg_val);
-    ASM_CALL_IND(emit->as, mp_fun_table[fun_kind], fun_kind);
+    emit_native_mov_reg_qstr(emit, arg_reg, qst);
+    emit_native_call_ind(emit, fun_kind);
+}
+
+// the raw code pointer is stored in the code aligned on a mp_uint_t boundary
+STATIC void emit_native_mov_reg_raw_code(emit_t *emit, int reg_dest, const mp_raw_code_t *rc) {
+    #if EMIT_NATIVE_LINK
+    emit_native_mov_reg_link(emit, reg_dest, MP_NATIVE_RELOC_RAW_CODE, (mp_uint_t)rc);
+    #else
+    ASM_MOV_REG_ALIGNED_IMM(emit->as, reg_dest, (mp_uint_t)rc);
+    #endif
+}
+
+STATIC void emit_call_with_raw_code_arg(emit_t *emit, mp_fun_kind_t fun_kind, const mp_raw_code_t *rc, int arg_reg) {
+    need_reg_all(emit);
+    emit_native_mov_reg_raw_code(emit, arg_reg, rc);
+    emit_native_call_ind(emit, fun_kind);
 }
 
 STATIC void emit_call_with_2_imm_args(emit_t *emit, mp_fun_kind_t fun_kind, mp_int_t arg_val1, int arg_reg1, mp_int_t arg_val2, int arg_reg2) {
     need_reg_all(emit);
     ASM_MOV_REG_IMM(emit->as, arg_reg1, arg_val1);
     ASM_MOV_REG_IMM(emit->as, arg_reg2, arg_val2);
-    ASM_CALL_IND(emit->as, mp_fun_table[fun_kind], fun_kind);
+    emit_native_call_ind(emit, fun_kind);
 }
 
-// the first arg is stored in the code aligned on a mp_uint_t boundary
-STATIC void emit_call_with_3_imm_args_and_first_aligned(emit_t *emit, mp_fun_kind_t fun_kind, mp_int_t arg_val1, int arg_reg1, mp_int_t arg_val2, int arg_reg2, mp_int_t arg_val3, int arg_reg3) {
+STATIC void emit_call_with_raw_code_and_2_imm_args(emit_t *emit, mp_fun_kind_t fun_kind, const mp_raw_code_t *rc, int arg_reg1, mp_int_t arg_val2, int arg_reg2, mp_int_t arg_val3, int arg_reg3) {
     need_reg_all(emit);
-    ASM_MOV_REG_ALIGNED_IMM(emit->as, arg_reg1, arg_val1);
+    emit_native_mov_reg_raw_code(emit, arg_reg1, rc);
     ASM_MOV_REG_IMM(emit->as, arg_reg2, arg_val2);
     ASM_MOV_REG_IMM(emit->as, arg_reg3, arg_val3);
-    ASM_CALL_IND(emit->as, mp_fun_table[fun_kind], fun_kind);
+    emit_native_call_ind(emit, fun_kind);
 }
 
 // vtype of all n_pop objects is VTYPE_PYOBJ
@@ -741,13 +937,13 @@ STATIC void emit_get_stack_pointer_to_reg_for_pop(emit_t *emit, mp_uint_t reg_de
             si->kind = STACK_VALUE;
             switch (si->vtype) {
                 case VTYPE_PYOBJ:
-                    ASM_MOV_LOCAL_IMM_VIA(emit->as, emit->stack_start + emit->stack_size - 1 - i, si->data.u_imm, reg_dest);
+                    emit_native_mov_local_imm_via(emit, emit->stack_start + emit->stack_size - 1 - i, VTYPE_PYOBJ, si->data.u_imm, reg_dest);
                     break;
                 case VTYPE_BOOL:
                     if (si->data.u_imm == 0) {
-                        ASM_MOV_LOCAL_IMM_VIA(emit->as, emit->stack_start + emit->stack_size - 1 - i, (mp_uint_t)mp_const_false, reg_dest);
+                        emit_native_mov_local_imm_via(emit, emit->stack_start + emit->stack_size - 1 - i, VTYPE_PYOBJ, (mp_uint_t)mp_const_false, reg_dest);
                     } else {
-                        ASM_MOV_LOCAL_IMM_VIA(emit->as, emit->stack_start + emit->stack_size - 1 - i, (mp_uint_t)mp_const_true, reg_dest);
+                        emit_native_mov_local_imm_via(emit, emit->stack_start + emit->stack_size - 1 - i, VTYPE_PYOBJ, (mp_uint_t)mp_const_true, reg_dest);
                     }
                     si->vtype = VTYPE_PYOBJ;
                     break;
@@ -801,6 +997,12 @@ STATIC void emit_native_label_assign(emit_t *emit, mp_uint_t l) {
     // need to commit stack because we can jump here from elsewhere
     need_stack_settled(emit);
     mp_asm_base_label_assign(&emit->as->base, l);
+    #if MICROPY_JIT
+    // code jumping here may have stored a later line
+    if (emit->jit && emit->last_source_line != 0) {
+        emit_native_store_source_line(emit, emit->last_source_line);
+    }
+    #endif
     emit_post(emit);
 }
 
@@ -814,7 +1016,7 @@ STATIC void emit_native_import_name(emit_t *emit, qstr qst) {
         stack_info_t *top = peek_stack(emit, 0);
         if (top->vtype == VTYPE_PTR_NONE) {
             emit_pre_pop_discard(emit);
-            ASM_MOV_REG_IMM(emit->as, REG_ARG_2, (mp_uint_t)mp_const_none);
+            emit_native_mov_reg_imm(emit, REG_ARG_2, VTYPE_PYOBJ, (mp_uint_t)mp_const_none);
         } else {
             vtype_kind_t vtype_fromlist;
             emit_pre_pop_reg(emit, &vtype_fromlist, REG_ARG_2);
@@ -835,7 +1037,7 @@ STATIC void emit_native_import_name(emit_t *emit, qstr qst) {
         assert(vtype_level == VTYPE_PYOBJ);
     }
 
-    emit_call_with_imm_arg(emit, MP_F_IMPORT_NAME, qst, REG_ARG_1); // arg1 = import name
+    emit_call_with_qstr_arg(emit, MP_F_IMPORT_NAME, qst, REG_ARG_1); // arg1 = import name
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
@@ -845,7 +1047,7 @@ STATIC void emit_native_import_from(emit_t *emit, qstr qst) {
     vtype_kind_t vtype_module;
     emit_access_stack(emit, 1, &vtype_module, REG_ARG_1); // arg1 = module
     assert(vtype_module == VTYPE_PYOBJ);
-    emit_call_with_imm_arg(emit, MP_F_IMPORT_FROM, qst, REG_ARG_2); // arg2 = import name
+    emit_call_with_qstr_arg(emit, MP_F_IMPORT_FROM, qst, REG_ARG_2); // arg2 = import name
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
@@ -924,7 +1126,21 @@ STATIC void emit_native_load_const_str(emit_t *emit, qstr qst) {
 STATIC void emit_native_load_const_obj(emit_t *emit, mp_obj_t obj) {
     emit_native_pre(emit);
     need_reg_single(emit, REG_RET, 0);
+    #if MICROPY_EMIT_NATIVE_FLOAT
+    if (emit->do_viper_types && mp_obj_is_float(obj)) {
+        // like int constants, float constants are native values in viper
+        union { mp_float_t f; mp_uint_t u; } val = { .u = 0 };
+        val.f = mp_obj_get_float(obj);
+        ASM_MOV_REG_IMM(emit->as, REG_RET, val.u);
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_RET);
+        return;
+    }
+    #endif
+    #if EMIT_NATIVE_LINK
+    emit_native_mov_reg_link(emit, REG_RET, MP_NATIVE_RELOC_OBJ, (mp_uint_t)obj);
+    #else
     ASM_MOV_REG_ALIGNED_IMM(emit->as, REG_RET, (mp_uint_t)obj);
+    #endif
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
@@ -1005,10 +1221,15 @@ STATIC void emit_native_load_global(emit_t *emit, qstr qst, int kind) {
             } else if (qst == MP_QSTR_ptr32) {
                 emit_post_push_imm(emit, VTYPE_BUILTIN_CAST, VTYPE_PTR32);
                 return;
+            #if MICROPY_EMIT_NATIVE_FLOAT
+            } else if (qst == MP_QSTR_float) {
+                emit_post_push_imm(emit, VTYPE_BUILTIN_CAST, VTYPE_FLOAT);
+                return;
+            #endif
             }
         }
     }
-    emit_call_with_imm_arg(emit, MP_F_LOAD_NAME + kind, qst, REG_ARG_1);
+    emit_call_with_qstr_arg(emit, MP_F_LOAD_NAME + kind, qst, REG_ARG_1);
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
@@ -1020,7 +1241,7 @@ STATIC void emit_native_load_attr(emit_t *emit, qstr qst) {
     vtype_kind_t vtype_base;
     emit_pre_pop_reg(emit, &vtype_base, REG_ARG_1); // arg1 = base
     assert(vtype_base == VTYPE_PYOBJ);
-    emit_call_with_imm_arg(emit, MP_F_LOAD_ATTR, qst, REG_ARG_2); // arg2 = attribute name
+    emit_call_with_qstr_arg(emit, MP_F_LOAD_ATTR, qst, REG_ARG_2); // arg2 = attribute name
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
@@ -1028,13 +1249,13 @@ STATIC void emit_native_load_method(emit_t *emit, qstr qst, bool is_super) {
     if (is_super) {
         emit_get_stack_pointer_to_reg_for_pop(emit, REG_ARG_2, 3); // arg2 = dest ptr
         emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_2, 2); // arg2 = dest ptr
-        emit_call_with_imm_arg(emit, MP_F_LOAD_SUPER_METHOD, qst, REG_ARG_1); // arg1 = method name
+        emit_call_with_qstr_arg(emit, MP_F_LOAD_SUPER_METHOD, qst, REG_ARG_1); // arg1 = method name
     } else {
         vtype_kind_t vtype_base;
         emit_pre_pop_reg(emit, &vtype_base, REG_ARG_1); // arg1 = base
         assert(vtype_base == VTYPE_PYOBJ);
         emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_3, 2); // arg3 = dest ptr
-        emit_call_with_imm_arg(emit, MP_F_LOAD_METHOD, qst, REG_ARG_2); // arg2 = method name
+        emit_call_with_qstr_arg(emit, MP_F_LOAD_METHOD, qst, REG_ARG_2); // arg2 = method name
     }
 }
 
@@ -1249,7 +1470,7 @@ STATIC void emit_native_store_global(emit_t *emit, qstr qst, int kind) {
             ASM_MOV_REG_REG(emit->as, REG_ARG_2, REG_RET);
         }
     }
-    emit_call_with_imm_arg(emit, MP_F_STORE_NAME + kind, qst, REG_ARG_1); // arg1 = name
+    emit_call_with_qstr_arg(emit, MP_F_STORE_NAME + kind, qst, REG_ARG_1); // arg1 = name
     emit_post(emit);
 }
 
@@ -1258,7 +1479,7 @@ STATIC void emit_native_store_attr(emit_t *emit, qstr qst) {
     emit_pre_pop_reg_reg(emit, &vtype_base, REG_ARG_1, &vtype_val, REG_ARG_3); // arg1 = base, arg3 = value
     assert(vtype_base == VTYPE_PYOBJ);
     assert(vtype_val == VTYPE_PYOBJ);
-    emit_call_with_imm_arg(emit, MP_F_STORE_ATTR, qst, REG_ARG_2); // arg2 = attribute name
+    emit_call_with_qstr_arg(emit, MP_F_STORE_ATTR, qst, REG_ARG_2); // arg2 = attribute name
     emit_post(emit);
 }
 
@@ -1458,7 +1679,7 @@ STATIC void emit_native_delete_global(emit_t *emit, qstr qst, int kind) {
     MP_STATIC_ASSERT(MP_F_DELETE_NAME + MP_EMIT_IDOP_GLOBAL_NAME == MP_F_DELETE_NAME);
     MP_STATIC_ASSERT(MP_F_DELETE_NAME + MP_EMIT_IDOP_GLOBAL_GLOBAL == MP_F_DELETE_GLOBAL);
     emit_native_pre(emit);
-    emit_call_with_imm_arg(emit, MP_F_DELETE_NAME + kind, qst, REG_ARG_1);
+    emit_call_with_qstr_arg(emit, MP_F_DELETE_NAME + kind, qst, REG_ARG_1);
     emit_post(emit);
 }
 
@@ -1466,7 +1687,8 @@ STATIC void emit_native_delete_attr(emit_t *emit, qstr qst) {
     vtype_kind_t vtype_base;
     emit_pre_pop_reg(emit, &vtype_base, REG_ARG_1); // arg1 = base
     assert(vtype_base == VTYPE_PYOBJ);
-    emit_call_with_2_imm_args(emit, MP_F_STORE_ATTR, qst, REG_ARG_2, (mp_uint_t)MP_OBJ_NULL, REG_ARG_3); // arg2 = attribute name, arg3 = value (null for delete)
+    ASM_MOV_REG_IMM(emit->as, REG_ARG_3, (mp_uint_t)MP_OBJ_NULL); // arg3 = value (null for delete)
+    emit_call_with_qstr_arg(emit, MP_F_STORE_ATTR, qst, REG_ARG_2); // arg2 = attribute name
     emit_post(emit);
 }
 
@@ -1532,9 +1754,23 @@ STATIC void emit_native_rot_three(emit_t *emit) {
     emit_post_push_reg_reg_reg(emit, vtype0, REG_TEMP0, vtype2, REG_TEMP2, vtype1, REG_TEMP1);
 }
 
+// Native Python code lets the runtime raise pending exceptions (eg
+// KeyboardInterrupt) and run its loop hook on each iteration of a loop, as the
+// VM does on backward jumps.  Viper code is left as tight as possible.  A label
+// is behind the current position if it has been placed in this pass; labels
+// that haven't are (size_t)-1 or, in the emit pass, further on.
+STATIC void emit_native_loop_hook(emit_t *emit, mp_uint_t label) {
+    mp_asm_base_t *as = &emit->as->base;
+    if (!emit->do_viper_types && as->label_offsets[label] <= as->code_offset) {
+        need_stack_settled(emit);
+        emit_call(emit, MP_F_NATIVE_LOOP_HOOK);
+    }
+}
+
 STATIC void emit_native_jump(emit_t *emit, mp_uint_t label) {
     DEBUG_printf("jump(label=" UINT_FMT ")\n", label);
     emit_native_pre(emit);
+    emit_native_loop_hook(emit, label);
     // need to commit stack because we are jumping elsewhere
     need_stack_settled(emit);
     ASM_JUMP(emit->as, label);
@@ -1570,6 +1806,7 @@ STATIC void emit_native_jump_helper(emit_t *emit, bool pop) {
 
 STATIC void emit_native_pop_jump_if(emit_t *emit, bool cond, mp_uint_t label) {
     DEBUG_printf("pop_jump_if(cond=%u, label=" UINT_FMT ")\n", cond, label);
+    emit_native_loop_hook(emit, label);
     emit_native_jump_helper(emit, true);
     if (cond) {
         ASM_JUMP_IF_REG_NONZERO(emit->as, REG_RET, label);
@@ -1605,7 +1842,7 @@ STATIC void emit_native_setup_with(emit_t *emit, mp_uint_t label) {
     emit_access_stack(emit, 1, &vtype, REG_ARG_1); // arg1 = ctx_mgr
     assert(vtype == VTYPE_PYOBJ);
     emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_3, 2); // arg3 = dest ptr
-    emit_call_with_imm_arg(emit, MP_F_LOAD_METHOD, MP_QSTR___exit__, REG_ARG_2);
+    emit_call_with_qstr_arg(emit, MP_F_LOAD_METHOD, MP_QSTR___exit__, REG_ARG_2);
     // stack: (..., ctx_mgr, __exit__, self)
 
     emit_pre_pop_reg(emit, &vtype, REG_ARG_3); // self
@@ -1618,7 +1855,7 @@ STATIC void emit_native_setup_with(emit_t *emit, mp_uint_t label) {
 
     // get __enter__ method
     emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_3, 2); // arg3 = dest ptr
-    emit_call_with_imm_arg(emit, MP_F_LOAD_METHOD, MP_QSTR___enter__, REG_ARG_2); // arg2 = method name
+    emit_call_with_qstr_arg(emit, MP_F_LOAD_METHOD, MP_QSTR___enter__, REG_ARG_2); // arg2 = method name
     // stack: (..., __exit__, self, __enter__, self)
 
     // call __enter__ method
@@ -1629,11 +1866,11 @@ STATIC void emit_native_setup_with(emit_t *emit, mp_uint_t label) {
 
     // need to commit stack because we may jump elsewhere
     need_stack_settled(emit);
-    emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_1, sizeof(nlr_buf_t) / sizeof(mp_uint_t)); // arg1 = pointer to nlr buf
+    emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_1, NLR_BUF_SIZE); // arg1 = pointer to nlr buf
     emit_call(emit, MP_F_NLR_PUSH);
     ASM_JUMP_IF_REG_NONZERO(emit->as, REG_RET, label);
 
-    emit_access_stack(emit, sizeof(nlr_buf_t) / sizeof(mp_uint_t) + 1, &vtype, REG_RET); // access return value of __enter__
+    emit_access_stack(emit, NLR_BUF_SIZE + 1, &vtype, REG_RET); // access return value of __enter__
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET); // push return value of __enter__
     // stack: (..., __exit__, self, as_value, nlr_buf, as_value)
 }
@@ -1646,7 +1883,7 @@ STATIC void emit_native_setup_block(emit_t *emit, mp_uint_t label, int kind) {
         emit_native_pre(emit);
         // need to commit stack because we may jump elsewhere
         need_stack_settled(emit);
-        emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_1, sizeof(nlr_buf_t) / sizeof(mp_uint_t)); // arg1 = pointer to nlr buf
+        emit_get_stack_pointer_to_reg_for_push(emit, REG_ARG_1, NLR_BUF_SIZE); // arg1 = pointer to nlr buf
         emit_call(emit, MP_F_NLR_PUSH);
         ASM_JUMP_IF_REG_NONZERO(emit->as, REG_RET, label);
         emit_post(emit);
@@ -1659,7 +1896,7 @@ STATIC void emit_native_with_cleanup(emit_t *emit, mp_uint_t label) {
     // stack: (..., __exit__, self, as_value, nlr_buf)
     emit_native_pre(emit);
     emit_call(emit, MP_F_NLR_POP);
-    adjust_stack(emit, -(mp_int_t)(sizeof(nlr_buf_t) / sizeof(mp_uint_t)) - 1);
+    adjust_stack(emit, -(mp_int_t)NLR_BUF_SIZE - 1);
     // stack: (..., __exit__, self)
 
     // call __exit__
@@ -1773,7 +2010,7 @@ STATIC void emit_native_for_iter_end(emit_t *emit) {
 STATIC void emit_native_pop_block(emit_t *emit) {
     emit_native_pre(emit);
     emit_call(emit, MP_F_NLR_POP);
-    adjust_stack(emit, -(mp_int_t)(sizeof(nlr_buf_t) / sizeof(mp_uint_t)) + 1);
+    adjust_stack(emit, -(mp_int_t)NLR_BUF_SIZE + 1);
     emit_post(emit);
 }
 
@@ -1787,6 +2024,16 @@ STATIC void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     if (vtype == VTYPE_PYOBJ) {
         emit_call_with_imm_arg(emit, MP_F_UNARY_OP, op, REG_ARG_1);
         emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
+    #if MICROPY_EMIT_NATIVE_FLOAT
+    } else if (vtype == VTYPE_FLOAT && (op == MP_UNARY_OP_POSITIVE || op == MP_UNARY_OP_NEGATIVE)) {
+        if (op == MP_UNARY_OP_NEGATIVE) {
+            // flip the sign bit
+            need_reg_single(emit, REG_ARG_1, 0);
+            ASM_MOV_REG_IMM(emit->as, REG_ARG_1, (mp_uint_t)1 << (sizeof(mp_float_t) * 8 - 1));
+            ASM_XOR_REG_REG(emit->as, REG_ARG_2, REG_ARG_1);
+        }
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_ARG_2);
+    #endif
     } else {
         adjust_stack(emit, 1);
         EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
@@ -1794,10 +2041,75 @@ STATIC void emit_native_unary_op(emit_t *emit, mp_unary_op_t op) {
     }
 }
 
+#if MICROPY_EMIT_NATIVE_FLOAT
+// Box the viper float at the given depth of the stack, in place
+STATIC void emit_native_box_float(emit_t *emit, mp_uint_t depth) {
+    need_stack_settled(emit);
+    stack_info_t *si = peek_stack(emit, depth);
+    mp_uint_t local_num = emit->stack_start + emit->stack_size - 1 - depth;
+    ASM_MOV_REG_LOCAL(emit->as, REG_ARG_1, local_num);
+    emit_call_with_imm_arg(emit, MP_F_CONVERT_NATIVE_TO_OBJ, si->vtype, REG_ARG_2); // arg2 = type
+    ASM_MOV_LOCAL_REG(emit->as, local_num, REG_RET);
+    si->vtype = VTYPE_PYOBJ;
+}
+
+// binary op between viper floats, or a float and an int
+STATIC void emit_native_binary_op_float(emit_t *emit, mp_binary_op_t op) {
+    if (MP_BINARY_OP_INPLACE_OR <= op && op <= MP_BINARY_OP_INPLACE_POWER) {
+        op += MP_BINARY_OP_OR - MP_BINARY_OP_INPLACE_OR;
+    }
+    bool is_compare = MP_BINARY_OP_LESS <= op && op <= MP_BINARY_OP_NOT_EQUAL;
+    if (!is_compare && !(MP_BINARY_OP_ADD <= op && op <= MP_BINARY_OP_POWER)) {
+        adjust_stack(emit, -1);
+        EMIT_NATIVE_VIPER_TYPE_ERROR(emit,
+            translate("binary op %q not implemented"), mp_binary_op_method_name[op]);
+        return;
+    }
+
+    vtype_kind_t vtype_lhs, vtype_rhs;
+    emit_pre_pop_reg_reg(emit, &vtype_rhs, REG_ARG_3, &vtype_lhs, REG_ARG_2);
+
+    #if N_X64 && MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_DOUBLE
+    // the simple arithmetic ops are done inline with SSE2
+    if (vtype_lhs == VTYPE_FLOAT && vtype_rhs == VTYPE_FLOAT
+        && (op == MP_BINARY_OP_ADD || op == MP_BINARY_OP_SUBTRACT || op == MP_BINARY_OP_MULTIPLY)) {
+        static const byte ops[3] = { ASM_X64_FLOAT_ADD, ASM_X64_FLOAT_SUB, ASM_X64_FLOAT_MUL };
+        asm_x64_float_op_r64_r64(emit->as, ops[op - MP_BINARY_OP_ADD], REG_ARG_2, REG_ARG_3);
+        emit_post_push_reg(emit, VTYPE_FLOAT, REG_ARG_2);
+        return;
+    }
+    #endif
+
+    mp_uint_t arg = op;
+    if (vtype_lhs == VTYPE_INT) {
+        arg |= 0x100;
+    }
+    if (vtype_rhs == VTYPE_INT) {
+        arg |= 0x200;
+    }
+    emit_call_with_imm_arg(emit, MP_F_FLOAT_BINARY_OP, arg, REG_ARG_1);
+    emit_post_push_reg(emit, is_compare ? VTYPE_BOOL : VTYPE_FLOAT, REG_RET);
+}
+#endif
+
 STATIC void emit_native_binary_op(emit_t *emit, mp_binary_op_t op) {
     DEBUG_printf("binary_op(" UINT_FMT ")\n", op);
     vtype_kind_t vtype_lhs = peek_vtype(emit, 1);
     vtype_kind_t vtype_rhs = peek_vtype(emit, 0);
+    #if MICROPY_EMIT_NATIVE_FLOAT
+    if ((vtype_lhs == VTYPE_FLOAT && (vtype_rhs == VTYPE_FLOAT || vtype_rhs == VTYPE_INT))
+        || (vtype_lhs == VTYPE_INT && vtype_rhs == VTYPE_FLOAT)) {
+        emit_native_binary_op_float(emit, op);
+        return;
+    }
+    if ((vtype_lhs == VTYPE_FLOAT && vtype_rhs == VTYPE_PYOBJ)
+        || (vtype_lhs == VTYPE_PYOBJ && vtype_rhs == VTYPE_FLOAT)) {
+        // eg an object times a float constant, done as an op between objects
+        emit_native_box_float(emit, vtype_lhs == VTYPE_FLOAT ? 1 : 0);
+        vtype_lhs = VTYPE_PYOBJ;
+        vtype_rhs = VTYPE_PYOBJ;
+    }
+    #endif
     if (vtype_lhs == VTYPE_INT && vtype_rhs == VTYPE_INT) {
         // for integers, inplace and normal ops are equivalent, so use just normal ops
         if (MP_BINARY_OP_INPLACE_OR <= op && op <= MP_BINARY_OP_INPLACE_POWER) {
@@ -2015,7 +2327,9 @@ STATIC void emit_native_build_slice(emit_t *emit, mp_uint_t n_args) {
         emit_pre_pop_reg_reg(emit, &vtype_stop, REG_ARG_2, &vtype_start, REG_ARG_1); // arg1 = start, arg2 = stop
         assert(vtype_start == VTYPE_PYOBJ);
         assert(vtype_stop == VTYPE_PYOBJ);
-        emit_call_with_imm_arg(emit, MP_F_NEW_SLICE, (mp_uint_t)mp_const_none, REG_ARG_3); // arg3 = step
+        need_reg_all(emit);
+        emit_native_mov_reg_imm(emit, REG_ARG_3, VTYPE_PYOBJ, (mp_uint_t)mp_const_none); // arg3 = step
+        emit_call(emit, MP_F_NEW_SLICE);
         emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
     } else {
         assert(n_args == 3);
@@ -2081,13 +2395,13 @@ STATIC void emit_native_make_function(emit_t *emit, scope_t *scope, mp_uint_t n_
     // call runtime, with type info for args, or don't support dict/default params, or only support Python objects for them
     emit_native_pre(emit);
     if (n_pos_defaults == 0 && n_kw_defaults == 0) {
-        emit_call_with_3_imm_args_and_first_aligned(emit, MP_F_MAKE_FUNCTION_FROM_RAW_CODE, (mp_uint_t)scope->raw_code, REG_ARG_1, (mp_uint_t)MP_OBJ_NULL, REG_ARG_2, (mp_uint_t)MP_OBJ_NULL, REG_ARG_3);
+        emit_call_with_raw_code_and_2_imm_args(emit, MP_F_MAKE_FUNCTION_FROM_RAW_CODE, scope->raw_code, REG_ARG_1, (mp_uint_t)MP_OBJ_NULL, REG_ARG_2, (mp_uint_t)MP_OBJ_NULL, REG_ARG_3);
     } else {
         vtype_kind_t vtype_def_tuple, vtype_def_dict;
         emit_pre_pop_reg_reg(emit, &vtype_def_dict, REG_ARG_3, &vtype_def_tuple, REG_ARG_2);
         assert(vtype_def_tuple == VTYPE_PYOBJ);
         assert(vtype_def_dict == VTYPE_PYOBJ);
-        emit_call_with_imm_arg_aligned(emit, MP_F_MAKE_FUNCTION_FROM_RAW_CODE, (mp_uint_t)scope->raw_code, REG_ARG_1);
+        emit_call_with_raw_code_arg(emit, MP_F_MAKE_FUNCTION_FROM_RAW_CODE, scope->raw_code, REG_ARG_1);
     }
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
@@ -2101,8 +2415,8 @@ STATIC void emit_native_make_closure(emit_t *emit, scope_t *scope, mp_uint_t n_c
         emit_get_stack_pointer_to_reg_for_pop(emit, REG_ARG_3, n_closed_over + 2);
         ASM_MOV_REG_IMM(emit->as, REG_ARG_2, 0x100 | n_closed_over);
     }
-    ASM_MOV_REG_ALIGNED_IMM(emit->as, REG_ARG_1, (mp_uint_t)scope->raw_code);
-    ASM_CALL_IND(emit->as, mp_fun_table[MP_F_MAKE_CLOSURE_FROM_RAW_CODE], MP_F_MAKE_CLOSURE_FROM_RAW_CODE);
+    emit_native_mov_reg_raw_code(emit, REG_ARG_1, scope->raw_code);
+    emit_native_call_ind(emit, MP_F_MAKE_CLOSURE_FROM_RAW_CODE);
     emit_post_push_reg(emit, VTYPE_PYOBJ, REG_RET);
 }
 
@@ -2137,6 +2451,18 @@ STATIC void emit_native_call_function(emit_t *emit, mp_uint_t n_positional, mp_u
             case VTYPE_PTR16:
             case VTYPE_PTR32:
             case VTYPE_PTR_NONE:
+            #if MICROPY_EMIT_NATIVE_FLOAT
+            case VTYPE_FLOAT:
+                if ((vtype_cast == VTYPE_FLOAT) != (peek_vtype(emit, 0) == VTYPE_FLOAT)) {
+                    // converting between a float and an integer needs a helper
+                    vtype_kind_t vtype;
+                    emit_pre_pop_reg(emit, &vtype, REG_ARG_1);
+                    emit_pre_pop_discard(emit);
+                    emit_call_with_imm_arg(emit, MP_F_FLOAT_CONVERT, (vtype & 0xf) | ((vtype_cast & 0xf) << 4), REG_ARG_2);
+                    emit_post_push_reg(emit, vtype_cast, REG_RET);
+                    break;
+                }
+            #endif
                 emit_fold_stack_top(emit, REG_ARG_1);
                 emit_post_top_set_vtype(emit, vtype_cast);
                 break;
@@ -2180,7 +2506,7 @@ STATIC void emit_native_return_value(emit_t *emit) {
         if (peek_vtype(emit, 0) == VTYPE_PTR_NONE) {
             emit_pre_pop_discard(emit);
             if (emit->return_vtype == VTYPE_PYOBJ) {
-                ASM_MOV_REG_IMM(emit->as, REG_RET, (mp_uint_t)mp_const_none);
+                emit_native_mov_reg_imm(emit, REG_RET, VTYPE_PYOBJ, (mp_uint_t)mp_const_none);
             } else {
                 ASM_MOV_REG_IMM(emit->as, REG_RET, 0);
             }
@@ -375,6 +375,13 @@ void gc_collect_start(void) {
     ptrs = (void**)(void*)MP_STATE_THREAD(pystack_start);
     gc_collect_root(ptrs, (MP_STATE_THREAD(pystack_cur) - MP_STATE_THREAD(pystack_start)) / sizeof(void*));
     #endif
+
+    #if MICROPY_FRAME_ARENA
+    // Trace root pointers from the frame arena.  Only the main thread has one,
+    // and it must be traced whichever thread is collecting.
+    ptrs = (void**)(void*)mp_state_ctx.thread.frame_arena_start;
+    gc_collect_root(ptrs, (mp_state_ctx.thread.frame_arena_cur - mp_state_ctx.thread.frame_arena_start) / sizeof(void*));
+    #endif
 }
 
 void gc_collect_ptr(void *ptr) {
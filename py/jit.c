@@ -0,0 +1,250 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/bc.h"
+#include "py/compile.h"
+#include "py/jit.h"
+#include "py/runtime.h"
+
+#if MICROPY_JIT
+
+#if MICROPY_READER_VFS
+#include "extmod/vfs.h"
+#elif MICROPY_READER_POSIX
+#include <sys/stat.h>
+#endif
+
+#if !MICROPY_EMIT_NATIVE || !MICROPY_ENABLE_COMPILER || !MICROPY_PERSISTENT_CODE || MICROPY_STACKLESS
+#error "MICROPY_JIT needs the compiler, the native emitter and MICROPY_PERSISTENT_CODE, and not MICROPY_STACKLESS"
+#endif
+
+// The size and modification time of a source file when it was last compiled
+typedef struct _mp_jit_source_t {
+    qstr file;
+    mp_int_t size;
+    mp_int_t mtime;
+} mp_jit_source_t;
+
+// Get the size and modification time of file, returning false if it has none
+STATIC bool jit_source_stamp(qstr file, mp_int_t *size, mp_int_t *mtime) {
+    #if MICROPY_READER_VFS
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t *items;
+        mp_obj_get_array_fixed_n(mp_vfs_stat(MP_OBJ_NEW_QSTR(file)), 10, &items);
+        *size = mp_obj_get_int(items[6]);
+        *mtime = mp_obj_get_int(items[8]);
+        nlr_pop();
+        return true;
+    }
+    return false;
+    #elif MICROPY_READER_POSIX
+    struct stat st;
+    if (stat(qstr_str(file), &st) != 0) {
+        return false;
+    }
+    *size = st.st_size;
+    *mtime = st.st_mtime;
+    return true;
+    #else
+    (void)file;
+    (void)size;
+    (void)mtime;
+    return false;
+    #endif
+}
+
+STATIC mp_jit_source_t *jit_find_source(qstr file) {
+    for (size_t i = 0; i < MP_STATE_VM(jit_source_table_len); ++i) {
+        if (MP_STATE_VM(jit_source_table)[i].file == file) {
+            return &MP_STATE_VM(jit_source_table)[i];
+        }
+    }
+    return NULL;
+}
+
+void mp_jit_note_source(qstr file) {
+    mp_int_t size, mtime;
+    if (!jit_source_stamp(file, &size, &mtime)) {
+        return;
+    }
+    mp_jit_source_t *src = jit_find_source(file);
+    if (src == NULL) {
+        if (MP_STATE_VM(jit_source_table_len) >= MP_STATE_VM(jit_source_table_alloc)) {
+            MP_STATE_VM(jit_source_table) = m_renew(mp_jit_source_t, MP_STATE_VM(jit_source_table),
+                MP_STATE_VM(jit_source_table_alloc), MP_STATE_VM(jit_source_table_alloc) + 4);
+            MP_STATE_VM(jit_source_table_alloc) += 4;
+        }
+        src = &MP_STATE_VM(jit_source_table)[MP_STATE_VM(jit_source_table_len)++];
+        src->file = file;
+    }
+    src->size = size;
+    src->mtime = mtime;
+}
+
+// Whether file is as it was when it was last compiled
+STATIC bool jit_source_unchanged(qstr file) {
+    mp_jit_source_t *src = jit_find_source(file);
+    mp_int_t size, mtime;
+    return src != NULL && jit_source_stamp(file, &size, &mtime)
+        && size == src->size && mtime == src->mtime;
+}
+
+// Each run of a def makes a new function object with the same bytecode, so
+// the outcome of compiling some bytecode is kept here and reused.  A NULL
+// raw_code means it couldn't be compiled.
+typedef struct _mp_jit_entry_t {
+    const byte *bytecode;
+    const mp_raw_code_t *raw_code;
+} mp_jit_entry_t;
+
+// The source of a function isn't kept, so the whole file it came from is
+// compiled again.  It's not compiled if it isn't a file (eg "<stdin>") or has
+// changed since it was last compiled.  The file may also have been changed
+// back, or more than once within the resolution of its mtime, so the compiler
+// only returns native code for a function whose bytecode and constants are
+// the same as fun's.
+STATIC const mp_raw_code_t *jit_compile_raw_code(mp_obj_fun_bc_t *fun) {
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    if (fun->qstr_map != NULL) {
+        // the bytecode came from a .mpy file and has another runtime's qstrs
+        return NULL;
+    }
+    #endif
+
+    const byte *ip = fun->bytecode;
+    ip = mp_decode_uint_skip(ip); // skip n_state
+    ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+    ip += 4; // skip scope_flags, n_pos_args, n_kwonly_args, n_def_pos_args
+    ip = mp_decode_uint_skip(ip); // skip code_info_size
+    qstr source_file = ip[2] | (ip[3] << 8);
+    if (!jit_source_unchanged(source_file)) {
+        return NULL;
+    }
+
+    // any error just leaves the function as bytecode
+    const mp_raw_code_t *rc = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(qstr_str(source_file));
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        rc = mp_compile_jit(&parse_tree, source_file, fun);
+        nlr_pop();
+    }
+    return rc;
+}
+
+void mp_jit_compile(mp_obj_fun_bc_t *fun) {
+    fun->jit_count = MP_JIT_COUNT_FAILED;
+
+    mp_jit_entry_t *entry = NULL;
+    for (size_t i = 0; i < MP_STATE_VM(jit_table_len); ++i) {
+        if (MP_STATE_VM(jit_table)[i].bytecode == fun->bytecode) {
+            entry = &MP_STATE_VM(jit_table)[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        const mp_raw_code_t *rc = jit_compile_raw_code(fun);
+        if (MP_STATE_VM(jit_table_len) >= MP_STATE_VM(jit_table_alloc)) {
+            MP_STATE_VM(jit_table) = m_renew(mp_jit_entry_t, MP_STATE_VM(jit_table),
+                MP_STATE_VM(jit_table_alloc), MP_STATE_VM(jit_table_alloc) + 4);
+            MP_STATE_VM(jit_table_alloc) += 4;
+        }
+        entry = &MP_STATE_VM(jit_table)[MP_STATE_VM(jit_table_len)++];
+        entry->bytecode = fun->bytecode;
+        entry->raw_code = rc;
+    }
+    if (entry->raw_code == NULL) {
+        return;
+    }
+
+    // make the native function with the same default args and globals
+    const byte *ip = fun->bytecode;
+    ip = mp_decode_uint_skip(ip); // skip n_state
+    ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+    size_t scope_flags = ip[0];
+    size_t n_def_pos_args = ip[3];
+    mp_obj_t def_args = MP_OBJ_NULL;
+    mp_obj_t def_kw_args = MP_OBJ_NULL;
+    if (n_def_pos_args != 0) {
+        def_args = mp_obj_new_tuple(n_def_pos_args, fun->extra_args);
+    }
+    if ((scope_flags & MP_SCOPE_FLAG_DEFKWARGS) != 0) {
+        def_kw_args = fun->extra_args[n_def_pos_args];
+    }
+    mp_obj_fun_bc_t *jit_fun = MP_OBJ_TO_PTR(mp_make_function_from_raw_code(entry->raw_code, def_args, def_kw_args));
+    jit_fun->globals = fun->globals;
+    fun->jit_fun = jit_fun;
+}
+
+// Native code doesn't switch globals or keep traceback info itself, so calls
+// to it go through here.  Each statement it starts stores its line number in
+// the line variable of its call here, whose address mp_jit_setup_code_state
+// hands it through the thread state.
+mp_obj_t mp_jit_call(mp_obj_fun_bc_t *fun, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_obj_fun_bc_t *jit_fun = fun->jit_fun;
+    mp_call_fun_t native = MICROPY_MAKE_POINTER_CALLABLE((void*)jit_fun->bytecode);
+    volatile size_t line = 0;
+    volatile size_t *outer_line = MP_STATE_THREAD(jit_line);
+    mp_obj_dict_t *old_globals = mp_globals_get();
+    MP_STATE_THREAD(jit_line) = &line;
+    mp_globals_set(jit_fun->globals);
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t ret = native(MP_OBJ_FROM_PTR(jit_fun), n_args, n_kw, args);
+        nlr_pop();
+        MP_STATE_THREAD(jit_line) = outer_line;
+        mp_globals_set(old_globals);
+        return ret;
+    }
+
+    MP_STATE_THREAD(jit_line) = outer_line;
+    mp_globals_set(old_globals);
+    // the line is 0 if the exception came from setting up the args, for which
+    // the VM doesn't add an entry either
+    if (line != 0 && nlr.ret_val != &mp_const_GeneratorExit_obj) {
+        const byte *ip = fun->bytecode;
+        ip = mp_decode_uint_skip(ip); // skip n_state
+        ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+        ip += 4; // skip scope_flags, n_pos_args, n_kwonly_args, n_def_pos_args
+        ip = mp_decode_uint_skip(ip); // skip code_info_size
+        qstr block_name = ip[0] | (ip[1] << 8);
+        qstr source_file = ip[2] | (ip[3] << 8);
+        mp_obj_exception_add_traceback(MP_OBJ_FROM_PTR(nlr.ret_val), source_file, line, block_name);
+    }
+    nlr_jump(nlr.ret_val);
+}
+
+// code_state->ip isn't used by native code once its state is set up, so it
+// keeps the address to store line numbers at there
+void mp_jit_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_setup_code_state(code_state, n_args, n_kw, args);
+    code_state->ip = (const byte*)MP_STATE_THREAD(jit_line);
+}
+
+#endif // MICROPY_JIT
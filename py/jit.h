@@ -0,0 +1,55 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_PY_JIT_H
+#define MICROPY_INCLUDED_PY_JIT_H
+
+#include "py/objfun.h"
+#include "py/bc.h"
+
+#if MICROPY_JIT
+
+// jit_count of a function that won't be compiled, because compiling it failed
+#define MP_JIT_COUNT_FAILED (0xffff)
+
+// Compile fun, a bytecode function that has become hot, to native code.  On
+// success fun->jit_fun is set and calls to fun should go to it instead.  On
+// failure fun is left to run as bytecode.  Either way it's only tried once.
+void mp_jit_compile(mp_obj_fun_bc_t *fun);
+
+// Call fun->jit_fun, the native version of fun, with fun's globals.  If an
+// exception leaves it, a traceback entry is added as the VM would add one.
+mp_obj_t mp_jit_call(mp_obj_fun_bc_t *fun, size_t n_args, size_t n_kw, const mp_obj_t *args);
+
+// Native code compiled by the JIT calls this instead of mp_setup_code_state
+void mp_jit_setup_code_state(mp_code_state_t *code_state, size_t n_args, size_t n_kw, const mp_obj_t *args);
+
+// Record the size and modification time of a source file that's about to be
+// compiled, so that functions from it aren't compiled again once it changes.
+void mp_jit_note_source(qstr file);
+
+#endif // MICROPY_JIT
+
+#endif // MICROPY_INCLUDED_PY_JIT_H
@@ -30,6 +30,7 @@
 
 #include "py/reader.h"
 #include "py/lexer.h"
+#include "py/jit.h"
 #include "py/runtime.h"
 
 #include "supervisor/shared/translate.h"
@@ -158,6 +159,22 @@ STATIC void swap_char_banks(mp_lexer_t *lex) {
 }
 #endif
 
+#if MICROPY_LEXER_FAST_SCAN
+STATIC unichar read_source_byte(mp_lexer_t *lex) {
+    if (lex->src_cur >= lex->src_end) {
+        size_t len = lex->reader.readblock(lex->reader.data, &lex->src_cur);
+        if (len == 0) {
+            lex->src_cur = lex->src_end = NULL;
+            return MP_LEXER_EOF;
+        }
+        lex->src_end = lex->src_cur + len;
+    }
+    return *lex->src_cur++;
+}
+#else
+#define read_source_byte(lex) ((lex)->reader.readbyte((lex)->reader.data))
+#endif
+
 STATIC void next_char(mp_lexer_t *lex) {
     if (lex->chr0 == '\n') {
         // a new line
@@ -184,7 +201,7 @@ STATIC void next_char(mp_lexer_t *lex) {
     } else
 #endif
     {
-        lex->chr2 = lex->reader.readbyte(lex->reader.data);
+        lex->chr2 = read_source_byte(lex);
     }
 
     if (lex->chr1 == '\r') {
@@ -192,7 +209,7 @@ STATIC void next_char(mp_lexer_t *lex) {
         lex->chr1 = '\n';
         if (lex->chr2 == '\n') {
             // CR LF is a single new line, throw out the extra LF
-            lex->chr2 = lex->reader.readbyte(lex->reader.data);
+            lex->chr2 = read_source_byte(lex);
         }
     }
 
@@ -209,6 +226,75 @@ STATIC void next_char(mp_lexer_t *lex) {
 #endif
 }
 
+#if MICROPY_LEXER_FAST_SCAN
+
+// kinds of character run that scan_run can consume
+enum {
+    SCAN_NAME,      // tail of an identifier
+    SCAN_DIGITS,    // decimal digits
+    SCAN_STR,       // string body characters with no special meaning
+    SCAN_FSTR,      // as above, in an f-string
+    SCAN_COMMENT,   // body of a comment
+};
+
+static inline bool scan_accepts(int kind, unichar c, unichar quote_char) {
+    switch (kind) {
+        case SCAN_NAME:
+            // as for is_tail_of_identifier, but never matching MP_LEXER_EOF
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')
+                || c == '_' || (c >= 0x80 && c < 0x100);
+        case SCAN_DIGITS:
+            return c >= '0' && c <= '9';
+        case SCAN_COMMENT:
+            return c < 0x100 && c != '\n' && c != '\r' && c != '\t';
+        default:
+            // tabs and newlines are left to next_char to keep track of the column
+            if (c >= 0x100 || c == quote_char || c == '\\' || c == '\n' || c == '\r' || c == '\t') {
+                return false;
+            }
+            return kind == SCAN_STR || (c != '{' && c != '}');
+    }
+}
+
+// If the current character and the two following it are all of the given
+// kind then consume them and the whole run of bytes of that kind after them
+// in the source block, in one go, appending them to the token text unless
+// it's a comment.  Returns false, consuming nothing, if the run is too short.
+STATIC bool scan_run(mp_lexer_t *lex, int kind, unichar quote_char) {
+    #if MICROPY_COMP_FSTRING_LITERAL
+    if (lex->vstr_postfix_processing) {
+        // the characters are coming from vstr_postfix, not the source
+        return false;
+    }
+    #endif
+    if (!scan_accepts(kind, lex->chr0, quote_char)
+        || !scan_accepts(kind, lex->chr1, quote_char)
+        || !scan_accepts(kind, lex->chr2, quote_char)) {
+        return false;
+    }
+    const byte *end = lex->src_cur;
+    while (end < lex->src_end && scan_accepts(kind, *end, quote_char)) {
+        ++end;
+    }
+    if (kind != SCAN_COMMENT) {
+        char *buf = vstr_add_len(&lex->vstr, 3 + (end - lex->src_cur));
+        buf[0] = lex->chr0;
+        buf[1] = lex->chr1;
+        buf[2] = lex->chr2;
+        memcpy(buf + 3, lex->src_cur, end - lex->src_cur);
+    }
+    // none of the bytes is a tab or newline, so each is worth one column
+    lex->column += end - lex->src_cur;
+    lex->src_cur = end;
+    // shift out chr0-2, reading the characters after the run
+    next_char(lex);
+    next_char(lex);
+    next_char(lex);
+    return true;
+}
+
+#endif
+
 STATIC void indent_push(mp_lexer_t *lex, size_t indent) {
     if (lex->num_indent_level >= lex->alloc_indent_level) {
         lex->indent_level = m_renew(uint16_t, lex->indent_level, lex->alloc_indent_level, lex->alloc_indent_level + MICROPY_ALLOC_LEXEL_INDENT_INC);
@@ -358,6 +444,17 @@ STATIC void parse_string_literal(mp_lexer_t *lex, bool is_raw, bool is_fstring)
             vstr_add_char(&lex->vstr, CUR_CHAR(lex));
         } else {
             n_closing = 0;
+#if MICROPY_LEXER_FAST_SCAN
+#if MICROPY_COMP_FSTRING_LITERAL
+            if (!in_expression && scan_run(lex, is_fstring ? SCAN_FSTR : SCAN_STR, quote_char)) {
+                continue;
+            }
+#else
+            if (scan_run(lex, SCAN_STR, quote_char)) {
+                continue;
+            }
+#endif
+#endif
 #if MICROPY_COMP_FSTRING_LITERAL
             if (is_fstring && is_char(lex, '{')) {
                 vstr_add_char(&lex->vstr, CUR_CHAR(lex));
@@ -527,6 +624,11 @@ STATIC bool skip_whitespace(mp_lexer_t *lex, bool stop_at_newline) {
         } else if (is_char(lex, '#')) {
             next_char(lex);
             while (!is_end(lex) && !is_physical_newline(lex)) {
+                #if MICROPY_LEXER_FAST_SCAN
+                if (scan_run(lex, SCAN_COMMENT, 0)) {
+                    continue;
+                }
+                #endif
                 next_char(lex);
             }
             // had_physical_newline will be set on next loop
@@ -693,6 +795,11 @@ void mp_lexer_to_next(mp_lexer_t *lex) {
 
         // get tail chars
         while (!is_end(lex) && is_tail_of_identifier(lex)) {
+            #if MICROPY_LEXER_FAST_SCAN
+            if (scan_run(lex, SCAN_NAME, 0)) {
+                continue;
+            }
+            #endif
             vstr_add_byte(&lex->vstr, CUR_CHAR(lex));
             next_char(lex);
         }
@@ -742,6 +849,11 @@ void mp_lexer_to_next(mp_lexer_t *lex) {
                     next_char(lex);
                 }
             } else if (is_letter(lex) || is_digit(lex) || is_char(lex, '.')) {
+                #if MICROPY_LEXER_FAST_SCAN
+                if (scan_run(lex, SCAN_DIGITS, 0)) {
+                    continue;
+                }
+                #endif
                 if (is_char_or3(lex, '.', 'j', 'J')) {
                     lex->tok_kind = MP_TOKEN_FLOAT_OR_IMAG;
                 }
@@ -829,6 +941,9 @@ mp_lexer_t *mp_lexer_new(qstr src_name, mp_reader_t reader) {
 
     lex->source_name = src_name;
     lex->reader = reader;
+    #if MICROPY_LEXER_FAST_SCAN
+    lex->src_cur = lex->src_end = NULL;
+    #endif
     lex->line = 1;
     lex->column = (size_t)-2; // account for 3 dummy bytes
     lex->emit_dent = 0;
@@ -872,9 +987,13 @@ mp_lexer_t *mp_lexer_new_from_str_len(qstr src_name, const char *str, size_t len
 #if MICROPY_READER_POSIX || MICROPY_READER_VFS
 
 mp_lexer_t *mp_lexer_new_from_file(const char *filename) {
+    qstr src_name = qstr_from_str(filename);
+    #if MICROPY_JIT
+    mp_jit_note_source(src_name);
+    #endif
     mp_reader_t reader;
     mp_reader_new_file(&reader, filename);
-    return mp_lexer_new(qstr_from_str(filename), reader);
+    return mp_lexer_new(src_name, reader);
 }
 
 #if MICROPY_HELPER_LEXER_UNIX
@@ -156,6 +156,10 @@ typedef enum _mp_token_kind_t {
 typedef struct _mp_lexer_t {
     qstr source_name;           // name of source
     mp_reader_t reader;         // stream source
+#if MICROPY_LEXER_FAST_SCAN
+    const byte *src_cur;        // unread part of the block last taken from reader
+    const byte *src_end;
+#endif
 
     unichar chr0, chr1, chr2;   // current cached characters from source
 #if MICROPY_COMP_FSTRING_LITERAL
@@ -75,13 +75,45 @@ C_ESCAPES = {
 }
 
 # this must match the equivalent function in qstr.c
-def compute_hash(qstr, bytes_hash):
-    hash = 5381
-    for b in qstr:
-        hash = (hash * 33) ^ b
+def compute_hash_full(qstr, fnv1a=False):
+    if fnv1a:
+        hash = 2166136261
+        for b in qstr:
+            hash = ((hash ^ b) * 16777619) & 0xffffffff
+    else:
+        hash = 5381
+        for b in qstr:
+            hash = ((hash * 33) ^ b) & 0xffffffff
+    return hash
+
+# this must match the equivalent function in qstr.c
+def compute_hash(qstr, bytes_hash, fnv1a=False):
+    hash = compute_hash_full(qstr, fnv1a)
+    if fnv1a:
+        # fold the upper bits down into the bytes that are stored
+        hash ^= hash >> 16
+        if bytes_hash == 1:
+            hash ^= hash >> 8
     # Make sure that valid hash is never zero, zero means "hash not computed"
     return (hash & ((1 << (8 * bytes_hash)) - 1)) or 1
 
+# this must match the probing in qstr.c
+def make_hash_index(hashes):
+    # hashes[i] is the full hash of pool entry i, or None for entries that are
+    # not to be indexed; returns the entries of the index (pool entry + 1)
+    size = 4
+    while size < len(hashes) + len(hashes) // 2:
+        size *= 2
+    index = [0] * size
+    for i, h in enumerate(hashes):
+        if h is None:
+            continue
+        pos = h & (size - 1)
+        while index[pos] != 0:
+            pos = (pos + 1) & (size - 1)
+        index[pos] = i + 1
+    return index
+
 def translate(translation_file, i18ns):
     with open(translation_file, "rb") as f:
         table = gettext.GNUTranslations(f)
@@ -303,10 +335,10 @@ def parse_input_headers(infiles):
 
     return qcfgs, qstrs, i18ns
 
-def make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr):
+def make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr, fnv1a=False):
     qbytes = bytes_cons(qstr, 'utf8')
     qlen = len(qbytes)
-    qhash = compute_hash(qbytes, cfg_bytes_hash)
+    qhash = compute_hash(qbytes, cfg_bytes_hash, fnv1a)
     if all(32 <= ord(c) <= 126 and c != '\\' and c != '"' for c in qstr):
         # qstr is all printable ASCII so render it as-is (for easier debugging)
         qdata = qstr
@@ -324,6 +356,7 @@ def print_qstr_data(encoding_table, qcfgs, qstrs, i18ns):
     # get config variables
     cfg_bytes_len = int(qcfgs['BYTES_IN_LEN'])
     cfg_bytes_hash = int(qcfgs['BYTES_IN_HASH'])
+    cfg_fnv1a = int(qcfgs.get('HASH_FNV1A', '0')) != 0
 
     # print out the starter of the generated C header file
     print('// This file was automatically generated by makeqstrdata.py')
@@ -335,10 +368,16 @@ def print_qstr_data(encoding_table, qcfgs, qstrs, i18ns):
     total_qstr_size = 0
     total_qstr_compressed_size = 0
     # go through each qstr and print it out
+    hashes = [None]
     for order, ident, qstr in sorted(qstrs.values(), key=lambda x: x[0]):
-        qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr)
+        qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr, cfg_fnv1a)
         print('QDEF(MP_QSTR_%s, %s)' % (ident, qbytes))
         total_qstr_size += len(qstr)
+        hashes.append(compute_hash_full(bytes_cons(qstr, 'utf8'), cfg_fnv1a))
+
+    # hash index over the qstrs above, used when MICROPY_QSTR_HASH_INDEX is enabled
+    for entry in make_hash_index(hashes):
+        print('QHASH(%u)' % entry)
 
     total_text_size = 0
     total_text_compressed_size = 0
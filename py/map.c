@@ -78,16 +78,106 @@ STATIC size_t get_hash_alloc_greater_or_equal_to(size_t x) {
 /******************************************************************************/
 /* map                                                                        */
 
+// A map that is not ordered uses a compact layout, similar to CPython 3.6+:
+// map->table is a dense array of map->alloc entries kept in insertion order,
+// with deleted entries marked by a key of MP_OBJ_SENTINEL.  Small maps whose
+// keys are all qstrs are searched linearly by pointer comparison.  All other
+// maps have a hash index stored directly after the entries, in the same heap
+// block:
+//
+//     mp_map_elem_t entries[alloc]
+//     size_t filled                 // number of entries used, including deleted
+//     uintN_t index[index_len]      // 0 = empty slot, else entry number + 1
+//
+// The index is a power-of-two sized open-addressed table of 1, 2 or 4 byte
+// entries (depending on alloc), so probe sequences touch only a few cache
+// lines, and growing or copying the map does not rehash the entries array.
+
+// Largest allocation for which a qstr-only map is searched linearly.
+#define MAP_LINEAR_MAX_ALLOC (8)
+
+static inline bool map_is_indexed(const mp_map_t *map) {
+    return !map->all_keys_are_qstrs || map->alloc > MAP_LINEAR_MAX_ALLOC;
+}
+
+STATIC size_t map_index_len(size_t alloc) {
+    // keep the index at most 2/3 full so a probe always finds an empty slot
+    size_t n = 4;
+    while (n < alloc + alloc / 2) {
+        n <<= 1;
+    }
+    return n;
+}
+
+static inline size_t map_index_width(size_t alloc) {
+    return alloc < 0xff ? 1 : alloc < 0xffff ? 2 : 4;
+}
+
+STATIC size_t map_table_nbytes(size_t alloc, bool indexed) {
+    size_t n = alloc * sizeof(mp_map_elem_t);
+    if (indexed) {
+        n += sizeof(size_t) + map_index_len(alloc) * map_index_width(alloc);
+    }
+    return n;
+}
+
+static inline size_t *map_filled(const mp_map_t *map) {
+    return (size_t*)&map->table[map->alloc];
+}
+
+static inline byte *map_index(const mp_map_t *map) {
+    return (byte*)(map_filled(map) + 1);
+}
+
+static inline size_t map_index_get(const byte *idx, size_t width, size_t pos) {
+    if (width == 1) {
+        return idx[pos];
+    } else if (width == 2) {
+        return ((const uint16_t*)idx)[pos];
+    } else {
+        return ((const uint32_t*)idx)[pos];
+    }
+}
+
+static inline void map_index_set(byte *idx, size_t width, size_t pos, size_t val) {
+    if (width == 1) {
+        idx[pos] = val;
+    } else if (width == 2) {
+        ((uint16_t*)idx)[pos] = val;
+    } else {
+        ((uint32_t*)idx)[pos] = val;
+    }
+}
+
+STATIC mp_uint_t map_hash(mp_obj_t key) {
+    // fast path for common case of qstr
+    if (MP_OBJ_IS_QSTR(key)) {
+        return qstr_hash(MP_OBJ_QSTR_VALUE(key));
+    } else {
+        return MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, key));
+    }
+}
+
+STATIC void map_index_insert(byte *idx, size_t alloc, mp_uint_t hash, size_t entry) {
+    size_t width = map_index_width(alloc);
+    size_t mask = map_index_len(alloc) - 1;
+    size_t pos = hash & mask;
+    while (map_index_get(idx, width, pos) != 0) {
+        pos = (pos + 1) & mask;
+    }
+    map_index_set(idx, width, pos, entry + 1);
+}
+
 void mp_map_init(mp_map_t *map, size_t n) {
+    map->all_keys_are_qstrs = 1;
     if (n == 0) {
         map->alloc = 0;
         map->table = NULL;
     } else {
         map->alloc = n;
-        map->table = m_new0(mp_map_elem_t, map->alloc);
+        map->table = (mp_map_elem_t*)m_new0(byte, map_table_nbytes(n, n > MAP_LINEAR_MAX_ALLOC));
     }
     map->used = 0;
-    map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->is_ordered = 0;
 }
@@ -101,17 +191,28 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->table = (mp_map_elem_t*)table;
 }
 
+void mp_map_init_copy(mp_map_t *map, const mp_map_t *src) {
+    size_t nbytes = map_table_nbytes(src->alloc, !src->is_ordered && map_is_indexed(src));
+    map->table = (mp_map_elem_t*)m_new(byte, nbytes);
+    memcpy(map->table, src->table, nbytes);
+    map->alloc = src->alloc;
+    map->used = src->used;
+    map->all_keys_are_qstrs = src->all_keys_are_qstrs;
+    map->is_fixed = 0;
+    map->is_ordered = src->is_ordered;
+}
+
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        m_del(byte, map->table, map_table_nbytes(map->alloc, !map->is_ordered && map_is_indexed(map)));
     }
     map->used = map->alloc = 0;
 }
 
 void mp_map_clear(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        m_del(byte, map->table, map_table_nbytes(map->alloc, !map->is_ordered && map_is_indexed(map)));
     }
     map->alloc = 0;
     map->used = 0;
@@ -120,23 +221,46 @@ void mp_map_clear(mp_map_t *map) {
     map->table = NULL;
 }
 
-STATIC void mp_map_rehash(mp_map_t *map) {
+// Rebuild the map so that it has room for at least one more entry, dropping
+// deleted entries.  new_key is the key about to be added; it decides, along
+// with the existing keys, whether the new table needs a hash index.
+STATIC void mp_map_rehash(mp_map_t *map, mp_obj_t new_key) {
     size_t old_alloc = map->alloc;
-    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
+    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->used + map->used / 4 + 1);
     DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
     mp_map_elem_t *old_table = map->table;
-    mp_map_elem_t *new_table = m_new0(mp_map_elem_t, new_alloc);
-    // If we reach this point, table resizing succeeded, now we can edit the old map.
-    map->alloc = new_alloc;
-    map->used = 0;
-    map->all_keys_are_qstrs = 1;
-    map->table = new_table;
+    bool old_indexed = map_is_indexed(map);
+
+    bool qstrs_only = MP_OBJ_IS_QSTR(new_key);
+    for (size_t i = 0; i < old_alloc && qstrs_only; i++) {
+        if (MP_MAP_SLOT_IS_FILLED(map, i) && !MP_OBJ_IS_QSTR(old_table[i].key)) {
+            qstrs_only = false;
+        }
+    }
+    bool new_indexed = !qstrs_only || new_alloc > MAP_LINEAR_MAX_ALLOC;
+
+    // Build the new table fully before touching the map, because hashing a
+    // key may raise an exception.
+    mp_map_elem_t *new_table = (mp_map_elem_t*)m_new0(byte, map_table_nbytes(new_alloc, new_indexed));
+    byte *new_idx = (byte*)((size_t*)&new_table[new_alloc] + 1);
+    size_t n = 0;
     for (size_t i = 0; i < old_alloc; i++) {
-        if (old_table[i].key != MP_OBJ_NULL && old_table[i].key != MP_OBJ_SENTINEL) {
-            mp_map_lookup(map, old_table[i].key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND)->value = old_table[i].value;
+        if (MP_MAP_SLOT_IS_FILLED(map, i)) {
+            new_table[n] = old_table[i];
+            if (new_indexed) {
+                map_index_insert(new_idx, new_alloc, map_hash(old_table[i].key), n);
+            }
+            n++;
         }
     }
-    m_del(mp_map_elem_t, old_table, old_alloc);
+    if (new_indexed) {
+        *(size_t*)&new_table[new_alloc] = n;
+    }
+
+    map->alloc = new_alloc;
+    map->all_keys_are_qstrs = qstrs_only;
+    map->table = new_table;
+    m_del(byte, old_table, map_table_nbytes(old_alloc, old_indexed));
 }
 
 // MP_MAP_LOOKUP behaviour:
@@ -144,7 +268,8 @@ STATIC void mp_map_rehash(mp_map_t *map) {
 // MP_MAP_LOOKUP_ADD_IF_NOT_FOUND behaviour:
 //  - returns slot, with key non-null and value=MP_OBJ_NULL if it was added
 // MP_MAP_LOOKUP_REMOVE_IF_FOUND behaviour:
-//  - returns NULL if not found, else the slot if was found in with key null and value non-null
+//  - returns NULL if not found, else the slot if was found in with key null or
+//    MP_OBJ_SENTINEL and value non-null
 mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind) {
     // If the map is a fixed array then we must only be called for a lookup
     assert(!map->is_fixed || lookup_kind == MP_MAP_LOOKUP);
@@ -208,93 +333,102 @@ mp_map_elem_t *PLACE_IN_ITCM(mp_map_lookup)(mp_map_t *map, mp_obj_t index, mp_ma
         #endif
     }
 
-    // map is a hash table (not an ordered array), so do a hash lookup
+    // map is a compact table (not an ordered array)
+
+    mp_map_elem_t *elem;
+
+    if (!map_is_indexed(map)) {
+        // small map with only qstr keys: search the entries directly
+        size_t i = 0;
+        for (; i < map->alloc; i++) {
+            elem = &map->table[i];
+            if (elem->key == MP_OBJ_NULL) {
+                // reached the end of the filled entries
+                break;
+            }
+            if (elem->key == index || (!compare_only_ptrs && elem->key != MP_OBJ_SENTINEL && mp_obj_equal(elem->key, index))) {
+                goto found;
+            }
+        }
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+        if (i < map->alloc && MP_OBJ_IS_QSTR(index)) {
+            // the entry at the end of the filled part is free, use it
+            map->used++;
+            elem->key = index;
+            elem->value = MP_OBJ_NULL;
+            return elem;
+        }
+        // map is full, or the new key needs a hash index
+        mp_map_rehash(map, index);
+        if (!map_is_indexed(map)) {
+            elem = &map->table[map->used++];
+            elem->key = index;
+            elem->value = MP_OBJ_NULL;
+            return elem;
+        }
+        // fall through to add the key to the now-indexed map
+    }
+
+    mp_uint_t hash = map_hash(index);
 
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
-            mp_map_rehash(map);
+            mp_map_rehash(map, index);
         } else {
             return NULL;
         }
     }
 
-    // get hash of index, with fast path for common case of qstr
-    mp_uint_t hash;
-    if (MP_OBJ_IS_QSTR(index)) {
-        hash = qstr_hash(MP_OBJ_QSTR_VALUE(index));
-    } else {
-        hash = MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
-    }
-
-    size_t pos = hash % map->alloc;
-    size_t start_pos = pos;
-    mp_map_elem_t *avail_slot = NULL;
     for (;;) {
-        mp_map_elem_t *slot = &map->table[pos];
-        if (slot->key == MP_OBJ_NULL) {
-            // found NULL slot, so index is not in table
-            if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
-                map->used += 1;
-                if (avail_slot == NULL) {
-                    avail_slot = slot;
-                }
-                avail_slot->key = index;
-                avail_slot->value = MP_OBJ_NULL;
-                if (!MP_OBJ_IS_QSTR(index)) {
-                    map->all_keys_are_qstrs = 0;
-                }
-                return avail_slot;
-            } else {
-                return NULL;
+        byte *idx = map_index(map);
+        size_t width = map_index_width(map->alloc);
+        size_t mask = map_index_len(map->alloc) - 1;
+        size_t pos = hash & mask;
+        for (;;) {
+            size_t entry = map_index_get(idx, width, pos);
+            if (entry == 0) {
+                // found empty index slot, so index is not in table
+                break;
             }
-        } else if (slot->key == MP_OBJ_SENTINEL) {
-            // found deleted slot, remember for later
-            if (avail_slot == NULL) {
-                avail_slot = slot;
-            }
-        } else if (slot->key == index || (!compare_only_ptrs && mp_obj_equal(slot->key, index))) {
-            // found index
-            // Note: CPython does not replace the index; try x={True:'true'};x[1]='one';x
-            if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
-                // delete element in this slot
-                map->used--;
-                if (map->table[(pos + 1) % map->alloc].key == MP_OBJ_NULL) {
-                    // optimisation if next slot is empty
-                    slot->key = MP_OBJ_NULL;
-                } else {
-                    slot->key = MP_OBJ_SENTINEL;
-                }
-                // keep slot->value so that caller can access it if needed
+            elem = &map->table[entry - 1];
+            if (elem->key == index || (!compare_only_ptrs && elem->key != MP_OBJ_SENTINEL && mp_obj_equal(elem->key, index))) {
+                goto found;
             }
-            return slot;
+            pos = (pos + 1) & mask;
         }
 
-        // not yet found, keep searching in this table
-        pos = (pos + 1) % map->alloc;
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
 
-        if (pos == start_pos) {
-            // search got back to starting position, so index is not in table
-            if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
-                if (avail_slot != NULL) {
-                    // there was an available slot, so use that
-                    map->used++;
-                    avail_slot->key = index;
-                    avail_slot->value = MP_OBJ_NULL;
-                    if (!MP_OBJ_IS_QSTR(index)) {
-                        map->all_keys_are_qstrs = 0;
-                    }
-                    return avail_slot;
-                } else {
-                    // not enough room in table, rehash it
-                    mp_map_rehash(map);
-                    // restart the search for the new element
-                    start_pos = pos = hash % map->alloc;
-                }
-            } else {
-                return NULL;
+        size_t *filled = map_filled(map);
+        if (*filled < map->alloc) {
+            // append the new entry and point the empty index slot at it
+            elem = &map->table[*filled];
+            map_index_set(idx, width, pos, ++*filled);
+            map->used++;
+            elem->key = index;
+            elem->value = MP_OBJ_NULL;
+            if (!MP_OBJ_IS_QSTR(index)) {
+                map->all_keys_are_qstrs = 0;
             }
+            return elem;
         }
+
+        // not enough room in table, rehash it and restart the search for the new element
+        mp_map_rehash(map, index);
+    }
+
+found:
+    // Note: CPython does not replace the index; try x={True:'true'};x[1]='one';x
+    if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+        // mark the entry as deleted; keep elem->value so that caller can access it if needed
+        map->used--;
+        elem->key = MP_OBJ_SENTINEL;
     }
+    return elem;
 }
 
 /******************************************************************************/
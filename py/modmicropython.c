@@ -49,6 +49,20 @@ STATIC mp_obj_t mp_micropython_opt_level(size_t n_args, const mp_obj_t *args) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_opt_level_obj, 0, 1, mp_micropython_opt_level);
 #endif
 
+#if MICROPY_MODULE_BYTECODE_CACHE
+STATIC mp_obj_t mp_micropython_bytecode_cache(size_t n_args, const mp_obj_t *args) {
+    if (n_args == 0) {
+        return mp_obj_new_bool(MP_STATE_VM(bytecode_cache_enabled));
+    } else {
+        MP_STATE_VM(bytecode_cache_enabled) = mp_obj_is_true(args[0]);
+        // try saving again, eg after remounting a filesystem read-write
+        MP_STATE_VM(bytecode_cache_writable) = true;
+        return mp_const_none;
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_micropython_bytecode_cache_obj, 0, 1, mp_micropython_bytecode_cache);
+#endif
+
 #if MICROPY_PY_MICROPYTHON_MEM_INFO
 
 #if MICROPY_MEM_STATS
@@ -73,6 +87,9 @@ mp_obj_t mp_micropython_mem_info(size_t n_args, const mp_obj_t *args) {
 #if MICROPY_MEM_STATS
     mp_printf(&mp_plat_print, "mem: total=" UINT_FMT ", current=" UINT_FMT ", peak=" UINT_FMT "\n",
         (mp_uint_t)m_get_total_bytes_allocated(), (mp_uint_t)m_get_current_bytes_allocated(), (mp_uint_t)m_get_peak_bytes_allocated());
+#if MICROPY_ENABLE_COMPILER
+    mp_printf(&mp_plat_print, "compile: peak=" UINT_FMT "\n", (mp_uint_t)MP_STATE_MEM(peak_parse_tree_bytes));
+#endif
 #endif
 #if MICROPY_STACK_CHECK
     mp_printf(&mp_plat_print, "stack: " UINT_FMT " out of " UINT_FMT "\n",
@@ -165,6 +182,9 @@ STATIC const mp_rom_map_elem_t mp_module_micropython_globals_table[] = {
     #if MICROPY_ENABLE_COMPILER
     { MP_ROM_QSTR(MP_QSTR_opt_level), MP_ROM_PTR(&mp_micropython_opt_level_obj) },
     #endif
+    #if MICROPY_MODULE_BYTECODE_CACHE
+    { MP_ROM_QSTR(MP_QSTR_bytecode_cache), MP_ROM_PTR(&mp_micropython_bytecode_cache_obj) },
+    #endif
 #if MICROPY_PY_MICROPYTHON_MEM_INFO
 #if MICROPY_MEM_STATS
     { MP_ROM_QSTR(MP_QSTR_mem_total), MP_ROM_PTR(&mp_micropython_mem_total_obj) },
@@ -0,0 +1,203 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/bc.h"
+#include "py/mphal.h"
+#include "py/objfun.h"
+#include "py/profile.h"
+#include "py/runtime.h"
+
+#if MICROPY_PY_UPROFILE
+
+// Number of table entries mp_prof_sample() looks at before giving up, to
+// bound the time it takes when the table is nearly full.
+#define PROF_MAX_PROBE (8)
+
+void mp_prof_sample(void) {
+    mp_prof_entry_t *table = MP_STATE_VM(prof_table);
+    if (!MP_STATE_VM(prof_running) || table == NULL) {
+        return;
+    }
+
+    // Only the main thread is sampled.  Its state is read directly rather
+    // than through mp_thread_get_state(), which isn't safe to call from a
+    // signal handler.
+    const mp_code_state_t *code_state = mp_state_ctx.thread.prof_code_state;
+    if (code_state == NULL) {
+        // not executing any bytecode
+        MP_STATE_VM(prof_missed) += 1;
+        return;
+    }
+
+    const mp_obj_fun_bc_t *fun_bc = code_state->fun_bc;
+    uint32_t offset = code_state->ip - fun_bc->bytecode;
+    size_t h = ((uintptr_t)fun_bc >> 2) + offset * 31;
+    for (size_t i = 0; i < PROF_MAX_PROBE; ++i) {
+        mp_prof_entry_t *e = &table[(h + i) % MICROPY_PY_UPROFILE_TABLE_SIZE];
+        if (e->fun_bc == fun_bc && e->offset == offset) {
+            e->count += 1;
+            return;
+        }
+        if (e->fun_bc == NULL) {
+            e->offset = offset;
+            e->count = 1;
+            e->fun_bc = fun_bc;
+            return;
+        }
+    }
+
+    // no room in the table
+    MP_STATE_VM(prof_missed) += 1;
+}
+
+void mp_prof_reset(void) {
+    MP_STATE_VM(prof_running) = false;
+    MP_STATE_VM(prof_table) = NULL;
+    MP_STATE_VM(prof_missed) = 0;
+    MP_STATE_THREAD(prof_code_state) = NULL;
+}
+
+// start(): start counting samples, adding to any counts so far
+STATIC mp_obj_t uprofile_start(void) {
+    if (MP_STATE_VM(prof_table) == NULL) {
+        MP_STATE_VM(prof_table) = m_new0(mp_prof_entry_t, MICROPY_PY_UPROFILE_TABLE_SIZE);
+    }
+    MP_STATE_VM(prof_running) = true;
+    MICROPY_PY_UPROFILE_HOOK_START
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_start_obj, uprofile_start);
+
+// stop(): stop counting samples
+STATIC mp_obj_t uprofile_stop(void) {
+    MICROPY_PY_UPROFILE_HOOK_STOP
+    MP_STATE_VM(prof_running) = false;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_stop_obj, uprofile_stop);
+
+// clear(): reset all counts to zero
+STATIC mp_obj_t uprofile_clear(void) {
+    if (MP_STATE_VM(prof_table) != NULL) {
+        memset(MP_STATE_VM(prof_table), 0, MICROPY_PY_UPROFILE_TABLE_SIZE * sizeof(mp_prof_entry_t));
+    }
+    MP_STATE_VM(prof_missed) = 0;
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_clear_obj, uprofile_clear);
+
+// missed(): return the number of samples taken while no bytecode was
+// running, or that didn't fit in the table
+STATIC mp_obj_t uprofile_missed(void) {
+    return mp_obj_new_int_from_uint(MP_STATE_VM(prof_missed));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_missed_obj, uprofile_missed);
+
+typedef struct _prof_line_t {
+    const mp_obj_fun_bc_t *fun_bc;
+    qstr block_name;
+    qstr source_file;
+    size_t source_line;
+    size_t count;
+} prof_line_t;
+
+// report(): return a list of (count, file, function, line) tuples, with
+// the most often sampled line first
+STATIC mp_obj_t uprofile_report(void) {
+    mp_obj_t list = mp_obj_new_list(0, NULL);
+    const mp_prof_entry_t *table = MP_STATE_VM(prof_table);
+    if (table == NULL) {
+        return list;
+    }
+
+    // combine the counts of bytecode locations on the same line
+    prof_line_t *lines = m_new(prof_line_t, MICROPY_PY_UPROFILE_TABLE_SIZE);
+    size_t n = 0;
+    for (size_t i = 0; i < MICROPY_PY_UPROFILE_TABLE_SIZE; ++i) {
+        const mp_obj_fun_bc_t *fun_bc = table[i].fun_bc;
+        size_t count = table[i].count;
+        if (fun_bc == NULL || count == 0) {
+            continue;
+        }
+        prof_line_t l;
+        mp_bytecode_get_source_info(fun_bc, fun_bc->bytecode + table[i].offset,
+            &l.block_name, &l.source_file, &l.source_line);
+        size_t j = 0;
+        while (j < n && (lines[j].fun_bc != fun_bc || lines[j].source_line != l.source_line)) {
+            ++j;
+        }
+        if (j == n) {
+            l.fun_bc = fun_bc;
+            l.count = 0;
+            lines[n++] = l;
+        }
+        lines[j].count += count;
+    }
+
+    // sort by count, highest first; there are few lines so use insertion sort
+    for (size_t i = 1; i < n; ++i) {
+        prof_line_t l = lines[i];
+        size_t j = i;
+        for (; j > 0 && lines[j - 1].count < l.count; --j) {
+            lines[j] = lines[j - 1];
+        }
+        lines[j] = l;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        mp_obj_t items[4] = {
+            mp_obj_new_int_from_uint(lines[i].count),
+            MP_OBJ_NEW_QSTR(lines[i].source_file),
+            MP_OBJ_NEW_QSTR(lines[i].block_name),
+            MP_OBJ_NEW_SMALL_INT(lines[i].source_line),
+        };
+        mp_obj_list_append(list, mp_obj_new_tuple(4, items));
+    }
+
+    m_del(prof_line_t, lines, MICROPY_PY_UPROFILE_TABLE_SIZE);
+    return list;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(uprofile_report_obj, uprofile_report);
+
+STATIC const mp_rom_map_elem_t mp_module_uprofile_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_uprofile) },
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&uprofile_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&uprofile_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&uprofile_clear_obj) },
+    { MP_ROM_QSTR(MP_QSTR_missed), MP_ROM_PTR(&uprofile_missed_obj) },
+    { MP_ROM_QSTR(MP_QSTR_report), MP_ROM_PTR(&uprofile_report_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(mp_module_uprofile_globals, mp_module_uprofile_globals_table);
+
+const mp_obj_module_t mp_module_uprofile = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_uprofile_globals,
+};
+
+#endif // MICROPY_PY_UPROFILE
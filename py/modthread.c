@@ -164,6 +164,10 @@ STATIC void *thread_entry(void *args_in) {
     mp_state_thread_t ts;
     mp_thread_set_state(&ts);
 
+    #if MICROPY_PY_UPROFILE
+    ts.prof_code_state = NULL;
+    #endif
+
     mp_stack_set_top(&ts + 1); // need to include ts in root-pointer scan
     mp_stack_set_limit(args->stack_size);
 
@@ -173,6 +177,11 @@ STATIC void *thread_entry(void *args_in) {
     mp_pystack_init(mini_pystack, &mini_pystack[128]);
     #endif
 
+    #if MICROPY_FRAME_ARENA
+    // only the main thread has a frame arena
+    mp_frame_arena_init(NULL, NULL);
+    #endif
+
     // set locals and globals from the calling context
     mp_locals_set(args->dict_locals);
     mp_globals_set(args->dict_globals);
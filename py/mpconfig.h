@@ -221,6 +221,22 @@
 #define MICROPY_QSTR_BYTES_IN_HASH (2)
 #endif
 
+// Whether to hash qstrs with FNV-1a instead of djb2.  FNV-1a spreads short,
+// similar identifiers more evenly over the truncated hash, at the cost of a
+// multiply per byte.  Must match the hash used by makeqstrdata.py, which
+// picks it up automatically via qstrdefs.h.
+#ifndef MICROPY_QSTR_HASH_FNV1A
+#define MICROPY_QSTR_HASH_FNV1A (0)
+#endif
+
+// Whether to keep hash indexes over the qstr pools so that qstr_find_strn
+// does not need to scan every pool.  The index over the const qstrs costs
+// 3-6 bytes of ROM per qstr, and the index over dynamically created qstrs
+// 6-12 bytes of RAM per qstr.
+#ifndef MICROPY_QSTR_HASH_INDEX
+#define MICROPY_QSTR_HASH_INDEX (0)
+#endif
+
 // Avoid using C stack when making Python function calls. C stack still
 // may be used if there's no free heap.
 #ifndef MICROPY_STACKLESS
@@ -260,6 +276,16 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// Whether persistent code loaded from memory-mapped storage can be executed
+// in place, instead of being copied to the heap.  The port must provide
+// mp_persistent_code_map_file() to map a .mpy file into memory.  Files it
+// can't map are loaded into the heap as usual; with MICROPY_READER_VFS the
+// unix port only maps files on a VfsPosix mount, and no port maps files on a
+// FAT filesystem, whose clusters need not be contiguous in flash.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_XIP
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (0)
+#endif
+
 // Whether to support saving of persistent code
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
 #define MICROPY_PERSISTENT_CODE_SAVE (0)
@@ -319,9 +345,45 @@
 // Convenience definition for whether any native emitter is enabled
 #define MICROPY_EMIT_NATIVE (MICROPY_EMIT_X64 || MICROPY_EMIT_X86 || MICROPY_EMIT_THUMB || MICROPY_EMIT_ARM || MICROPY_EMIT_XTENSA)
 
+// Whether viper has an unboxed float type, which needs a float to fit in a machine word
+#define MICROPY_EMIT_NATIVE_FLOAT (MICROPY_EMIT_NATIVE && MICROPY_FLOAT_IMPL != MICROPY_FLOAT_IMPL_NONE \
+    && (MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT || UINTPTR_MAX > 0xffffffff))
+
 // Convenience definition for whether any inline assembler emitter is enabled
 #define MICROPY_EMIT_INLINE_ASM (MICROPY_EMIT_INLINE_THUMB || MICROPY_EMIT_INLINE_XTENSA)
 
+// Whether native code can be saved to .mpy files.  The native emitter then
+// loads all runtime addresses and qstrs with full-width immediates and records
+// where they are, so the loader can relocate the code.  Only x64 is supported.
+#ifndef MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+#define MICROPY_PERSISTENT_CODE_SAVE_NATIVE (MICROPY_PERSISTENT_CODE_SAVE && MICROPY_DYNAMIC_COMPILER && MICROPY_EMIT_X64)
+#endif
+
+// Whether native code in .mpy files can be loaded, if it was built for the
+// architecture of the enabled native emitter.  Only x64 is supported, as only
+// x64 code can be saved.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_NATIVE
+#define MICROPY_PERSISTENT_CODE_LOAD_NATIVE (MICROPY_PERSISTENT_CODE_LOAD && MICROPY_EMIT_X64)
+#endif
+
+// Whether to compile hot bytecode functions to native code at runtime.  The VM
+// counts the backward jumps each function takes, and once it has taken
+// MICROPY_JIT_THRESHOLD of them the function is compiled again from its source
+// file with the native emitter, and later calls run the native code.  A file
+// that has changed since it was imported isn't compiled again, and neither
+// are functions using what native code doesn't support as the VM does, such
+// as with, try and possibly unbound locals.  Compiled code records the line
+// of each statement it starts, for tracebacks.  Requires the native emitter
+// and MICROPY_PERSISTENT_CODE.
+#ifndef MICROPY_JIT
+#define MICROPY_JIT (0)
+#endif
+
+// Number of backward jumps before a function is compiled, less than 0xffff
+#ifndef MICROPY_JIT_THRESHOLD
+#define MICROPY_JIT_THRESHOLD (1000)
+#endif
+
 /*****************************************************************************/
 /* Compiler configuration                                                    */
 
@@ -349,6 +411,21 @@
 #define MICROPY_COMP_CONST_FOLDING (1)
 #endif
 
+// Whether to fold float arithmetic and true division; eg 2.0*0.5 rewritten as 1.0
+#ifndef MICROPY_COMP_CONST_FLOAT
+#define MICROPY_COMP_CONST_FLOAT (0)
+#endif
+
+// Whether to fold concatenation of string and bytes literals; eg "a"+"b" rewritten as "ab"
+#ifndef MICROPY_COMP_CONST_STR
+#define MICROPY_COMP_CONST_STR (0)
+#endif
+
+// Whether to make a tuple of constants a single constant; eg (1, 2) loaded in one opcode
+#ifndef MICROPY_COMP_CONST_TUPLE
+#define MICROPY_COMP_CONST_TUPLE (0)
+#endif
+
 // Whether to enable lookup of constants in modules; eg module.CONST
 #ifndef MICROPY_COMP_MODULE_CONST
 #define MICROPY_COMP_MODULE_CONST (0)
@@ -382,6 +459,13 @@
 #define MICROPY_COMP_FSTRING_LITERAL (1)
 #endif
 
+// Whether the lexer takes its source from the reader a block at a time and
+// scans runs of name, digit, string and comment characters straight out of
+// that block, rather than going through the reader for every byte
+#ifndef MICROPY_LEXER_FAST_SCAN
+#define MICROPY_LEXER_FAST_SCAN (0)
+#endif
+
 /*****************************************************************************/
 /* Internal debugging stuff                                                  */
 
@@ -426,6 +510,51 @@
 #define MICROPY_OPT_MPZ_BITWISE (0)
 #endif
 
+// Whether to use asymptotically faster algorithms for large mpz integers:
+// Karatsuba multiplication, Montgomery reduction for pow() with an odd
+// modulus, and divide-and-conquer conversion to a string.  Costs code size.
+#ifndef MICROPY_OPT_MPZ_LARGE
+#define MICROPY_OPT_MPZ_LARGE (0)
+#endif
+
+// Minimum number of digits in both operands for Karatsuba multiplication to
+// be used (must be at least 4).
+#ifndef MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD
+#define MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD (32)
+#endif
+
+// Whether str.format and str % args have a fast path for format strings whose
+// fields are all plain "{}", or "%s" and "%d": the output is sized up front
+// and str arguments are copied straight in.  The shape of constant (interned)
+// format strings is remembered in a small cache.
+#ifndef MICROPY_OPT_STR_FORMAT_SIMPLE
+#define MICROPY_OPT_STR_FORMAT_SIMPLE (0)
+#endif
+
+// Number of entries in the cache of simple format strings (a power of 2)
+#ifndef MICROPY_OPT_STR_FORMAT_CACHE_SIZE
+#define MICROPY_OPT_STR_FORMAT_CACHE_SIZE (8)
+#endif
+
+// Whether s += x on str and bytes gives the result spare room, so that the
+// next += on that result can append in place instead of copying the whole
+// string.  This makes building a string piece by piece linear rather than
+// quadratic, at the cost of some unused memory at the end of such strings.
+// The last MICROPY_OPT_STR_INPLACE_ADD_SLOTS such results, with their spare
+// room, stay reachable until later += results replace them, even when nothing
+// else refers to them.  With this option the data returned by
+// mp_obj_str_get_data() isn't always followed by a null byte, so code that
+// needs one must use mp_obj_str_get_str().  That only allocates, to make a
+// terminated copy, for a string whose buffer a later += has since appended to.
+#ifndef MICROPY_OPT_STR_INPLACE_ADD
+#define MICROPY_OPT_STR_INPLACE_ADD (0)
+#endif
+
+// Number of strings being built up with += that can be tracked at once
+#ifndef MICROPY_OPT_STR_INPLACE_ADD_SLOTS
+#define MICROPY_OPT_STR_INPLACE_ADD_SLOTS (4)
+#endif
+
 /*****************************************************************************/
 /* Python internal features                                                  */
 
@@ -446,6 +575,17 @@
 #define MICROPY_READER_VFS (0)
 #endif
 
+// Size of the buffer the VFS reader tries to use, ideally a whole filesystem
+// block so that each read of the underlying file is as cheap as possible
+#ifndef MICROPY_READER_VFS_BUF_SIZE
+#define MICROPY_READER_VFS_BUF_SIZE (512)
+#endif
+
+// Size of the buffer the VFS reader falls back to if memory is short
+#ifndef MICROPY_READER_VFS_BUF_SIZE_MIN
+#define MICROPY_READER_VFS_BUF_SIZE_MIN (24)
+#endif
+
 // Number of VFS mounts to persist across soft-reset.
 #ifndef MICROPY_FATFS_NUM_PERSISTENT
 #define MICROPY_FATFS_NUM_PERSISTENT (0)
@@ -488,6 +628,15 @@
 #define MICROPY_PYSTACK_ALIGN (8)
 #endif
 
+// Size in bytes of the frame arena, a fixed region that bytecode function calls
+// take their state from in LIFO order before falling back to the heap or C stack.
+// Only the main thread uses it, and it's not needed with MICROPY_ENABLE_PYSTACK.
+// Set to 0 to disable.
+#ifndef MICROPY_FRAME_ARENA_SIZE
+#define MICROPY_FRAME_ARENA_SIZE (0)
+#endif
+#define MICROPY_FRAME_ARENA (MICROPY_FRAME_ARENA_SIZE > 0 && !MICROPY_ENABLE_PYSTACK)
+
 // Whether to check C stack usage. C stack used for calling Python functions,
 // etc. Not checking means segfault on overflow.
 #ifndef MICROPY_STACK_CHECK
@@ -676,6 +825,35 @@ typedef double mp_float_t;
 #define MICROPY_MODULE_FROZEN (MICROPY_MODULE_FROZEN_STR || MICROPY_MODULE_FROZEN_MPY)
 #endif
 
+// Whether imported .py files are compiled once and the code cached in a .mpy
+// file in a subdirectory, for the next import to load instead of compiling.
+// Requires MICROPY_VFS, MICROPY_PERSISTENT_CODE_LOAD and _SAVE.  It can be
+// turned off at runtime with micropython.bytecode_cache(False).
+#ifndef MICROPY_MODULE_BYTECODE_CACHE
+#define MICROPY_MODULE_BYTECODE_CACHE (0)
+#endif
+
+// Name of the subdirectory, next to the source, that holds cached code
+#ifndef MICROPY_MODULE_BYTECODE_CACHE_DIR
+#define MICROPY_MODULE_BYTECODE_CACHE_DIR ".mpycache"
+#endif
+
+// Whether the results of the filesystem probes made while resolving an import
+// (positive and negative) are remembered, so that repeated failed imports and
+// imports of package submodules don't stat every sys.path entry again.  The
+// cache is dropped when the VFS changes in a way that could affect imports.
+// Requires MICROPY_VFS.  Only filesystems that change solely through their VFS
+// object (VfsFat) are cached; VfsPosix and filesystems written in Python can be
+// changed behind the VFS's back and are always probed.
+#ifndef MICROPY_MODULE_STAT_CACHE
+#define MICROPY_MODULE_STAT_CACHE (0)
+#endif
+
+// Maximum number of paths held in the import stat cache; it is emptied when full
+#ifndef MICROPY_MODULE_STAT_CACHE_MAX
+#define MICROPY_MODULE_STAT_CACHE_MAX (64)
+#endif
+
 // Whether you can override builtins in the builtins module
 #ifndef MICROPY_CAN_OVERRIDE_BUILTINS
 #define MICROPY_CAN_OVERRIDE_BUILTINS (0)
@@ -725,6 +903,13 @@ typedef double mp_float_t;
 #define MICROPY_VFS_FAT (0)
 #endif
 
+// Whether FAT files opened for writing can collect writes in a buffer (the
+// buffering argument to open()) and commit the FAT and directory entry on a
+// size/time policy (file.autosync()) rather than on every flush
+#ifndef MICROPY_VFS_FAT_WRITEBEHIND
+#define MICROPY_VFS_FAT_WRITEBEHIND (0)
+#endif
+
 /*****************************************************************************/
 /* Fine control over Python builtins, classes, modules, etc                  */
 
@@ -1126,6 +1311,26 @@ typedef double mp_float_t;
 #define MICROPY_PY_UERRNO_ERRORCODE (1)
 #endif
 
+// Whether to provide "uprofile" module, a sampling profiler for bytecode.
+// The port must call mp_prof_sample() periodically, eg from a timer tick.
+#ifndef MICROPY_PY_UPROFILE
+#define MICROPY_PY_UPROFILE (0)
+#endif
+
+// Number of distinct bytecode locations the profiler can count
+#ifndef MICROPY_PY_UPROFILE_TABLE_SIZE
+#define MICROPY_PY_UPROFILE_TABLE_SIZE (128)
+#endif
+
+// Hooks for a port to start/stop the timer that calls mp_prof_sample(), if
+// it is not always running
+#ifndef MICROPY_PY_UPROFILE_HOOK_START
+#define MICROPY_PY_UPROFILE_HOOK_START
+#endif
+#ifndef MICROPY_PY_UPROFILE_HOOK_STOP
+#define MICROPY_PY_UPROFILE_HOOK_STOP
+#endif
+
 // Whether to provide "uselect" module (baremetal implementation)
 #ifndef MICROPY_PY_USELECT
 #define MICROPY_PY_USELECT (0)
@@ -1178,6 +1383,20 @@ typedef double mp_float_t;
 #define MICROPY_PY_UJSON (0)
 #endif
 
+// Size of the buffers on the C stack that ujson.load and ujson.dump use to
+// read and write a stream in chunks, rather than a byte or token at a time
+#ifndef MICROPY_PY_UJSON_READ_BUF_SIZE
+#define MICROPY_PY_UJSON_READ_BUF_SIZE (128)
+#endif
+#ifndef MICROPY_PY_UJSON_WRITE_BUF_SIZE
+#define MICROPY_PY_UJSON_WRITE_BUF_SIZE (128)
+#endif
+
+// Whether to provide ujson.iterparse, an event-driven incremental parser
+#ifndef MICROPY_PY_UJSON_ITERPARSE
+#define MICROPY_PY_UJSON_ITERPARSE (0)
+#endif
+
 #ifndef CIRCUITPY_ULAB
 #define CIRCUITPY_ULAB (0)
 #endif
@@ -1198,6 +1417,19 @@ typedef double mp_float_t;
 #define MICROPY_PY_URE_SUB (0)
 #endif
 
+// Number of compiled patterns ure keeps for reuse by compile, match, search
+// and sub (0 to disable the cache)
+#ifndef MICROPY_PY_URE_CACHE_SIZE
+#define MICROPY_PY_URE_CACHE_SIZE (0)
+#endif
+
+// Whether to provide the ure.LINEAR flag, which makes a pattern match with a
+// Pike VM that takes time linear in the subject length instead of the
+// backtracking matcher
+#ifndef MICROPY_PY_URE_PIKEVM
+#define MICROPY_PY_URE_PIKEVM (0)
+#endif
+
 #ifndef MICROPY_PY_UHEAPQ
 #define MICROPY_PY_UHEAPQ (0)
 #endif
@@ -46,6 +46,7 @@ typedef struct mp_dynamic_compiler_t {
     uint8_t small_int_bits; // must be <= host small_int_bits
     bool opt_cache_map_lookup_in_bytecode;
     bool py_builtins_str_unicode;
+    uint8_t native_arch; // MP_NATIVE_ARCH_xxx that native code is emitted for
 } mp_dynamic_compiler_t;
 extern mp_dynamic_compiler_t mp_dynamic_compiler;
 #endif
@@ -66,6 +67,9 @@ typedef struct _mp_state_mem_t {
     size_t total_bytes_allocated;
     size_t current_bytes_allocated;
     size_t peak_bytes_allocated;
+    #if MICROPY_ENABLE_COMPILER
+    size_t peak_parse_tree_bytes; // largest parse tree + compiler scratch arena seen
+    #endif
     #endif
 
     byte *gc_alloc_table_start;
@@ -119,6 +123,11 @@ typedef struct _mp_state_vm_t {
 
     qstr_pool_t *last_pool;
 
+    #if MICROPY_QSTR_HASH_INDEX
+    // index over the dynamically created qstrs, see qstr.c
+    uint32_t *qstr_hash_index;
+    #endif
+
     // non-heap memory for creating an exception if we can't allocate RAM
     mp_obj_exception_t mp_emergency_exception_obj;
 
@@ -191,6 +200,31 @@ typedef struct _mp_state_vm_t {
     struct _mp_vfs_mount_t *vfs_mount_table;
     #endif
 
+    #if MICROPY_PY_UPROFILE
+    struct _mp_prof_entry_t *prof_table;
+    #endif
+
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    mp_obj_t ure_cache[MICROPY_PY_URE_CACHE_SIZE];
+    #endif
+
+    #if MICROPY_MODULE_STAT_CACHE
+    // maps paths probed by import to their mp_import_stat_t
+    mp_map_t import_stat_cache;
+    #endif
+
+    #if MICROPY_JIT
+    // bytecode that the JIT has compiled, or failed to compile
+    struct _mp_jit_entry_t *jit_table;
+    // source files that have been compiled, and their size and mtime
+    struct _mp_jit_source_t *jit_source_table;
+    #endif
+
+    #if MICROPY_OPT_STR_INPLACE_ADD
+    // latest results of str/bytes +=, which can be appended to in place
+    mp_obj_t str_builder_tip[MICROPY_OPT_STR_INPLACE_ADD_SLOTS];
+    #endif
+
     //
     // END ROOT POINTER SECTION
     ////////////////////////////////////////////////////////////
@@ -201,6 +235,11 @@ typedef struct _mp_state_vm_t {
     size_t qstr_last_alloc;
     size_t qstr_last_used;
 
+    #if MICROPY_QSTR_HASH_INDEX
+    size_t qstr_hash_index_mask;
+    size_t qstr_hash_index_count;
+    #endif
+
     #if MICROPY_PY_THREAD
     // This is a global mutex used to make qstr interning thread-safe.
     mp_thread_mutex_t qstr_mutex;
@@ -210,6 +249,40 @@ typedef struct _mp_state_vm_t {
     mp_uint_t mp_optimise_value;
     #endif
 
+    #if MICROPY_MODULE_BYTECODE_CACHE
+    bool bytecode_cache_enabled;
+    bool bytecode_cache_writable; // false once saving failed with an OSError
+    #endif
+
+    #if MICROPY_JIT
+    size_t jit_table_len;
+    size_t jit_table_alloc;
+    size_t jit_source_table_len;
+    size_t jit_source_table_alloc;
+    #endif
+
+    #if MICROPY_OPT_STR_INPLACE_ADD
+    size_t str_builder_alloc[MICROPY_OPT_STR_INPLACE_ADD_SLOTS]; // size of each tip's buffer
+    uint8_t str_builder_next; // slot to reuse next
+    #endif
+
+    #if MICROPY_OPT_STR_FORMAT_SIMPLE
+    // shapes of recently used interned format strings, see objstr.c
+    struct _mp_str_format_cache_t {
+        qstr fmt; // MP_QSTR_NULL for an empty entry
+        uint16_t n_fields;
+        uint16_t lit_len;
+        uint8_t style; // '{' for str.format, '%' for str % args
+        bool simple;
+    } str_format_cache[MICROPY_OPT_STR_FORMAT_CACHE_SIZE];
+    #endif
+
+    #if MICROPY_MODULE_STAT_CACHE
+    // set to drop the import stat cache before its next use; may be set from
+    // an interrupt, so the map itself is only touched by the VM
+    volatile bool import_stat_cache_stale;
+    #endif
+
     // size of the emergency exception buf, if it's dynamically allocated
     #if MICROPY_ENABLE_EMERGENCY_EXCEPTION_BUF && MICROPY_EMERGENCY_EXCEPTION_BUF_SIZE == 0
     mp_int_t mp_emergency_exception_buf_size;
@@ -224,6 +297,11 @@ typedef struct _mp_state_vm_t {
     // This is a global mutex used to make the VM/runtime thread-safe.
     mp_thread_mutex_t gil_mutex;
     #endif
+
+    #if MICROPY_PY_UPROFILE
+    volatile bool prof_running;
+    volatile size_t prof_missed;
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread.
@@ -246,6 +324,22 @@ typedef struct _mp_state_thread_t {
     uint8_t *pystack_cur;
     #endif
 
+    #if MICROPY_FRAME_ARENA
+    uint8_t *frame_arena_start;
+    uint8_t *frame_arena_end;
+    uint8_t *frame_arena_cur;
+    #endif
+
+    #if MICROPY_PY_UPROFILE
+    // innermost code state being executed by the VM, for the sampling profiler
+    const struct _mp_code_state_t *volatile prof_code_state;
+    #endif
+
+    #if MICROPY_JIT
+    // where the JIT-compiled function being entered records its source line
+    volatile size_t *jit_line;
+    #endif
+
     ////////////////////////////////////////////////////////////
     // START ROOT POINTER SECTION
     // Everything that needs GC scanning must start here, and
@@ -449,6 +449,124 @@ STATIC size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+#if MICROPY_OPT_MPZ_LARGE
+
+/* computes i += j
+   returns the carry out of the top digit of i
+   assumes jlen <= ilen; i and j need not be normalised
+*/
+STATIC mpz_dig_t mpn_add_inpl(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_t carry = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        carry += (mpz_dbl_dig_t)*idig + (mpz_dbl_dig_t)*jdig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; carry != 0 && ilen > 0; --ilen, ++idig) {
+        carry += *idig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    return carry;
+}
+
+/* computes i -= j
+   assumes jlen <= ilen and i >= j; i and j need not be normalised
+*/
+STATIC void mpn_sub_inpl(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        borrow += (mpz_dbl_dig_t)*idig - (mpz_dbl_dig_t)*jdig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+
+    for (; borrow != 0 && ilen > 0; --ilen, ++idig) {
+        borrow += *idig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+}
+
+/* computes i = j * k, using Karatsuba's method when both j and k have at
+   least MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD digits
+   writes all jlen + klen digits of i (so the result may have leading zeros)
+   j, k need not be normalised; can have j, k point to same memory
+*/
+STATIC void mpn_mul_karatsuba(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen) {
+    if (jlen < klen) {
+        const mpz_dig_t *t = jdig;
+        jdig = kdig;
+        kdig = t;
+        size_t tl = jlen;
+        jlen = klen;
+        klen = tl;
+    }
+
+    if (klen < MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD) {
+        memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+        mpn_mul(idig, (mpz_dig_t *)jdig, jlen, (mpz_dig_t *)kdig, klen);
+        return;
+    }
+
+    if (jlen >= 2 * klen) {
+        // unbalanced: multiply k by klen-digit slices of j and accumulate
+        memset(idig, 0, (jlen + klen) * sizeof(mpz_dig_t));
+        mpz_dig_t *t = m_new(mpz_dig_t, 2 * klen);
+        for (size_t off = 0; off < jlen; off += klen) {
+            size_t n = MIN(klen, jlen - off);
+            mpn_mul_karatsuba(t, jdig + off, n, kdig, klen);
+            mpn_add_inpl(idig + off, jlen + klen - off, t, n + klen);
+        }
+        m_del(mpz_dig_t, t, 2 * klen);
+        return;
+    }
+
+    // split j = j1 * B^m + j0 and k = k1 * B^m + k0; since jlen < 2 * klen,
+    // k1 is not empty, and j1 is at least as long as j0
+    size_t m = jlen / 2;
+    size_t sjlen = jlen - m + 1;
+    size_t sklen = MAX(m, klen - m) + 1;
+    size_t z1len = sjlen + sklen;
+    mpz_dig_t *sj = m_new(mpz_dig_t, 2 * z1len);
+    mpz_dig_t *sk = sj + sjlen;
+    mpz_dig_t *z1 = sk + sklen;
+
+    // z0 = j0 * k0 and z2 = j1 * k1 go straight into the low and high halves of i
+    mpn_mul_karatsuba(idig, jdig, m, kdig, m);
+    mpn_mul_karatsuba(idig + 2 * m, jdig + m, jlen - m, kdig + m, klen - m);
+
+    // z1 = (j0 + j1) * (k0 + k1) - z0 - z2
+    memset(sj, 0, (sjlen + sklen) * sizeof(mpz_dig_t));
+    memcpy(sj, jdig + m, (jlen - m) * sizeof(mpz_dig_t));
+    mpn_add_inpl(sj, sjlen, jdig, m);
+    if (klen - m >= m) {
+        memcpy(sk, kdig + m, (klen - m) * sizeof(mpz_dig_t));
+        mpn_add_inpl(sk, sklen, kdig, m);
+    } else {
+        memcpy(sk, kdig, m * sizeof(mpz_dig_t));
+        mpn_add_inpl(sk, sklen, kdig + m, klen - m);
+    }
+    mpn_mul_karatsuba(z1, sj, sjlen, sk, sklen);
+    mpn_sub_inpl(z1, z1len, idig, 2 * m);
+    mpn_sub_inpl(z1, z1len, idig + 2 * m, jlen + klen - 2 * m);
+
+    // i += z1 * B^m; any digits of z1 that don't fit in i are zero
+    mpn_add_inpl(idig + m, jlen + klen - m, z1, MIN(z1len, jlen + klen - m));
+
+    m_del(mpz_dig_t, sj, 2 * z1len);
+}
+
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -523,60 +641,37 @@ STATIC void mpn_div(mpz_dig_t *num_dig, size_t *num_len, const mpz_dig_t *den_di
         quo /= lead_den_digit;
 
         // Multiply quo by den and subtract from num to get remainder.
-        // We have different code here to handle different compile-time
-        // configurations of mpz:
-        //
-        //   1. DIG_SIZE is stricly less than half the number of bits
-        //      available in mpz_dbl_dig_t.  In this case we can use a
-        //      slightly more optimal (in time and space) routine that
-        //      uses the extra bits in mpz_dbl_dig_signed_t to store a
-        //      sign bit.
-        //
-        //   2. DIG_SIZE is exactly half the number of bits available in
-        //      mpz_dbl_dig_t.  In this (common) case we need to be careful
-        //      not to overflow the borrow variable.  And the shifting of
-        //      borrow needs some special logic (it's a shift right with
-        //      round up).
-        //
+        // Must be careful with overflow of the borrow variable.  Both
+        // borrow and low_digs are signed values and need signed right-shift,
+        // but x is unsigned and may take a full-range value.
         const mpz_dig_t *d = den_dig;
         mpz_dbl_dig_t d_norm = 0;
-        mpz_dbl_dig_t borrow = 0;
+        mpz_dbl_dig_signed_t borrow = 0;
         for (mpz_dig_t *n = num_dig - den_len; n < num_dig; ++n, ++d) {
+            // Get the next digit in (den).
             d_norm = ((mpz_dbl_dig_t)*d << norm_shift) | (d_norm >> DIG_SIZE);
+            // Multiply the next digit in (quo * den).
             mpz_dbl_dig_t x = (mpz_dbl_dig_t)quo * (d_norm & DIG_MASK);
-            #if DIG_SIZE < MPZ_DBL_DIG_SIZE / 2
-            borrow += (mpz_dbl_dig_t)*n - x; // will overflow if DIG_SIZE >= MPZ_DBL_DIG_SIZE/2
-            *n = borrow & DIG_MASK;
-            borrow = (mpz_dbl_dig_signed_t)borrow >> DIG_SIZE;
-            #else // DIG_SIZE == MPZ_DBL_DIG_SIZE / 2
-            if (x >= *n || *n - x <= borrow) {
-                borrow += x - (mpz_dbl_dig_t)*n;
-                *n = (-borrow) & DIG_MASK;
-                borrow = (borrow >> DIG_SIZE) + ((borrow & DIG_MASK) == 0 ? 0 : 1); // shift-right with round-up
-            } else {
-                *n = ((mpz_dbl_dig_t)*n - x - borrow) & DIG_MASK;
-                borrow = 0;
-            }
-            #endif
+            // Compute the low DIG_MASK bits of the next digit in (num - quo * den)
+            mpz_dbl_dig_signed_t low_digs = (borrow & DIG_MASK) + *n - (x & DIG_MASK);
+            // Store the digit result for (num).
+            *n = low_digs & DIG_MASK;
+            // Compute the borrow, shifted right before summing to avoid overflow.
+            borrow = (borrow >> DIG_SIZE) - (x >> DIG_SIZE) + (low_digs >> DIG_SIZE);
         }
 
-        #if DIG_SIZE < MPZ_DBL_DIG_SIZE / 2
-        // Borrow was negative in the above for-loop, make it positive for next if-block.
-        borrow = -borrow;
-        #endif
-
         // At this point we have either:
         //
         //   1. quo was the correct value and the most-sig-digit of num is exactly
-        //      cancelled by borrow (borrow == *num_dig).  In this case there is
+        //      cancelled by borrow (borrow + *num_dig == 0).  In this case there is
         //      nothing more to do.
         //
         //   2. quo was too large, we subtracted too many den from num, and the
-        //      most-sig-digit of num is 1 less than borrow (borrow == *num_dig + 1).
+        //      most-sig-digit of num is less than needed (borrow + *num_dig < 0).
         //      In this case we must reduce quo and add back den to num until the
         //      carry from this operation cancels out the borrow.
         //
-        borrow -= *num_dig;
+        borrow += *num_dig;
         for (; borrow != 0; --quo) {
             d = den_dig;
             d_norm = 0;
@@ -587,7 +682,7 @@ STATIC void mpn_div(mpz_dig_t *num_dig, size_t *num_len, const mpz_dig_t *den_di
                 *n = carry & DIG_MASK;
                 carry >>= DIG_SIZE;
             }
-            borrow -= carry;
+            borrow += carry;
         }
 
         // store this digit of the quotient
@@ -1313,8 +1408,16 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     }
 
     mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
-    memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
-    dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    #if MICROPY_OPT_MPZ_LARGE
+    if (lhs->len >= MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD && rhs->len >= MICROPY_OPT_MPZ_KARATSUBA_THRESHOLD) {
+        mpn_mul_karatsuba(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+        dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + lhs->len + rhs->len);
+    } else
+    #endif
+    {
+        memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+        dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    }
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1359,6 +1462,130 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+#if MICROPY_OPT_MPZ_LARGE
+
+/* computes r = a * b / R mod n, where R = DIG_BASE ** nlen (Montgomery multiplication)
+   a, b < n are stored in nlen digits each (with leading zeros), as is r
+   n0inv is -1 / n mod DIG_BASE; t is scratch space of nlen + 2 digits
+   can have r, a, b point to same memory
+*/
+STATIC void mpn_mont_mul(mpz_dig_t *rdig, const mpz_dig_t *adig, const mpz_dig_t *bdig, const mpz_dig_t *ndig, size_t nlen, mpz_dig_t n0inv, mpz_dig_t *t) {
+    memset(t, 0, (nlen + 2) * sizeof(mpz_dig_t));
+
+    for (size_t i = 0; i < nlen; ++i) {
+        // t += a * b[i]
+        mpz_dig_t bi = bdig[i];
+        mpz_dbl_dig_t carry = 0;
+        for (size_t j = 0; j < nlen; ++j) {
+            carry += (mpz_dbl_dig_t)t[j] + (mpz_dbl_dig_t)adig[j] * (mpz_dbl_dig_t)bi;
+            t[j] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[nlen];
+        t[nlen] = carry & DIG_MASK;
+        t[nlen + 1] = carry >> DIG_SIZE;
+
+        // t = (t + u * n) / DIG_BASE, with u chosen so the division is exact
+        mpz_dig_t u = ((mpz_dbl_dig_t)t[0] * (mpz_dbl_dig_t)n0inv) & DIG_MASK;
+        carry = ((mpz_dbl_dig_t)t[0] + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)ndig[0]) >> DIG_SIZE;
+        for (size_t j = 1; j < nlen; ++j) {
+            carry += (mpz_dbl_dig_t)t[j] + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)ndig[j];
+            t[j - 1] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[nlen];
+        t[nlen - 1] = carry & DIG_MASK;
+        t[nlen] = t[nlen + 1] + (carry >> DIG_SIZE);
+    }
+
+    // now t < 2 * n, so at most one subtraction of n is needed
+    bool ge = t[nlen] != 0;
+    if (!ge) {
+        size_t j = nlen;
+        while (j > 0 && t[j - 1] == ndig[j - 1]) {
+            --j;
+        }
+        ge = j == 0 || t[j - 1] > ndig[j - 1];
+    }
+    if (ge) {
+        mpn_sub_inpl(t, nlen + 1, ndig, nlen);
+    }
+
+    memcpy(rdig, t, nlen * sizeof(mpz_dig_t));
+}
+
+/* computes dest = (lhs ** rhs) % mod using Montgomery multiplication
+   assumes mod is positive and odd, and rhs is positive
+*/
+STATIC void mpz_pow3_montgomery(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    const size_t nlen = mod->len;
+    const mpz_dig_t *ndig = mod->dig;
+
+    // -1 / n mod DIG_BASE by Newton's iteration; n0 * n0 == 1 mod 8 for odd n0,
+    // and each step doubles the number of correct low bits
+    mpz_dbl_dig_t inv = ndig[0];
+    for (int bits = 3; bits < DIG_SIZE; bits *= 2) {
+        inv = (inv * (2 - ndig[0] * inv)) & DIG_MASK;
+    }
+    mpz_dig_t n0inv = (-inv) & DIG_MASK;
+
+    // the table holds x ** w * R mod n for w < 16, for a 4-bit window;
+    // the accumulator, multiplier and scratch space follow it
+    mpz_dig_t *tab = m_new(mpz_dig_t, 18 * nlen + nlen + 2);
+    mpz_dig_t *acc = tab + 16 * nlen;
+    mpz_dig_t *one = acc + nlen;
+    mpz_dig_t *t = one + nlen;
+    memset(tab, 0, 18 * nlen * sizeof(mpz_dig_t));
+
+    // convert 1 and x into Montgomery form, by reducing 1 * R and x * R mod n
+    mpz_t quo, rem;
+    mpz_init_zero(&quo);
+    mpz_init_from_int(&rem, 1);
+    mpz_shl_inpl(&rem, &rem, nlen * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &rem, &rem, mod);
+    memcpy(tab, rem.dig, rem.len * sizeof(mpz_dig_t));
+    mpz_shl_inpl(&rem, lhs, nlen * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &rem, &rem, mod);
+    memcpy(tab + nlen, rem.dig, rem.len * sizeof(mpz_dig_t));
+    mpz_deinit(&quo);
+    mpz_deinit(&rem);
+
+    for (size_t w = 2; w < 16; ++w) {
+        mpn_mont_mul(tab + w * nlen, tab + (w - 1) * nlen, tab + nlen, ndig, nlen, n0inv, t);
+    }
+
+    // scan the exponent from the most significant 4-bit window down
+    memcpy(acc, tab, nlen * sizeof(mpz_dig_t));
+    size_t nbits = (rhs->len - 1) * DIG_SIZE;
+    for (mpz_dig_t d = rhs->dig[rhs->len - 1]; d != 0; d >>= 1) {
+        ++nbits;
+    }
+    for (size_t pos = (nbits + 3) & ~(size_t)3; pos > 0;) {
+        size_t w = 0;
+        for (int b = 0; b < 4; ++b) {
+            --pos;
+            mpn_mont_mul(acc, acc, acc, ndig, nlen, n0inv, t);
+            w = (w << 1) | ((rhs->dig[pos / DIG_SIZE] >> (pos % DIG_SIZE)) & 1);
+        }
+        if (w != 0) {
+            mpn_mont_mul(acc, acc, tab + w * nlen, ndig, nlen, n0inv, t);
+        }
+    }
+
+    // convert back out of Montgomery form
+    one[0] = 1;
+    mpn_mont_mul(acc, acc, one, ndig, nlen, n0inv, t);
+
+    mpz_need_dig(dest, nlen);
+    memcpy(dest->dig, acc, nlen * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + nlen);
+    dest->neg = 0;
+
+    m_del(mpz_dig_t, tab, 18 * nlen + nlen + 2);
+}
+
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1368,6 +1595,13 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    #if MICROPY_OPT_MPZ_LARGE
+    if (rhs->len != 0 && mod->neg == 0 && (mod->dig[0] & 1) != 0) {
+        mpz_pow3_montgomery(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_set_from_int(dest, 1);
 
     if (rhs->len == 0) {
@@ -1647,6 +1881,90 @@ char *mpz_as_str(const mpz_t *i, unsigned int base) {
 }
 #endif
 
+/* writes the digits of the natural number in dig to str in the given base,
+   least significant first, padded with zeros to at least pad characters
+   returns a pointer past the last character written
+   dig is used as scratch space and is zero on return
+*/
+STATIC char *mpn_as_str(char *str, mpz_dig_t *dig, size_t len, unsigned int base, char base_char, size_t pad) {
+    char *s = str;
+
+    // divide by the largest power of the base that fits in a digit, so each
+    // pass over the digits produces several characters
+    mpz_dig_t big_base = base;
+    unsigned int chunk = 1;
+    while ((mpz_dbl_dig_t)big_base * base <= DIG_MASK) {
+        big_base *= base;
+        ++chunk;
+    }
+
+    while (len > 0) {
+        mpz_dig_t *d = dig + len;
+        mpz_dbl_dig_t a = 0;
+
+        // compute next remainder
+        while (--d >= dig) {
+            a = (a << DIG_SIZE) | *d;
+            *d = a / big_base;
+            a %= big_base;
+        }
+        len = mpn_remove_trailing_zeros(dig, dig + len);
+
+        // convert to characters, without leading zeros for the most significant chunk
+        for (unsigned int k = 0; k < chunk && (len > 0 || a != 0); ++k) {
+            mpz_dig_t c = a % base + '0';
+            a /= base;
+            if (c > '9') {
+                c += base_char - '9' - 1;
+            }
+            *s++ = c;
+        }
+    }
+
+    while ((size_t)(s - str) < pad) {
+        *s++ = '0';
+    }
+
+    return s;
+}
+
+#if MICROPY_OPT_MPZ_LARGE
+
+// numbers with more digits than this are converted to strings by divide and conquer
+#define MPZ_STR_DC_THRESHOLD (24)
+
+/* writes the digits of z (which is non-negative) as for mpn_as_str, splitting
+   it into halves by dividing by pows[level - 1], where pows[i] is
+   base ** (width << i) and z < pows[level - 1] ** 2
+*/
+STATIC char *mpz_as_str_dc(char *str, const mpz_t *z, const mpz_t *pows, size_t level, size_t width, unsigned int base, char base_char, size_t pad) {
+    while (level > 0 && mpz_cmp(z, &pows[level - 1]) < 0) {
+        --level;
+    }
+
+    if (level == 0 || z->len <= MPZ_STR_DC_THRESHOLD) {
+        mpz_dig_t *dig = m_new(mpz_dig_t, z->len);
+        memcpy(dig, z->dig, z->len * sizeof(mpz_dig_t));
+        str = mpn_as_str(str, dig, z->len, base, base_char, pad);
+        m_del(mpz_dig_t, dig, z->len);
+        return str;
+    }
+
+    // the low half is padded to its full width, the high half only as needed
+    size_t lo_width = width << (level - 1);
+    mpz_t quo, rem;
+    mpz_init_zero(&quo);
+    mpz_init_zero(&rem);
+    mpz_divmod_inpl(&quo, &rem, z, &pows[level - 1]);
+    str = mpz_as_str_dc(str, &rem, pows, level - 1, width, base, base_char, lo_width);
+    mpz_deinit(&rem);
+    str = mpz_as_str_dc(str, &quo, pows, level - 1, width, base, base_char, pad > lo_width ? pad - lo_width : 0);
+    mpz_deinit(&quo);
+    return str;
+}
+
+#endif
+
 // assumes enough space in str as calculated by mp_int_format_size
 // base must be between 2 and 32 inclusive
 // returns length of string, not including null byte
@@ -1667,48 +1985,54 @@ size_t mpz_as_str_inpl(const mpz_t *i, unsigned int base, const char *prefix, ch
         return s - str;
     }
 
-    // make a copy of mpz digits, so we can do the div/mod calculation
-    mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
-    memcpy(dig, i->dig, ilen * sizeof(mpz_dig_t));
-
     // convert
-    char *last_comma = str;
-    bool done;
-    do {
-        mpz_dig_t *d = dig + ilen;
-        mpz_dbl_dig_t a = 0;
-
-        // compute next remainder
-        while (--d >= dig) {
-            a = (a << DIG_SIZE) | *d;
-            *d = a / base;
-            a %= base;
+    #if MICROPY_OPT_MPZ_LARGE
+    if (ilen > MPZ_STR_DC_THRESHOLD) {
+        // build base ** (width << k) by repeated squaring, until its square exceeds i
+        mpz_t pows[8 * sizeof(size_t)];
+        size_t width = 1;
+        mpz_dig_t big_base = base;
+        while ((mpz_dbl_dig_t)big_base * base <= DIG_MASK) {
+            big_base *= base;
+            ++width;
         }
+        size_t npows = 1;
+        mpz_init_from_int(&pows[0], big_base);
+        while (2 * (pows[npows - 1].len - 1) < ilen) {
+            mpz_init_zero(&pows[npows]);
+            mpz_mul_inpl(&pows[npows], &pows[npows - 1], &pows[npows - 1]);
+            ++npows;
+        }
+
+        mpz_t abs = *i;
+        abs.neg = 0;
+        s = mpz_as_str_dc(s, &abs, pows, npows, width, base, base_char, 0);
 
-        // convert to character
-        a += '0';
-        if (a > '9') {
-            a += base_char - '9' - 1;
+        for (size_t k = 0; k < npows; ++k) {
+            mpz_deinit(&pows[k]);
         }
-        *s++ = a;
-
-        // check if number is zero
-        done = true;
-        for (d = dig; d < dig + ilen; ++d) {
-            if (*d != 0) {
-                done = false;
-                break;
+    } else
+    #endif
+    {
+        // make a copy of mpz digits, so we can do the div/mod calculation
+        mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
+        memcpy(dig, i->dig, ilen * sizeof(mpz_dig_t));
+        s = mpn_as_str(s, dig, ilen, base, base_char, 0);
+        m_del(mpz_dig_t, dig, ilen);
+    }
+
+    // insert a comma after every third digit, working backwards so the
+    // digits can be moved up in place
+    if (comma) {
+        size_t n = s - str;
+        s = str + n + n / 3;
+        for (size_t k = n; k-- > 0;) {
+            if (k % 3 == 2) {
+                str[k + k / 3 + 1] = comma;
             }
-        }
-        if (comma && (s - last_comma) == 3) {
-            *s++ = comma;
-            last_comma = s;
+            str[k + k / 3] = str[k];
         }
     }
-    while (!done);
-
-    // free the copy of the digits array
-    m_del(mpz_dig_t, dig, ilen);
 
     if (prefix) {
         const char *p = &prefix[strlen(prefix)];
@@ -32,6 +32,7 @@
 #include "py/smallint.h"
 #include "py/emitglue.h"
 #include "py/bc.h"
+#include "py/jit.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_printf DEBUG_printf
@@ -39,6 +40,27 @@
 #define DEBUG_printf(...) (void)0
 #endif
 
+#if MICROPY_EMIT_NATIVE_FLOAT
+
+// viper holds a float as its bit pattern in a machine word
+typedef union _native_float_t {
+    mp_float_t f;
+    mp_uint_t u;
+} native_float_t;
+
+static inline mp_uint_t float_to_native(mp_float_t f) {
+    native_float_t v = { .u = 0 };
+    v.f = f;
+    return v.u;
+}
+
+static inline mp_float_t float_from_native(mp_uint_t u) {
+    native_float_t v = { .u = u };
+    return v.f;
+}
+
+#endif
+
 #if MICROPY_EMIT_NATIVE
 
 // convert a MicroPython object to a valid native value based on type
@@ -49,6 +71,9 @@ mp_uint_t mp_convert_obj_to_native(mp_obj_t obj, mp_uint_t type) {
         case MP_NATIVE_TYPE_BOOL:
         case MP_NATIVE_TYPE_INT:
         case MP_NATIVE_TYPE_UINT: return mp_obj_get_int_truncated(obj);
+        #if MICROPY_EMIT_NATIVE_FLOAT
+        case MP_NATIVE_TYPE_FLOAT: return float_to_native(mp_obj_get_float(obj));
+        #endif
         default: { // cast obj to a pointer
             mp_buffer_info_t bufinfo;
             if (mp_get_buffer(obj, &bufinfo, MP_BUFFER_RW)) {
@@ -73,6 +98,9 @@ mp_obj_t mp_convert_native_to_obj(mp_uint_t val, mp_uint_t type) {
         case MP_NATIVE_TYPE_BOOL: return mp_obj_new_bool(val);
         case MP_NATIVE_TYPE_INT: return mp_obj_new_int(val);
         case MP_NATIVE_TYPE_UINT: return mp_obj_new_int_from_uint(val);
+        #if MICROPY_EMIT_NATIVE_FLOAT
+        case MP_NATIVE_TYPE_FLOAT: return mp_obj_new_float(float_from_native(val));
+        #endif
         default: // a pointer
             // we return just the value of the pointer as an integer
             return mp_obj_new_int_from_uint(val);
@@ -123,7 +151,87 @@ STATIC mp_obj_t mp_native_iternext(mp_obj_iter_buf_t *iter) {
     return mp_iternext(obj);
 }
 
-// these must correspond to the respective enum in runtime0.h
+// called by native code on each backward jump, like the VM's pending exception check
+STATIC void mp_native_loop_hook(void) {
+    MICROPY_VM_HOOK_LOOP
+    mp_handle_pending();
+    #if MICROPY_PY_THREAD_GIL
+    #if MICROPY_ENABLE_SCHEDULER
+    // can only switch threads if the scheduler is unlocked
+    if (MP_STATE_VM(sched_state) == MP_SCHED_IDLE)
+    #endif
+    {
+        MP_THREAD_GIL_EXIT();
+        MP_THREAD_GIL_ENTER();
+    }
+    #endif
+}
+
+#if MICROPY_EMIT_NATIVE_FLOAT
+
+// binary op on viper floats: op holds the mp_binary_op_t in its low byte, and
+// bits 8 and 9 are set if lhs and rhs respectively are native ints instead
+STATIC mp_uint_t mp_native_float_binary_op(mp_uint_t op, mp_uint_t lhs_in, mp_uint_t rhs_in) {
+    mp_float_t lhs = (op & 0x100) ? (mp_float_t)(mp_int_t)lhs_in : float_from_native(lhs_in);
+    mp_float_t rhs = (op & 0x200) ? (mp_float_t)(mp_int_t)rhs_in : float_from_native(rhs_in);
+    op &= 0xff;
+    switch (op) {
+        case MP_BINARY_OP_ADD: return float_to_native(lhs + rhs);
+        case MP_BINARY_OP_SUBTRACT: return float_to_native(lhs - rhs);
+        case MP_BINARY_OP_MULTIPLY: return float_to_native(lhs * rhs);
+        case MP_BINARY_OP_TRUE_DIVIDE:
+            if (rhs == 0) {
+                mp_raise_msg(&mp_type_ZeroDivisionError, translate("division by zero"));
+            }
+            return float_to_native(lhs / rhs);
+        case MP_BINARY_OP_LESS: return lhs < rhs;
+        case MP_BINARY_OP_MORE: return lhs > rhs;
+        case MP_BINARY_OP_EQUAL: return lhs == rhs;
+        case MP_BINARY_OP_LESS_EQUAL: return lhs <= rhs;
+        case MP_BINARY_OP_MORE_EQUAL: return lhs >= rhs;
+        case MP_BINARY_OP_NOT_EQUAL: return lhs != rhs;
+        default: {
+            // the less common ops need the full semantics of the float type
+            mp_obj_t res = mp_obj_float_binary_op(op, lhs, mp_obj_new_float(rhs));
+            return float_to_native(mp_obj_get_float(res));
+        }
+    }
+}
+
+// convert between viper floats and ints: types holds the MP_NATIVE_TYPE_xxx
+// of the value in its low 4 bits and the wanted type in the next 4 bits
+STATIC mp_uint_t mp_native_float_convert(mp_uint_t val, mp_uint_t types) {
+    mp_uint_t from = types & 0xf;
+    mp_uint_t to = (types >> 4) & 0xf;
+    if (to == MP_NATIVE_TYPE_FLOAT) {
+        if (from == MP_NATIVE_TYPE_INT) {
+            return float_to_native((mp_float_t)(mp_int_t)val);
+        }
+        return float_to_native((mp_float_t)val);
+    }
+    mp_float_t f = float_from_native(val);
+    if (to == MP_NATIVE_TYPE_BOOL) {
+        return f != 0;
+    }
+    if ((mp_float_t)MP_SMALL_INT_MIN <= f && f <= (mp_float_t)MP_SMALL_INT_MAX) {
+        return (mp_int_t)f;
+    }
+    // out of the easy range, or inf/nan: let int() truncate or raise
+    return mp_obj_get_int_truncated(mp_obj_new_int_from_float(f));
+}
+
+#endif
+
+#if !MICROPY_PY_BUILTINS_SET || !MICROPY_PY_BUILTINS_SLICE || !MICROPY_EMIT_NATIVE_FLOAT || !MICROPY_JIT
+// stands in for the functions of disabled features, which native code loaded
+// from a .mpy file made with them enabled may still call
+STATIC NORETURN void mp_native_unsupported(void) {
+    mp_raise_NotImplementedError(NULL);
+}
+#endif
+
+// these must correspond to the respective enum in runtime0.h, and native code
+// in .mpy files refers to them by index, so no entry depends on the config
 void *const mp_fun_table[MP_F_NUMBER_OF] = {
     mp_convert_obj_to_native,
     mp_convert_native_to_obj,
@@ -148,6 +256,9 @@ void *const mp_fun_table[MP_F_NUMBER_OF] = {
 #if MICROPY_PY_BUILTINS_SET
     mp_obj_set_store,
     mp_obj_new_set,
+#else
+    mp_native_unsupported,
+    mp_native_unsupported,
 #endif
     mp_make_function_from_raw_code,
     mp_native_call_function_n_kw,
@@ -163,6 +274,8 @@ void *const mp_fun_table[MP_F_NUMBER_OF] = {
     mp_import_all,
 #if MICROPY_PY_BUILTINS_SLICE
     mp_obj_new_slice,
+#else
+    mp_native_unsupported,
 #endif
     mp_unpack_sequence,
     mp_unpack_ex,
@@ -173,6 +286,19 @@ void *const mp_fun_table[MP_F_NUMBER_OF] = {
     mp_setup_code_state,
     mp_small_int_floor_divide,
     mp_small_int_modulo,
+#if MICROPY_EMIT_NATIVE_FLOAT
+    mp_native_float_binary_op,
+    mp_native_float_convert,
+#else
+    mp_native_unsupported,
+    mp_native_unsupported,
+#endif
+    mp_native_loop_hook,
+#if MICROPY_JIT
+    mp_jit_setup_code_state,
+#else
+    mp_native_unsupported,
+#endif
 };
 
 /*
@@ -95,13 +95,19 @@ struct _nlr_buf_t {
 
     #if MICROPY_ENABLE_PYSTACK
     void *pystack;
+    #elif MICROPY_FRAME_ARENA
+    void *frame_arena;
     #endif
 };
 
-// Helper macros to save/restore the pystack state
+// Helper macros to save/restore the pystack state (or the frame arena, so that
+// frames abandoned by a jump are reclaimed)
 #if MICROPY_ENABLE_PYSTACK
 #define MP_NLR_SAVE_PYSTACK(nlr_buf) (nlr_buf)->pystack = MP_STATE_THREAD(pystack_cur)
 #define MP_NLR_RESTORE_PYSTACK(nlr_buf) MP_STATE_THREAD(pystack_cur) = (nlr_buf)->pystack
+#elif MICROPY_FRAME_ARENA
+#define MP_NLR_SAVE_PYSTACK(nlr_buf) (nlr_buf)->frame_arena = MP_STATE_THREAD(frame_arena_cur)
+#define MP_NLR_RESTORE_PYSTACK(nlr_buf) MP_STATE_THREAD(frame_arena_cur) = (nlr_buf)->frame_arena
 #else
 #define MP_NLR_SAVE_PYSTACK(nlr_buf) (void)nlr_buf
 #define MP_NLR_RESTORE_PYSTACK(nlr_buf) (void)nlr_buf
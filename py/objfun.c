@@ -33,6 +33,7 @@
 #include "py/runtime.h"
 #include "py/bc.h"
 #include "py/stackctrl.h"
+#include "py/jit.h"
 
 #include "supervisor/linker.h"
 
@@ -169,7 +170,7 @@ qstr mp_obj_fun_get_name(mp_const_obj_t fun_in) {
     bc++; // skip n_pos_args
     bc++; // skip n_kwonly_args
     bc++; // skip n_def_pos_args
-    return mp_obj_code_get_name(bc);
+    return MP_OBJ_FUN_BC_QSTR(fun, mp_obj_code_get_name(bc));
 }
 
 #if MICROPY_CPYTHON_COMPAT
@@ -262,6 +263,15 @@ STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
     mp_obj_fun_bc_t *self = MP_OBJ_TO_PTR(self_in);
     DEBUG_printf("Func n_def_args: %d\n", self->n_def_args);
 
+    #if MICROPY_JIT
+    if (self->jit_count == MICROPY_JIT_THRESHOLD) {
+        mp_jit_compile(self);
+    }
+    if (self->jit_fun != NULL) {
+        return mp_jit_call(self, n_args, n_kw, args);
+    }
+    #endif
+
     size_t n_state, state_size;
     DECODE_CODESTATE_SIZE(self->bytecode, n_state, state_size);
 
@@ -270,8 +280,19 @@ STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
     #if MICROPY_ENABLE_PYSTACK
     code_state = mp_pystack_alloc(sizeof(mp_code_state_t) + state_size);
     #else
+    #if MICROPY_FRAME_ARENA
+    bool in_arena = false;
+    #endif
     if (state_size > VM_MAX_STATE_ON_STACK) {
-        code_state = m_new_obj_var_maybe(mp_code_state_t, byte, state_size);
+        #if MICROPY_FRAME_ARENA
+        // take large states from the frame arena rather than the heap if there's room
+        code_state = mp_frame_arena_alloc(sizeof(mp_code_state_t) + state_size);
+        in_arena = code_state != NULL;
+        if (!in_arena)
+        #endif
+        {
+            code_state = m_new_obj_var_maybe(mp_code_state_t, byte, state_size);
+        }
     }
     if (code_state == NULL) {
         code_state = alloca(sizeof(mp_code_state_t) + state_size);
@@ -326,6 +347,11 @@ STATIC mp_obj_t PLACE_IN_ITCM(fun_bc_call)(mp_obj_t self_in, size_t n_args, size
     #if MICROPY_ENABLE_PYSTACK
     mp_pystack_free(code_state);
     #else
+    #if MICROPY_FRAME_ARENA
+    if (in_arena) {
+        mp_frame_arena_free(code_state);
+    } else
+    #endif
     // free the state if it was allocated on the heap
     if (state_size != 0) {
         m_del_var(mp_code_state_t, byte, state_size, code_state);
@@ -381,6 +407,13 @@ mp_obj_t mp_obj_new_fun_bc(mp_obj_t def_args_in, mp_obj_t def_kw_args, const byt
     o->globals = mp_globals_get();
     o->bytecode = code;
     o->const_table = const_table;
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    o->qstr_map = NULL;
+    #endif
+    #if MICROPY_JIT
+    o->jit_fun = NULL;
+    o->jit_count = 0;
+    #endif
     if (def_args != NULL) {
         memcpy(o->extra_args, def_args->items, n_def_args * sizeof(mp_obj_t));
     }
@@ -516,8 +549,7 @@ STATIC mp_uint_t convert_obj_for_inline_asm(mp_obj_t obj) {
         return mp_obj_int_get_truncated(obj);
     } else if (MP_OBJ_IS_STR(obj)) {
         // pointer to the string (it's probably constant though!)
-        size_t l;
-        return (mp_uint_t)mp_obj_str_get_data(obj, &l);
+        return (mp_uint_t)mp_obj_str_get_str(obj);
     } else {
         mp_obj_type_t *type = mp_obj_get_type(obj);
         if (0) {
@@ -33,6 +33,13 @@ typedef struct _mp_obj_fun_bc_t {
     mp_obj_dict_t *globals;         // the context within which this function was defined
     const byte *bytecode;           // bytecode for the function
     const mp_uint_t *const_table;   // constant table
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    const uint16_t *qstr_map;       // see MP_OBJ_FUN_BC_QSTR, NULL if not needed
+    #endif
+    #if MICROPY_JIT
+    struct _mp_obj_fun_bc_t *jit_fun; // native version of this function, once compiled
+    uint16_t jit_count;             // backward jumps taken, or MP_JIT_COUNT_FAILED
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
@@ -41,4 +48,12 @@ typedef struct _mp_obj_fun_bc_t {
     mp_obj_t extra_args[];
 } mp_obj_fun_bc_t;
 
+// Bytecode executed in place from a .mpy file still holds the qstr ids that
+// were current when it was compiled, and they are translated via qstr_map.
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+#define MP_OBJ_FUN_BC_QSTR(fun, qst) ((fun)->qstr_map == NULL ? (qstr)(qst) : (qstr)(fun)->qstr_map[qst])
+#else
+#define MP_OBJ_FUN_BC_QSTR(fun, qst) ((qstr)(qst))
+#endif
+
 #endif // MICROPY_INCLUDED_PY_OBJFUN_H
@@ -289,35 +289,316 @@ STATIC mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return ret;
 }
 
-STATIC void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
-    MP_STACK_CHECK();
-    while (head < tail) {
-        mp_obj_t *h = head - 1;
-        mp_obj_t *t = tail;
-        mp_obj_t v = key_fn == MP_OBJ_NULL ? tail[0] : mp_call_function_1(key_fn, tail[0]); // get pivot using key_fn
-        for (;;) {
-            do ++h; while (h < t && mp_binary_op(MP_BINARY_OP_LESS, key_fn == MP_OBJ_NULL ? h[0] : mp_call_function_1(key_fn, h[0]), v) == binop_less_result);
-            do --t; while (h < t && mp_binary_op(MP_BINARY_OP_LESS, v, key_fn == MP_OBJ_NULL ? t[0] : mp_call_function_1(key_fn, t[0])) == binop_less_result);
-            if (h >= t) break;
-            mp_obj_t x = h[0];
-            h[0] = t[0];
-            t[0] = x;
+// Stable, adaptive merge sort in the style of CPython's timsort.  Runs that
+// are already ascending (or strictly descending, which are reversed in place)
+// are extended to a minimum length with binary insertion sort and then merged
+// so that the pending run lengths stay balanced.  The key function, if any, is
+// called once per element up front, and the items are moved along with their
+// keys.  Merging needs a temporary buffer of at most half the list.
+
+// enough pending runs for any list that fits in memory, given the balance
+// invariants kept by sort_merge_collapse
+#define SORT_MAX_RUNS (sizeof(size_t) * 8 * 4 / 3)
+
+typedef struct _sort_state_t {
+    mp_obj_t *keys;         // objects that are compared
+    mp_obj_t *vals;         // items moved along with keys, or NULL if keys are the items
+    mp_obj_t *tmp_keys;     // merge buffer, tmp_alloc entries each for keys and vals
+    mp_obj_t *tmp_vals;
+    size_t tmp_alloc;
+    bool reverse;
+    // while a merge is in progress the entries tmp[gap_tmp, gap_tmp + gap_len)
+    // belong at keys[gap_dst, gap_dst + gap_len), so they can be put back if a
+    // comparison raises
+    bool merging;
+    size_t gap_dst;
+    size_t gap_tmp;
+    size_t gap_len;
+    size_t n_runs;
+    struct {
+        size_t base;
+        size_t len;
+    } runs[SORT_MAX_RUNS];
+} sort_state_t;
+
+STATIC bool sort_lt(sort_state_t *s, mp_obj_t a, mp_obj_t b) {
+    if (s->reverse) {
+        // swapping the operands keeps equal elements in their original order
+        mp_obj_t t = a;
+        a = b;
+        b = t;
+    }
+    return mp_binary_op(MP_BINARY_OP_LESS, a, b) == mp_const_true;
+}
+
+static inline void sort_move(mp_obj_t *dk, mp_obj_t *dv, const mp_obj_t *sk, const mp_obj_t *sv, size_t n) {
+    memmove(dk, sk, n * sizeof(mp_obj_t));
+    if (dv != NULL) {
+        memmove(dv, sv, n * sizeof(mp_obj_t));
+    }
+}
+
+static inline void sort_put(sort_state_t *s, size_t dst, mp_obj_t k, mp_obj_t v) {
+    s->keys[dst] = k;
+    if (s->vals != NULL) {
+        s->vals[dst] = v;
+    }
+}
+
+// Sort keys[lo, hi) by binary insertion, given that keys[lo, start) is sorted.
+STATIC void sort_binary_insertion(sort_state_t *s, size_t lo, size_t hi, size_t start) {
+    mp_obj_t *keys = s->keys;
+    mp_obj_t *vals = s->vals;
+    for (size_t i = start; i < hi; i++) {
+        mp_obj_t pivot = keys[i];
+        size_t l = lo;
+        size_t r = i;
+        // find the rightmost place to insert pivot, so the sort is stable
+        while (l < r) {
+            size_t m = l + (r - l) / 2;
+            if (sort_lt(s, pivot, keys[m])) {
+                r = m;
+            } else {
+                l = m + 1;
+            }
+        }
+        mp_obj_t v = vals == NULL ? MP_OBJ_NULL : vals[i];
+        sort_move(keys + l + 1, vals == NULL ? NULL : vals + l + 1, keys + l, vals == NULL ? NULL : vals + l, i - l);
+        sort_put(s, l, pivot, v);
+    }
+}
+
+STATIC void sort_reverse(mp_obj_t *lo, mp_obj_t *hi) {
+    while (lo < hi) {
+        mp_obj_t t = *lo;
+        *lo++ = *hi;
+        *hi-- = t;
+    }
+}
+
+// Return the length of the run starting at lo, reversing it if it is descending.
+STATIC size_t sort_count_run(sort_state_t *s, size_t lo, size_t hi) {
+    mp_obj_t *keys = s->keys;
+    size_t i = lo + 1;
+    if (i == hi) {
+        return 1;
+    }
+    if (sort_lt(s, keys[i], keys[lo])) {
+        // strictly descending, so reversing it can't reorder equal elements
+        for (i++; i < hi && sort_lt(s, keys[i], keys[i - 1]); i++) {
+        }
+        sort_reverse(keys + lo, keys + i - 1);
+        if (s->vals != NULL) {
+            sort_reverse(s->vals + lo, s->vals + i - 1);
+        }
+    } else {
+        for (i++; i < hi && !sort_lt(s, keys[i], keys[i - 1]); i++) {
+        }
+    }
+    return i - lo;
+}
+
+// Number of leading elements of a[0, n) that are less than key (left == true)
+// or not greater than key (left == false).
+STATIC size_t sort_bisect(sort_state_t *s, mp_obj_t key, const mp_obj_t *a, size_t n, bool left) {
+    size_t l = 0;
+    size_t r = n;
+    while (l < r) {
+        size_t m = l + (r - l) / 2;
+        if (left ? sort_lt(s, a[m], key) : !sort_lt(s, key, a[m])) {
+            l = m + 1;
+        } else {
+            r = m;
+        }
+    }
+    return l;
+}
+
+STATIC void sort_ensure_tmp(sort_state_t *s, size_t n) {
+    if (n > s->tmp_alloc) {
+        size_t mult = s->vals == NULL ? 1 : 2;
+        m_del(mp_obj_t, s->tmp_keys, s->tmp_alloc * mult);
+        s->tmp_keys = m_new(mp_obj_t, n * mult);
+        s->tmp_vals = s->vals == NULL ? NULL : s->tmp_keys + n;
+        s->tmp_alloc = n;
+    }
+}
+
+// Merge the sorted runs keys[a, a + na) and keys[a + na, a + na + nb), na <= nb.
+STATIC void sort_merge_lo(sort_state_t *s, size_t a, size_t na, size_t nb) {
+    mp_obj_t *keys = s->keys;
+    mp_obj_t *vals = s->vals;
+    sort_ensure_tmp(s, na);
+    sort_move(s->tmp_keys, s->tmp_vals, keys + a, vals == NULL ? NULL : vals + a, na);
+    size_t j = a + na;
+    size_t end = j + nb;
+    s->gap_dst = a;
+    s->gap_tmp = 0;
+    s->gap_len = na;
+    s->merging = true;
+    while (s->gap_len > 0 && j < end) {
+        if (sort_lt(s, keys[j], s->tmp_keys[s->gap_tmp])) {
+            sort_put(s, s->gap_dst++, keys[j], vals == NULL ? MP_OBJ_NULL : vals[j]);
+            j++;
+        } else {
+            size_t t = s->gap_tmp++;
+            sort_put(s, s->gap_dst++, s->tmp_keys[t], vals == NULL ? MP_OBJ_NULL : s->tmp_vals[t]);
+            s->gap_len--;
         }
-        mp_obj_t x = h[0];
-        h[0] = tail[0];
-        tail[0] = x;
-        // do the smaller recursive call first, to keep stack within O(log(N))
-        if (t - head < tail - h - 1) {
-            mp_quicksort(head, t, key_fn, binop_less_result);
-            head = h + 1;
+    }
+    s->merging = false;
+    // the rest of the right run is already in place
+    sort_move(keys + s->gap_dst, vals == NULL ? NULL : vals + s->gap_dst,
+        s->tmp_keys + s->gap_tmp, vals == NULL ? NULL : s->tmp_vals + s->gap_tmp, s->gap_len);
+}
+
+// Merge the sorted runs keys[a, a + na) and keys[a + na, a + na + nb), nb < na.
+STATIC void sort_merge_hi(sort_state_t *s, size_t a, size_t na, size_t nb) {
+    mp_obj_t *keys = s->keys;
+    mp_obj_t *vals = s->vals;
+    sort_ensure_tmp(s, nb);
+    sort_move(s->tmp_keys, s->tmp_vals, keys + a + na, vals == NULL ? NULL : vals + a + na, nb);
+    // merge from the right; i is one past the last unmerged element of the left run
+    size_t i = a + na;
+    s->gap_tmp = 0;
+    s->gap_len = nb;
+    s->gap_dst = i;
+    s->merging = true;
+    while (s->gap_len > 0 && i > a) {
+        size_t dst = i + s->gap_len - 1;
+        size_t t = s->gap_len - 1;
+        if (sort_lt(s, s->tmp_keys[t], keys[i - 1])) {
+            i--;
+            sort_put(s, dst, keys[i], vals == NULL ? MP_OBJ_NULL : vals[i]);
+            s->gap_dst = i;
         } else {
-            mp_quicksort(h + 1, tail, key_fn, binop_less_result);
-            tail = t;
+            sort_put(s, dst, s->tmp_keys[t], vals == NULL ? MP_OBJ_NULL : s->tmp_vals[t]);
+            s->gap_len--;
+        }
+    }
+    s->merging = false;
+    // the rest of the left run is already in place
+    sort_move(keys + s->gap_dst, vals == NULL ? NULL : vals + s->gap_dst,
+        s->tmp_keys, s->tmp_vals, s->gap_len);
+}
+
+// Merge pending runs i and i + 1.
+STATIC void sort_merge_at(sort_state_t *s, size_t i) {
+    size_t a = s->runs[i].base;
+    size_t na = s->runs[i].len;
+    size_t nb = s->runs[i + 1].len;
+    s->runs[i].len = na + nb;
+    if (i == s->n_runs - 3) {
+        s->runs[i + 1] = s->runs[i + 2];
+    }
+    s->n_runs--;
+
+    // elements at the start of the left run that are not greater than the
+    // first of the right run, and those at the end of the right run that are
+    // not less than the last of the left run, are already in place
+    size_t k = sort_bisect(s, s->keys[a + na], s->keys + a, na, false);
+    a += k;
+    na -= k;
+    if (na == 0) {
+        return;
+    }
+    nb = sort_bisect(s, s->keys[a + na - 1], s->keys + a + na, nb, true);
+    if (nb == 0) {
+        return;
+    }
+    if (na <= nb) {
+        sort_merge_lo(s, a, na, nb);
+    } else {
+        sort_merge_hi(s, a, na, nb);
+    }
+}
+
+// Merge pending runs until their lengths, from the top of the stack down,
+// grow at least as fast as the Fibonacci numbers.
+STATIC void sort_merge_collapse(sort_state_t *s) {
+    while (s->n_runs > 1) {
+        size_t n = s->n_runs - 2;
+        if ((n > 0 && s->runs[n - 1].len <= s->runs[n].len + s->runs[n + 1].len)
+            || (n > 1 && s->runs[n - 2].len <= s->runs[n - 1].len + s->runs[n].len)) {
+            if (s->runs[n - 1].len < s->runs[n + 1].len) {
+                n--;
+            }
+        } else if (s->runs[n].len > s->runs[n + 1].len) {
+            break;
+        }
+        sort_merge_at(s, n);
+    }
+}
+
+STATIC void sort_merge_force_collapse(sort_state_t *s) {
+    while (s->n_runs > 1) {
+        size_t n = s->n_runs - 2;
+        if (n > 0 && s->runs[n - 1].len < s->runs[n + 1].len) {
+            n--;
+        }
+        sort_merge_at(s, n);
+    }
+}
+
+STATIC size_t sort_min_run(size_t n) {
+    // use the top 6 bits of n, rounded up, so n / minrun is a power of 2 or just below
+    size_t r = 0;
+    while (n >= 64) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+STATIC void sort_run(sort_state_t *s, size_t n) {
+    size_t min_run = sort_min_run(n);
+    for (size_t lo = 0; lo < n;) {
+        size_t run = sort_count_run(s, lo, n);
+        if (run < min_run) {
+            size_t forced = MIN(min_run, n - lo);
+            sort_binary_insertion(s, lo, lo + forced, lo + run);
+            run = forced;
+        }
+        s->runs[s->n_runs].base = lo;
+        s->runs[s->n_runs].len = run;
+        s->n_runs++;
+        sort_merge_collapse(s);
+        lo += run;
+    }
+    sort_merge_force_collapse(s);
+}
+
+// Sort the n objects in keys, moving the n objects in vals (if not NULL) along with them.
+STATIC void mp_sort(mp_obj_t *keys, mp_obj_t *vals, size_t n, bool reverse) {
+    sort_state_t s;
+    s.keys = keys;
+    s.vals = vals;
+    s.tmp_keys = NULL;
+    s.tmp_vals = NULL;
+    s.tmp_alloc = 0;
+    s.reverse = reverse;
+    s.merging = false;
+    s.n_runs = 0;
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        sort_run(&s, n);
+        nlr_pop();
+    } else {
+        // a comparison raised; put back the entries held in the merge buffer
+        // so no items are lost or duplicated (the state is read through a
+        // volatile pointer so that it is reloaded after the non-local return)
+        volatile sort_state_t *vs = &s;
+        if (vs->merging) {
+            sort_move(keys + vs->gap_dst, vals == NULL ? NULL : vals + vs->gap_dst,
+                vs->tmp_keys + vs->gap_tmp, vs->tmp_vals == NULL ? NULL : vs->tmp_vals + vs->gap_tmp, vs->gap_len);
         }
+        nlr_jump(nlr.ret_val);
     }
+
+    m_del(mp_obj_t, s.tmp_keys, s.tmp_alloc * (vals == NULL ? 1 : 2));
 }
 
-// TODO Python defines sort to be stable but ours is not
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_PTR(&mp_const_none_obj)} },
@@ -335,9 +616,23 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_obj_list_t *self = mp_instance_cast_to_native_base(pos_args[0], &mp_type_list);
 
     if (self->len > 1) {
-        mp_quicksort(self->items, self->items + self->len - 1,
-                     args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
-                     args.reverse.u_bool ? mp_const_false : mp_const_true);
+        if (args.key.u_obj == mp_const_none) {
+            mp_sort(self->items, NULL, self->len, args.reverse.u_bool);
+        } else {
+            // decorate: call the key function once per item
+            size_t n = self->len;
+            mp_obj_t *keys = m_new(mp_obj_t, n);
+            for (size_t i = 0; i < n && self->len == n; i++) {
+                keys[i] = mp_call_function_1(args.key.u_obj, self->items[i]);
+            }
+            if (self->len != n) {
+                // the key function added or removed items
+                m_del(mp_obj_t, keys, n);
+                mp_raise_ValueError(translate("list modified during sort"));
+            }
+            mp_sort(keys, self->items, n, args.reverse.u_bool);
+            m_del(mp_obj_t, keys, n);
+        }
     }
 
     return mp_const_none;
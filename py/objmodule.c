@@ -188,6 +188,9 @@ STATIC const mp_rom_map_elem_t mp_builtin_module_table[] = {
 #if MICROPY_PY_THREAD
     { MP_ROM_QSTR(MP_QSTR__thread), MP_ROM_PTR(&mp_module_thread) },
 #endif
+#if MICROPY_PY_UPROFILE
+    { MP_ROM_QSTR(MP_QSTR_uprofile), MP_ROM_PTR(&mp_module_uprofile) },
+#endif
 
     // extmod modules
 
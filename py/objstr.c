@@ -95,12 +95,19 @@ void mp_str_print_json(const mp_print_t *print, const byte *str_data, size_t str
     // for JSON spec, see http://www.ietf.org/rfc/rfc4627.txt
     // if we are given a valid utf8-encoded string, we will print it in a JSON-conforming way
     mp_print_str(print, "\"");
+    const byte *run = str_data;
     for (const byte *s = str_data, *top = str_data + str_len; s < top; s++) {
+        if (*s >= 32 && *s != '"' && *s != '\\') {
+            // this will handle normal and utf-8 encoded chars, which are
+            // printed in runs rather than one at a time
+            continue;
+        }
+        if (s > run) {
+            print->print_strn(print->data, (const char*)run, s - run);
+        }
+        run = s + 1;
         if (*s == '"' || *s == '\\') {
             mp_printf(print, "\\%c", *s);
-        } else if (*s >= 32) {
-            // this will handle normal and utf-8 encoded chars
-            mp_printf(print, "%c", *s);
         } else if (*s == '\n') {
             mp_print_str(print, "\\n");
         } else if (*s == '\r') {
@@ -112,6 +119,9 @@ void mp_str_print_json(const mp_print_t *print, const byte *str_data, size_t str
             mp_printf(print, "\\u%04x", *s);
         }
     }
+    if (str_data + str_len > run) {
+        print->print_strn(print->data, (const char*)run, str_data + str_len - run);
+    }
     mp_print_str(print, "\"");
 }
 #endif
@@ -314,6 +324,59 @@ const byte *find_subbytes(const byte *haystack, size_t hlen, const byte *needle,
 // Note: this function is used to check if an object is a str or bytes, which
 // works because both those types use it as their binary_op method.  Revisit
 // MP_OBJ_IS_STR_OR_BYTES if this fact changes.
+#if MICROPY_OPT_STR_INPLACE_ADD
+
+// s += x makes a str/bytes with spare room at the end of its buffer and
+// remembers it as the tip of that buffer.  If the lhs of the next += is the
+// tip then the rhs is written into the spare room, and the result, a new object
+// sharing the buffer, becomes the tip.  No object is ever changed, each keeps
+// seeing the same prefix of the buffer, but older objects lose their null
+// terminator; mp_obj_str_get_str deals with that.
+STATIC mp_obj_t str_inplace_add(mp_obj_t lhs_in, const mp_obj_type_t *type,
+    const byte *lhs_data, size_t lhs_len, const byte *rhs_data, size_t rhs_len) {
+    mp_obj_t *tips = MP_STATE_VM(str_builder_tip);
+    size_t *allocs = MP_STATE_VM(str_builder_alloc);
+    size_t slot = 0;
+    while (slot < MICROPY_OPT_STR_INPLACE_ADD_SLOTS && tips[slot] != lhs_in) {
+        ++slot;
+    }
+
+    // allocate everything before changing any state, in case allocation fails
+    mp_obj_str_t *o = m_new_obj(mp_obj_str_t);
+    size_t len = lhs_len + rhs_len;
+    byte *buf;
+    size_t alloc;
+    if (slot < MICROPY_OPT_STR_INPLACE_ADD_SLOTS && len < allocs[slot]) {
+        buf = (byte*)lhs_data;
+        alloc = allocs[slot];
+    } else {
+        alloc = len + len / 2 + 16;
+        buf = NULL;
+        if (slot < MICROPY_OPT_STR_INPLACE_ADD_SLOTS) {
+            // grow the buffer where it is, if possible, to save copying it
+            buf = m_renew_maybe(byte, (byte*)lhs_data, allocs[slot], alloc, false);
+        } else {
+            slot = MP_STATE_VM(str_builder_next)++ % MICROPY_OPT_STR_INPLACE_ADD_SLOTS;
+        }
+        if (buf == NULL) {
+            buf = m_new(byte, alloc);
+            memcpy(buf, lhs_data, lhs_len);
+        }
+    }
+
+    memcpy(buf + lhs_len, rhs_data, rhs_len);
+    buf[len] = '\0';
+    o->base.type = type;
+    o->hash = 0; // computed when needed
+    o->len = len;
+    o->data = buf;
+    tips[slot] = MP_OBJ_FROM_PTR(o);
+    allocs[slot] = alloc;
+    return MP_OBJ_FROM_PTR(o);
+}
+
+#endif
+
 mp_obj_t mp_obj_str_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
     // check for modulo
     if (op == MP_BINARY_OP_MODULO) {
@@ -397,6 +460,12 @@ mp_obj_t mp_obj_str_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t rhs_i
                 return lhs_in;
             }
 
+            #if MICROPY_OPT_STR_INPLACE_ADD
+            if (op == MP_BINARY_OP_INPLACE_ADD) {
+                return str_inplace_add(lhs_in, lhs_type, lhs_data, lhs_len, rhs_data, rhs_len);
+            }
+            #endif
+
             vstr_t vstr;
             vstr_init_len(&vstr, lhs_len + rhs_len);
             memcpy(vstr.buf, lhs_data, lhs_len);
@@ -959,6 +1028,133 @@ STATIC NORETURN void terse_str_format_value_error(void) {
 #define terse_str_format_value_error()
 #endif
 
+#if MICROPY_OPT_STR_FORMAT_SIMPLE
+
+// A simple format string is literal text, possibly with escaped braces or
+// percent signs, and fields that each take the next argument with no options:
+// "{}" for the '{' style (str.format), "%s" or "%d" for the '%' style (str %
+// args).  These can be formatted by copying, without the general formatter.
+
+// Check whether the format string is simple in the given style and, if it is,
+// count its fields and the number of bytes of literal text it outputs.
+STATIC bool str_format_scan_simple(byte style, const byte *str, const byte *top, size_t *n_fields, size_t *lit_len) {
+    size_t n = 0;
+    size_t lit = 0;
+    while (str < top) {
+        byte c = *str++;
+        if (c == style || (style == '{' && c == '}')) {
+            if (str >= top) {
+                return false;
+            }
+            byte c1 = *str++;
+            if (c1 != c) {
+                // not an escape, so it must be a simple field
+                if (style == '{' ? (c != '{' || c1 != '}') : (c1 != 's' && c1 != 'd')) {
+                    return false;
+                }
+                ++n;
+                continue;
+            }
+        }
+        ++lit;
+    }
+    *n_fields = n;
+    *lit_len = lit;
+    return true;
+}
+
+// As str_format_scan_simple, but remembering the answer for interned strings,
+// which is what constant format strings in the source are.
+STATIC bool str_format_get_shape(mp_obj_t fmt_in, byte style, const byte *str, size_t len, size_t *n_fields, size_t *lit_len) {
+    if (!MP_OBJ_IS_QSTR(fmt_in)) {
+        return str_format_scan_simple(style, str, str + len, n_fields, lit_len);
+    }
+    qstr q = MP_OBJ_QSTR_VALUE(fmt_in);
+    struct _mp_str_format_cache_t *e = &MP_STATE_VM(str_format_cache)[(q ^ style) & (MICROPY_OPT_STR_FORMAT_CACHE_SIZE - 1)];
+    if (e->fmt != q || e->style != style) {
+        bool simple = str_format_scan_simple(style, str, str + len, n_fields, lit_len);
+        if (simple && (*n_fields > 0xffff || *lit_len > 0xffff)) {
+            // too big to cache
+            return true;
+        }
+        e->fmt = q;
+        e->style = style;
+        e->simple = simple;
+        e->n_fields = *n_fields;
+        e->lit_len = *lit_len;
+    }
+    *n_fields = e->n_fields;
+    *lit_len = e->lit_len;
+    return e->simple;
+}
+
+// Format args into fmt_in if it's a simple format string, otherwise return
+// MP_OBJ_NULL so the caller takes the general path.
+STATIC mp_obj_t str_format_simple(mp_obj_t fmt_in, byte style, size_t n_args, const mp_obj_t *args) {
+    GET_STR_DATA_LEN(fmt_in, str, len);
+    size_t n_fields;
+    size_t size;
+    if (!str_format_get_shape(fmt_in, style, str, len, &n_fields, &size)) {
+        return MP_OBJ_NULL;
+    }
+    // str.format ignores extra arguments but str % args doesn't; in either
+    // case let the general path raise the error
+    if (n_args < n_fields || (style == '%' && n_args != n_fields)) {
+        return MP_OBJ_NULL;
+    }
+
+    // size the output: str arguments are copied as-is, other arguments
+    // are printed and the vstr grows if this guess is too small
+    for (size_t i = 0; i < n_fields; i++) {
+        if (MP_OBJ_IS_STR(args[i])) {
+            GET_STR_LEN(args[i], l);
+            size += l;
+        } else {
+            size += 8;
+        }
+    }
+
+    vstr_t vstr;
+    mp_print_t print;
+    vstr_init_print(&vstr, size, &print);
+    const byte *top = str + len;
+    size_t arg_i = 0;
+    while (str < top) {
+        // copy the run of literal text up to the next escape or field
+        const byte *run = str;
+        while (str < top && *str != style && (style != '{' || *str != '}')) {
+            ++str;
+        }
+        vstr_add_strn(&vstr, (const char*)run, str - run);
+        if (str >= top) {
+            break;
+        }
+
+        // the scan checked that there's a second character
+        byte c = str[0];
+        byte c1 = str[1];
+        str += 2;
+        if (c1 == c) {
+            vstr_add_byte(&vstr, c);
+            continue;
+        }
+        mp_obj_t arg = args[arg_i++];
+        if (c1 == 'd') {
+            // same as the general path with no flags, width or precision
+            mp_print_mp_int(&print, arg_as_int(arg), 10, 'a', 0, ' ', 0, -1);
+        } else if (MP_OBJ_IS_STR(arg)) {
+            GET_STR_DATA_LEN(arg, s, l);
+            vstr_add_strn(&vstr, (const char*)s, l);
+        } else {
+            mp_obj_print_helper(&print, arg, PRINT_STR);
+        }
+    }
+
+    return mp_obj_new_str_from_vstr(&mp_type_str, &vstr);
+}
+
+#endif // MICROPY_OPT_STR_FORMAT_SIMPLE
+
 STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
     vstr_t vstr;
     mp_print_t print;
@@ -1401,6 +1597,15 @@ STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
 mp_obj_t mp_obj_str_format(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
     mp_check_self(MP_OBJ_IS_STR_OR_BYTES(args[0]));
 
+    #if MICROPY_OPT_STR_FORMAT_SIMPLE
+    if (MP_OBJ_IS_STR(args[0])) {
+        mp_obj_t res = str_format_simple(args[0], '{', n_args - 1, args + 1);
+        if (res != MP_OBJ_NULL) {
+            return res;
+        }
+    }
+    #endif
+
     GET_STR_DATA_LEN(args[0], str, len);
     int arg_i = 0;
     vstr_t vstr = mp_obj_str_format_helper((const char*)str, (const char*)str + len, &arg_i, n_args, args, kwargs);
@@ -1411,6 +1616,15 @@ MP_DEFINE_CONST_FUN_OBJ_KW(str_format_obj, 1, mp_obj_str_format);
 STATIC mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_t *args, mp_obj_t dict) {
     mp_check_self(MP_OBJ_IS_STR_OR_BYTES(pattern));
 
+    #if MICROPY_OPT_STR_FORMAT_SIMPLE
+    if (MP_OBJ_IS_STR(pattern)) {
+        mp_obj_t res = str_format_simple(pattern, '%', n_args, args);
+        if (res != MP_OBJ_NULL) {
+            return res;
+        }
+    }
+    #endif
+
     GET_STR_DATA_LEN(pattern, str, len);
     const byte *start_str = str;
     bool is_bytes = MP_OBJ_IS_TYPE(pattern, &mp_type_bytes);
@@ -2158,7 +2372,25 @@ qstr mp_obj_str_get_qstr(mp_obj_t self_in) {
 const char *mp_obj_str_get_str(mp_obj_t self_in) {
     if (MP_OBJ_IS_STR_OR_BYTES(self_in)) {
         GET_STR_DATA_LEN(self_in, s, l);
+        #if MICROPY_OPT_STR_INPLACE_ADD
+        if (s[l] != '\0') {
+            // a later += appended to this string's buffer, see str_inplace_add
+            char *s2 = m_new(char, l + 1);
+            memcpy(s2, s, l);
+            s2[l] = '\0';
+            return s2;
+        }
+        // the caller may keep the pointer, so stop += from appending in place
+        // to this string, which would overwrite its terminator
+        mp_obj_t *tips = MP_STATE_VM(str_builder_tip);
+        for (size_t i = 0; i < MICROPY_OPT_STR_INPLACE_ADD_SLOTS; ++i) {
+            if (tips[i] == self_in) {
+                tips[i] = MP_OBJ_NULL;
+            }
+        }
+        #else
         (void)l; // len unused
+        #endif
         return (const char*)s;
     } else {
         bad_implicit_conversion(self_in);
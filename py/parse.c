@@ -29,6 +29,7 @@
 #include <stdio.h>
 #include <unistd.h> // for ssize_t
 #include <assert.h>
+#include <math.h>
 #include <string.h>
 
 #include "py/lexer.h"
@@ -236,7 +237,6 @@ typedef struct _parser_t {
     mp_lexer_t *lexer;
 
     mp_parse_tree_t tree;
-    mp_parse_chunk_t *cur_chunk;
 
     #if MICROPY_COMP_CONST
     mp_map_t consts;
@@ -254,10 +254,28 @@ STATIC const uint16_t *get_rule_arg(uint8_t r_id) {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wcast-align"
 
-STATIC void *parser_alloc(parser_t *parser, size_t num_bytes) {
+// Finish with the chunk being filled: give back its unused end and link it
+// into the chain of chunks.
+STATIC void parse_tree_close_chunk(mp_parse_tree_t *tree) {
+    mp_parse_chunk_t *chunk = tree->cur_chunk;
+    (void)m_renew_maybe(byte, chunk, sizeof(mp_parse_chunk_t) + chunk->alloc,
+        sizeof(mp_parse_chunk_t) + chunk->union_.used, false);
+    #if MICROPY_MEM_STATS
+    tree->bytes -= chunk->alloc - chunk->union_.used;
+    #endif
+    chunk->alloc = chunk->union_.used;
+    chunk->union_.next = tree->chunk;
+    tree->chunk = chunk;
+    tree->cur_chunk = NULL;
+}
+
+void *mp_parse_tree_alloc(mp_parse_tree_t *tree, size_t num_bytes) {
     // use a custom memory allocator to store parse nodes sequentially in large chunks
 
-    mp_parse_chunk_t *chunk = parser->cur_chunk;
+    // keep everything word aligned, the compiler puts its structures here too
+    num_bytes = (num_bytes + sizeof(mp_uint_t) - 1) & ~(sizeof(mp_uint_t) - 1);
+
+    mp_parse_chunk_t *chunk = tree->cur_chunk;
 
     if (chunk != NULL && chunk->union_.used + num_bytes > chunk->alloc) {
         // not enough room at end of previously allocated chunk so try to grow
@@ -266,15 +284,14 @@ STATIC void *parser_alloc(parser_t *parser, size_t num_bytes) {
             sizeof(mp_parse_chunk_t) + chunk->alloc + num_bytes, false);
         if (new_data == NULL) {
             // could not grow existing memory; shrink it to fit previous
-            (void)m_renew_maybe(byte, chunk, sizeof(mp_parse_chunk_t) + chunk->alloc,
-                sizeof(mp_parse_chunk_t) + chunk->union_.used, false);
-            chunk->alloc = chunk->union_.used;
-            chunk->union_.next = parser->tree.chunk;
-            parser->tree.chunk = chunk;
+            parse_tree_close_chunk(tree);
             chunk = NULL;
         } else {
             // could grow existing memory
             chunk->alloc += num_bytes;
+            #if MICROPY_MEM_STATS
+            tree->bytes += num_bytes;
+            #endif
         }
     }
 
@@ -287,9 +304,18 @@ STATIC void *parser_alloc(parser_t *parser, size_t num_bytes) {
         chunk = (mp_parse_chunk_t*)m_new(byte, sizeof(mp_parse_chunk_t) + alloc);
         chunk->alloc = alloc;
         chunk->union_.used = 0;
-        parser->cur_chunk = chunk;
+        tree->cur_chunk = chunk;
+        #if MICROPY_MEM_STATS
+        tree->bytes += sizeof(mp_parse_chunk_t) + alloc;
+        #endif
     }
 
+    #if MICROPY_MEM_STATS
+    if (tree->bytes > MP_STATE_MEM(peak_parse_tree_bytes)) {
+        MP_STATE_MEM(peak_parse_tree_bytes) = tree->bytes;
+    }
+    #endif
+
     byte *ret = chunk->data + chunk->union_.used;
     chunk->union_.used += num_bytes;
     return ret;
@@ -447,7 +473,7 @@ STATIC void push_result_node(parser_t *parser, mp_parse_node_t pn) {
 }
 
 STATIC mp_parse_node_t make_node_const_object(parser_t *parser, size_t src_line, mp_obj_t obj) {
-    mp_parse_node_struct_t *pn = parser_alloc(parser, sizeof(mp_parse_node_struct_t) + sizeof(mp_obj_t));
+    mp_parse_node_struct_t *pn = mp_parse_tree_alloc(&parser->tree, sizeof(mp_parse_node_struct_t) + sizeof(mp_obj_t));
     pn->source_line = src_line;
     #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_D
     // nodes are 32-bit pointers, but need to store 64-bit object
@@ -473,6 +499,27 @@ STATIC mp_parse_node_t mp_parse_node_new_small_int_checked(parser_t *parser, mp_
     return mp_parse_node_new_small_int(val);
 }
 
+STATIC mp_parse_node_t make_node_str(parser_t *parser, size_t src_line, bool is_bytes, const char *str, size_t len) {
+    // Don't automatically intern all strings/bytes.  doc strings (which are usually large)
+    // will be discarded by the compiler, and so we shouldn't intern them.
+    qstr qst = MP_QSTR_NULL;
+    if (len <= MICROPY_ALLOC_PARSE_INTERN_STRING_LEN) {
+        // intern short strings
+        qst = qstr_from_strn(str, len);
+    } else {
+        // check if this string is already interned
+        qst = qstr_find_strn(str, len);
+    }
+    if (qst != MP_QSTR_NULL) {
+        // qstr exists, make a leaf node
+        return mp_parse_node_new_leaf(is_bytes ? MP_PARSE_NODE_BYTES : MP_PARSE_NODE_STRING, qst);
+    } else {
+        // not interned, make a node holding a pointer to the string/bytes object
+        mp_obj_t o = mp_obj_new_str_copy(is_bytes ? &mp_type_bytes : &mp_type_str, (const byte*)str, len);
+        return make_node_const_object(parser, src_line, o);
+    }
+}
+
 STATIC void push_result_token(parser_t *parser, uint8_t rule_id) {
     mp_parse_node_t pn;
     mp_lexer_t *lex = parser->lexer;
@@ -509,26 +556,7 @@ STATIC void push_result_token(parser_t *parser, uint8_t rule_id) {
         mp_obj_t o = mp_parse_num_decimal(lex->vstr.buf, lex->vstr.len, true, false, lex);
         pn = make_node_const_object(parser, lex->tok_line, o);
     } else if (lex->tok_kind == MP_TOKEN_STRING || lex->tok_kind == MP_TOKEN_BYTES) {
-        // Don't automatically intern all strings/bytes.  doc strings (which are usually large)
-        // will be discarded by the compiler, and so we shouldn't intern them.
-        qstr qst = MP_QSTR_NULL;
-        if (lex->vstr.len <= MICROPY_ALLOC_PARSE_INTERN_STRING_LEN) {
-            // intern short strings
-            qst = qstr_from_strn(lex->vstr.buf, lex->vstr.len);
-        } else {
-            // check if this string is already interned
-            qst = qstr_find_strn(lex->vstr.buf, lex->vstr.len);
-        }
-        if (qst != MP_QSTR_NULL) {
-            // qstr exists, make a leaf node
-            pn = mp_parse_node_new_leaf(lex->tok_kind == MP_TOKEN_STRING ? MP_PARSE_NODE_STRING : MP_PARSE_NODE_BYTES, qst);
-        } else {
-            // not interned, make a node holding a pointer to the string/bytes object
-            mp_obj_t o = mp_obj_new_str_copy(
-                lex->tok_kind == MP_TOKEN_STRING ? &mp_type_str : &mp_type_bytes,
-                (const byte*)lex->vstr.buf, lex->vstr.len);
-            pn = make_node_const_object(parser, lex->tok_line, o);
-        }
+        pn = make_node_str(parser, lex->tok_line, lex->tok_kind == MP_TOKEN_BYTES, lex->vstr.buf, lex->vstr.len);
     } else {
         pn = mp_parse_node_new_leaf(MP_PARSE_NODE_TOKEN, lex->tok_kind);
     }
@@ -591,6 +619,22 @@ STATIC bool fold_logical_constants(parser_t *parser, uint8_t rule_id, size_t *nu
         // we did a complete folding if there's only 1 arg left
         return *num_args == 1;
 
+    } else if (rule_id == RULE_test_if_expr) {
+        // folding for conditional expression: x if c else y
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)peek_result(parser, 0);
+        mp_parse_node_t pn;
+        if (mp_parse_node_is_const_true(pns->nodes[0])) {
+            pn = peek_result(parser, 1);
+        } else if (mp_parse_node_is_const_false(pns->nodes[0])) {
+            pn = pns->nodes[1];
+        } else {
+            return false;
+        }
+        pop_result(parser);
+        pop_result(parser);
+        push_result_node(parser, pn);
+        return true;
+
     } else if (rule_id == RULE_not_test_2) {
         // folding for unary logical op: not
         mp_parse_node_t pn = peek_result(parser, 0);
@@ -609,6 +653,99 @@ STATIC bool fold_logical_constants(parser_t *parser, uint8_t rule_id, size_t *nu
     return false;
 }
 
+#if MICROPY_COMP_CONST_FLOAT
+STATIC bool mp_parse_node_get_number_maybe(mp_parse_node_t pn, mp_obj_t *o) {
+    if (mp_parse_node_get_int_maybe(pn, o)) {
+        return true;
+    }
+    if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, RULE_const_object)) {
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)pn;
+        #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_D
+        *o = (uint64_t)pns->nodes[0] | ((uint64_t)pns->nodes[1] << 32);
+        #else
+        *o = (mp_obj_t)pns->nodes[0];
+        #endif
+        return mp_obj_is_float(*o);
+    }
+    return false;
+}
+
+#if MICROPY_PERSISTENT_CODE_SAVE
+// A float is saved to a .mpy file as its repr, which may not be exact, so only
+// keep a folded float if it survives that; otherwise the .mpy would give a
+// different value to running the source.  mpy-tool.py can't freeze inf or nan.
+STATIC bool float_survives_repr(mp_obj_t o) {
+    if (isinf(mp_obj_float_get(o))) {
+        return false;
+    }
+    vstr_t vstr;
+    mp_print_t print;
+    vstr_init_print(&vstr, 16, &print);
+    mp_obj_print_helper(&print, o, PRINT_REPR);
+    mp_obj_t o2 = mp_parse_num_decimal(vstr.buf, vstr.len, false, false, NULL);
+    vstr_clear(&vstr);
+    return mp_obj_float_get(o2) == mp_obj_float_get(o);
+}
+#endif
+#else
+#define mp_parse_node_get_number_maybe mp_parse_node_get_int_maybe
+#endif
+
+#if MICROPY_COMP_CONST_STR
+STATIC const char *mp_parse_node_get_str_maybe(mp_parse_node_t pn, bool *is_bytes, size_t *len) {
+    if (MP_PARSE_NODE_IS_LEAF(pn)
+        && (MP_PARSE_NODE_LEAF_KIND(pn) == MP_PARSE_NODE_STRING
+        || MP_PARSE_NODE_LEAF_KIND(pn) == MP_PARSE_NODE_BYTES)) {
+        *is_bytes = MP_PARSE_NODE_LEAF_KIND(pn) == MP_PARSE_NODE_BYTES;
+        return (const char*)qstr_data(MP_PARSE_NODE_LEAF_ARG(pn), len);
+    }
+    if (MP_PARSE_NODE_IS_STRUCT_KIND(pn, RULE_const_object)) {
+        mp_parse_node_struct_t *pns = (mp_parse_node_struct_t*)pn;
+        #if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_D
+        mp_obj_t o = (uint64_t)pns->nodes[0] | ((uint64_t)pns->nodes[1] << 32);
+        #else
+        mp_obj_t o = (mp_obj_t)pns->nodes[0];
+        #endif
+        if (MP_OBJ_IS_STR_OR_BYTES(o)) {
+            *is_bytes = !MP_OBJ_IS_STR(o);
+            return mp_obj_str_get_data(o, len);
+        }
+    }
+    return NULL;
+}
+
+STATIC bool fold_str_concat(parser_t *parser, size_t num_args) {
+    // folding for concatenation of string or bytes literals, eg "a" + "b"
+    // the args are on the stack as: str, op, str, op, ..., str
+    bool is_bytes0 = false;
+    for (size_t i = 0; i < num_args; i += 2) {
+        bool is_bytes;
+        size_t len;
+        if (mp_parse_node_get_str_maybe(peek_result(parser, i), &is_bytes, &len) == NULL
+            || (i > 0 && (is_bytes != is_bytes0
+            || MP_PARSE_NODE_LEAF_ARG(peek_result(parser, i - 1)) != MP_TOKEN_OP_PLUS))) {
+            return false;
+        }
+        is_bytes0 = is_bytes;
+    }
+
+    vstr_t vstr;
+    vstr_init(&vstr, 16);
+    for (ssize_t i = num_args - 1; i >= 0; i -= 2) {
+        bool is_bytes;
+        size_t len;
+        const char *str = mp_parse_node_get_str_maybe(peek_result(parser, i), &is_bytes, &len);
+        vstr_add_strn(&vstr, str, len);
+    }
+    for (size_t i = num_args; i > 0; i--) {
+        pop_result(parser);
+    }
+    push_result_node(parser, make_node_str(parser, 0, is_bytes0, vstr.buf, vstr.len));
+    vstr_clear(&vstr);
+    return true;
+}
+#endif
+
 STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
     // this code does folding of arbitrary integer expressions, eg 1 + 2 * 3 + 4
     // it does not do partial folding, eg 1 + 2 + x -> 3 + x
@@ -642,14 +779,19 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
         || rule_id == RULE_arith_expr
         || rule_id == RULE_term) {
         // folding for binary ops: << >> + - * / % //
+        #if MICROPY_COMP_CONST_STR
+        if (rule_id == RULE_arith_expr && fold_str_concat(parser, num_args)) {
+            return true;
+        }
+        #endif
         mp_parse_node_t pn = peek_result(parser, num_args - 1);
-        if (!mp_parse_node_get_int_maybe(pn, &arg0)) {
+        if (!mp_parse_node_get_number_maybe(pn, &arg0)) {
             return false;
         }
         for (ssize_t i = num_args - 2; i >= 1; i -= 2) {
             pn = peek_result(parser, i - 1);
             mp_obj_t arg1;
-            if (!mp_parse_node_get_int_maybe(pn, &arg1)) {
+            if (!mp_parse_node_get_number_maybe(pn, &arg1)) {
                 return false;
             }
             mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(peek_result(parser, i));
@@ -658,7 +800,11 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
                 MP_BINARY_OP_SUBTRACT,
                 MP_BINARY_OP_MULTIPLY,
                 255,//MP_BINARY_OP_POWER,
+                #if MICROPY_COMP_CONST_FLOAT
+                MP_BINARY_OP_TRUE_DIVIDE,
+                #else
                 255,//MP_BINARY_OP_TRUE_DIVIDE,
+                #endif
                 MP_BINARY_OP_FLOOR_DIVIDE,
                 MP_BINARY_OP_MODULO,
                 255,//MP_BINARY_OP_LESS
@@ -670,6 +816,16 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
             if (op == (mp_binary_op_t)255) {
                 return false;
             }
+            #if MICROPY_COMP_CONST_FLOAT
+            if (mp_obj_is_float(arg0) || mp_obj_is_float(arg1)) {
+                // << and >> need ints, and / % // can't have zero rhs
+                if (op <= MP_BINARY_OP_RSHIFT || (op >= MP_BINARY_OP_FLOOR_DIVIDE && !mp_obj_is_true(arg1))) {
+                    return false;
+                }
+                arg0 = mp_binary_op(op, arg0, arg1);
+                continue;
+            }
+            #endif
             int rhs_sign = mp_obj_int_sign(arg1);
             if (op <= MP_BINARY_OP_RSHIFT) {
                 // << and >> can't have negative rhs
@@ -687,7 +843,7 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
     } else if (rule_id == RULE_factor_2) {
         // folding for unary ops: + - ~
         mp_parse_node_t pn = peek_result(parser, 0);
-        if (!mp_parse_node_get_int_maybe(pn, &arg0)) {
+        if (!mp_parse_node_get_number_maybe(pn, &arg0)) {
             return false;
         }
         mp_token_kind_t tok = MP_PARSE_NODE_LEAF_ARG(peek_result(parser, 1));
@@ -698,6 +854,9 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
             op = MP_UNARY_OP_NEGATIVE;
         } else {
             assert(tok == MP_TOKEN_OP_TILDE); // should be
+            if (mp_obj_is_float(arg0)) {
+                return false;
+            }
             op = MP_UNARY_OP_INVERT;
         }
         arg0 = mp_unary_op(op, arg0);
@@ -787,6 +946,12 @@ STATIC bool fold_constants(parser_t *parser, uint8_t rule_id, size_t num_args) {
         return false;
     }
 
+    #if MICROPY_COMP_CONST_FLOAT && MICROPY_PERSISTENT_CODE_SAVE
+    if (mp_obj_is_float(arg0) && !float_survives_repr(arg0)) {
+        return false;
+    }
+    #endif
+
     // success folding this rule
 
     for (size_t i = num_args; i > 0; i--) {
@@ -829,7 +994,7 @@ STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     }
     #endif
 
-    mp_parse_node_struct_t *pn = parser_alloc(parser, sizeof(mp_parse_node_struct_t) + sizeof(mp_parse_node_t) * num_args);
+    mp_parse_node_struct_t *pn = mp_parse_tree_alloc(&parser->tree, sizeof(mp_parse_node_struct_t) + sizeof(mp_parse_node_t) * num_args);
     pn->source_line = src_line;
     pn->kind_num_nodes = (rule_id & 0xff) | (num_args << 8);
     for (size_t i = num_args; i > 0; i--) {
@@ -874,7 +1039,10 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     parser.lexer = lex;
 
     parser.tree.chunk = NULL;
-    parser.cur_chunk = NULL;
+    parser.tree.cur_chunk = NULL;
+    #if MICROPY_MEM_STATS
+    parser.tree.bytes = 0;
+    #endif
 
     #if MICROPY_COMP_CONST
     mp_map_init(&parser.consts, 0);
@@ -1153,14 +1321,8 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     #endif
 
     // truncate final chunk and link into chain of chunks
-    if (parser.cur_chunk != NULL) {
-        (void)m_renew_maybe(byte, parser.cur_chunk,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->alloc,
-            sizeof(mp_parse_chunk_t) + parser.cur_chunk->union_.used,
-            false);
-        parser.cur_chunk->alloc = parser.cur_chunk->union_.used;
-        parser.cur_chunk->union_.next = parser.tree.chunk;
-        parser.tree.chunk = parser.cur_chunk;
+    if (parser.tree.cur_chunk != NULL) {
+        parse_tree_close_chunk(&parser.tree);
     }
 
     if (
@@ -1242,6 +1404,9 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
 }
 
 void mp_parse_tree_clear(mp_parse_tree_t *tree) {
+    if (tree->cur_chunk != NULL) {
+        parse_tree_close_chunk(tree);
+    }
     mp_parse_chunk_t *chunk = tree->chunk;
     while (chunk != NULL) {
         mp_parse_chunk_t *next = chunk->union_.next;
@@ -94,14 +94,22 @@ typedef enum {
     MP_PARSE_EVAL_INPUT,
 } mp_parse_input_kind_t;
 
+// The parse tree's memory is an arena: the nodes, and anything else the
+// compiler allocates with mp_parse_tree_alloc, are freed in one go by
+// mp_parse_tree_clear.
 typedef struct _mp_parse_t {
     mp_parse_node_t root;
     struct _mp_parse_chunk_t *chunk;
+    struct _mp_parse_chunk_t *cur_chunk;
+    #if MICROPY_MEM_STATS
+    size_t bytes;
+    #endif
 } mp_parse_tree_t;
 
 // the parser will raise an exception if an error occurred
 // the parser will free the lexer before it returns
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
+void *mp_parse_tree_alloc(mp_parse_tree_t *tree, size_t num_bytes);
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
 #endif // MICROPY_INCLUDED_PY_PARSE_H
@@ -41,7 +41,7 @@
 #include "py/smallint.h"
 
 // The current version of .mpy files
-#define MPY_VERSION (3)
+#define MPY_VERSION (4)
 
 // The feature flags byte encodes the compile-time config options that
 // affect the generate bytecode.
@@ -55,6 +55,44 @@
     | ((MICROPY_PY_BUILTINS_STR_UNICODE_DYNAMIC) << 1) \
     )
 
+// The upper bits of the feature flags byte give the native architecture of the
+// code in the file, and are zero if it only contains bytecode.
+#define MPY_FEATURE_ENCODE_ARCH(arch) ((arch) << 2)
+#define MPY_FEATURE_DECODE_ARCH(feat) ((feat) >> 2)
+#define MPY_FEATURE_DECODE_FLAGS(feat) ((feat) & 3)
+
+// The native architecture that this runtime can load code for
+#if MICROPY_EMIT_X64
+#define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_X64)
+#elif MICROPY_EMIT_X86
+#define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_X86)
+#elif MICROPY_EMIT_THUMB
+#define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_ARMV7M)
+#elif MICROPY_EMIT_ARM
+#define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_ARMV6)
+#elif MICROPY_EMIT_XTENSA
+#define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_XTENSA)
+#else
+#define MPY_FEATURE_ARCH (MP_NATIVE_ARCH_NONE)
+#endif
+
+// Whether an nlr_buf_t of this runtime fits in the space that saved native
+// code reserves for one
+#if MICROPY_PERSISTENT_CODE_LOAD_NATIVE
+#define MPY_NATIVE_NLR_BUF_FITS (sizeof(nlr_buf_t) <= MP_NATIVE_NLR_BUF_SIZE * sizeof(mp_uint_t))
+#else
+#define MPY_NATIVE_NLR_BUF_FITS (0)
+#endif
+
+// The native architecture of saved code
+#if !MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+#define MPY_FEATURE_ARCH_DYNAMIC (MP_NATIVE_ARCH_NONE)
+#elif MICROPY_DYNAMIC_COMPILER
+#define MPY_FEATURE_ARCH_DYNAMIC (mp_dynamic_compiler.native_arch)
+#else
+#define MPY_FEATURE_ARCH_DYNAMIC (MPY_FEATURE_ARCH)
+#endif
+
 #if MICROPY_PERSISTENT_CODE_LOAD || (MICROPY_PERSISTENT_CODE_SAVE && !MICROPY_DYNAMIC_COMPILER)
 // The bytecode will depend on the number of bits in a small-int, and
 // this function computes that (could make it a fixed constant, but it
@@ -100,12 +138,62 @@ STATIC void extract_prelude(const byte **ip, const byte **ip2, bytecode_prelude_
 
 #if MICROPY_PERSISTENT_CODE_LOAD
 
+#include "py/objtuple.h"
 #include "py/parsenum.h"
 
+// State for loading a .mpy file in place, or NULL when copying it to the heap
+typedef struct _xip_ctx_t xip_ctx_t;
+
 STATIC void raise_corrupt_mpy(void) {
     mp_raise_RuntimeError(translate("Corrupt .mpy file"));
 }
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+// Bytecode loaded in place can't be linked by patching, so it keeps the qstr
+// ids that mpy-cross used.  Those are consistent across a .mpy file, so one
+// table per file, indexed by the old id, gives the id in this runtime.
+struct _xip_ctx_t {
+    uint16_t *qstr_map;
+    size_t qstr_map_alloc;
+    size_t qstr_map_len;
+    // the raw code loaded so far, which gets qstr_map once it is complete
+    mp_raw_code_t **rc;
+    size_t rc_alloc;
+    size_t rc_len;
+};
+
+STATIC void xip_map_qstr(xip_ctx_t *xip, const byte *slot, qstr qst) {
+    size_t id = slot[0] | (slot[1] << 8);
+    if (id >= xip->qstr_map_alloc) {
+        size_t new_alloc = MAX(id + 1, xip->qstr_map_alloc * 2);
+        xip->qstr_map = m_renew(uint16_t, xip->qstr_map, xip->qstr_map_alloc, new_alloc);
+        memset(xip->qstr_map + xip->qstr_map_alloc, 0, (new_alloc - xip->qstr_map_alloc) * sizeof(uint16_t));
+        xip->qstr_map_alloc = new_alloc;
+    }
+    if (xip->qstr_map[id] == MP_QSTR_NULL) {
+        xip->qstr_map[id] = qst;
+        xip->qstr_map_len = MAX(xip->qstr_map_len, id + 1);
+    } else if (xip->qstr_map[id] != qst) {
+        // the same id was used for two different qstrs
+        raise_corrupt_mpy();
+    }
+}
+#endif
+
+// Link a qstr loaded from the file into the bytecode at slot
+STATIC void link_qstr(xip_ctx_t *xip, byte *slot, qstr qst) {
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    if (xip != NULL) {
+        xip_map_qstr(xip, slot, qst);
+        return;
+    }
+    #else
+    (void)xip;
+    #endif
+    slot[0] = qst;
+    slot[1] = qst >> 8;
+}
+
 STATIC int read_byte(mp_reader_t *reader) {
     mp_uint_t b = reader->readbyte(reader->data);
     if (b == MP_READER_EOF) {
@@ -151,6 +239,19 @@ STATIC mp_obj_t load_obj(mp_reader_t *reader) {
     byte obj_type = read_byte(reader);
     if (obj_type == 'e') {
         return MP_OBJ_FROM_PTR(&mp_const_ellipsis_obj);
+    } else if (obj_type == 'n') {
+        return mp_const_none;
+    } else if (obj_type == 'F') {
+        return mp_const_false;
+    } else if (obj_type == 'T') {
+        return mp_const_true;
+    } else if (obj_type == 't') {
+        size_t len = read_uint(reader);
+        mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(len, NULL));
+        for (size_t i = 0; i < len; ++i) {
+            tuple->items[i] = load_obj(reader);
+        }
+        return MP_OBJ_FROM_PTR(tuple);
     } else {
         size_t len = read_uint(reader);
         vstr_t vstr;
@@ -168,24 +269,147 @@ STATIC mp_obj_t load_obj(mp_reader_t *reader) {
     return MP_OBJ_FROM_PTR(&mp_const_none_obj);
 }
 
-STATIC void load_bytecode_qstrs(mp_reader_t *reader, byte *ip, byte *ip_top) {
+STATIC void load_bytecode_qstrs(mp_reader_t *reader, xip_ctx_t *xip, byte *ip, byte *ip_top) {
     while (ip < ip_top) {
         size_t sz;
         uint f = mp_opcode_format(ip, &sz);
         if (f == MP_OPCODE_QSTR) {
-            qstr qst = load_qstr(reader);
-            ip[1] = qst;
-            ip[2] = qst >> 8;
+            link_qstr(xip, ip + 1, load_qstr(reader));
         }
         ip += sz;
     }
 }
 
-STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader) {
+STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, xip_ctx_t *xip, bool has_kind);
+
+#if MICROPY_PERSISTENT_CODE_LOAD_NATIVE
+STATIC mp_raw_code_t *load_native_raw_code(mp_reader_t *reader, xip_ctx_t *xip, mp_raw_code_kind_t kind) {
+    // load the code into executable memory
+    size_t fun_len = read_uint(reader);
+    byte *fun_data;
+    #ifdef MP_PLAT_ALLOC_EXEC
+    size_t fun_alloc;
+    MP_PLAT_ALLOC_EXEC(fun_len, (void**)&fun_data, &fun_alloc);
+    if (fun_data == NULL) {
+        m_malloc_fail(fun_len);
+    }
+    #else
+    fun_data = m_new(byte, fun_len);
+    #endif
+    read_bytes(reader, fun_data, fun_len);
+
+    size_t scope_flags = read_uint(reader);
+    size_t n_pos_args = read_uint(reader);
+    const mp_uint_t *const_table = NULL;
+    mp_uint_t type_sig = 0;
+    if (kind == MP_CODE_NATIVE_PY) {
+        // the argument names are in the code, after the prelude
+        size_t const_table_offset = read_uint(reader);
+        if (const_table_offset > fun_len) {
+            raise_corrupt_mpy();
+        }
+        const_table = (const mp_uint_t*)(void*)(fun_data + const_table_offset);
+    } else {
+        type_sig = read_uint(reader);
+    }
+
+    // load the child raw code, which the relocations refer to in order
+    size_t n_raw_code = read_uint(reader);
+    mp_raw_code_t **raw_code = m_new(mp_raw_code_t*, n_raw_code);
+    for (size_t i = 0; i < n_raw_code; ++i) {
+        raw_code[i] = load_raw_code(reader, xip, true);
+    }
+
+    // link the code by patching each value that depends on this runtime
+    size_t n_reloc = read_uint(reader);
+    size_t raw_code_idx = 0;
+    for (size_t i = 0; i < n_reloc; ++i) {
+        size_t offset = read_uint(reader);
+        byte reloc_kind = read_byte(reader);
+        size_t size = reloc_kind == MP_NATIVE_RELOC_QSTR16 ? 2 : sizeof(mp_uint_t);
+        if (offset > fun_len || size > fun_len - offset) {
+            raise_corrupt_mpy();
+        }
+        mp_uint_t val;
+        switch (reloc_kind) {
+            case MP_NATIVE_RELOC_FUN: {
+                size_t fun_idx = read_uint(reader);
+                if (fun_idx >= MP_F_NUMBER_OF) {
+                    raise_corrupt_mpy();
+                }
+                val = (mp_uint_t)mp_fun_table[fun_idx];
+                break;
+            }
+            case MP_NATIVE_RELOC_QSTR:
+            case MP_NATIVE_RELOC_QSTR16:
+                val = load_qstr(reader);
+                break;
+            case MP_NATIVE_RELOC_QSTR_OBJ:
+                val = (mp_uint_t)MP_OBJ_NEW_QSTR(load_qstr(reader));
+                break;
+            case MP_NATIVE_RELOC_OBJ:
+                val = (mp_uint_t)load_obj(reader);
+                break;
+            case MP_NATIVE_RELOC_RAW_CODE:
+                if (raw_code_idx >= n_raw_code) {
+                    raise_corrupt_mpy();
+                }
+                val = (mp_uint_t)(uintptr_t)raw_code[raw_code_idx++];
+                break;
+            default:
+                raise_corrupt_mpy();
+                return NULL;
+        }
+        if (size == 2) {
+            fun_data[offset] = val;
+            fun_data[offset + 1] = val >> 8;
+        } else {
+            memcpy(fun_data + offset, &val, sizeof(val));
+        }
+    }
+    m_del(mp_raw_code_t*, raw_code, n_raw_code);
+
+    mp_raw_code_t *rc = mp_emit_glue_new_raw_code();
+    mp_emit_glue_assign_native(rc, kind, fun_data, fun_len, const_table,
+        #if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+        NULL, 0,
+        #endif
+        n_pos_args, scope_flags, type_sig);
+    return rc;
+}
+#endif
+
+STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, xip_ctx_t *xip, bool has_kind) {
+    if (has_kind) {
+        byte kind = read_byte(reader);
+        if (kind != MP_CODE_BYTECODE) {
+            #if MICROPY_PERSISTENT_CODE_LOAD_NATIVE
+            if (kind == MP_CODE_NATIVE_PY || kind == MP_CODE_NATIVE_VIPER) {
+                return load_native_raw_code(reader, xip, kind);
+            }
+            #endif
+            raise_corrupt_mpy();
+        }
+    }
+
     // load bytecode
     size_t bc_len = read_uint(reader);
-    byte *bytecode = m_new(byte, bc_len);
-    read_bytes(reader, bytecode, bc_len);
+    byte *bytecode;
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    if (xip != NULL) {
+        // use the bytecode where it is, in the reader's memory
+        mp_reader_mem_t *mem = reader->data;
+        if (bc_len > (size_t)(mem->end - mem->cur)) {
+            raise_corrupt_mpy();
+        }
+        bytecode = (byte*)mem->cur;
+        mem->cur += bc_len;
+    } else
+    #endif
+    {
+        bytecode = m_new(byte, bc_len);
+        read_bytes(reader, bytecode, bc_len);
+    }
 
     // extract prelude
     const byte *ip = bytecode;
@@ -194,11 +418,9 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader) {
     extract_prelude(&ip, &ip2, &prelude);
 
     // load qstrs and link global qstr ids into bytecode
-    qstr simple_name = load_qstr(reader);
-    qstr source_file = load_qstr(reader);
-    ((byte*)ip2)[0] = simple_name; ((byte*)ip2)[1] = simple_name >> 8;
-    ((byte*)ip2)[2] = source_file; ((byte*)ip2)[3] = source_file >> 8;
-    load_bytecode_qstrs(reader, (byte*)ip, bytecode + bc_len);
+    link_qstr(xip, (byte*)ip2, load_qstr(reader)); // simple_name
+    link_qstr(xip, (byte*)ip2 + 2, load_qstr(reader)); // source_file
+    load_bytecode_qstrs(reader, xip, (byte*)ip, bytecode + bc_len);
 
     // load constant table
     size_t n_obj = read_uint(reader);
@@ -212,7 +434,7 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader) {
         *ct++ = (mp_uint_t)load_obj(reader);
     }
     for (size_t i = 0; i < n_raw_code; ++i) {
-        *ct++ = (mp_uint_t)(uintptr_t)load_raw_code(reader);
+        *ct++ = (mp_uint_t)(uintptr_t)load_raw_code(reader, xip, has_kind);
     }
 
     // create raw_code and return it
@@ -226,30 +448,74 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader) {
         n_obj, n_raw_code,
         #endif
         prelude.scope_flags);
+
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    if (xip != NULL) {
+        if (xip->rc_len >= xip->rc_alloc) {
+            xip->rc = m_renew(mp_raw_code_t*, xip->rc, xip->rc_alloc, xip->rc_alloc + 8);
+            xip->rc_alloc += 8;
+        }
+        xip->rc[xip->rc_len++] = rc;
+    }
+    #endif
+
     return rc;
 }
 
-mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader) {
+STATIC mp_raw_code_t *raw_code_load(mp_reader_t *reader, xip_ctx_t *xip) {
     byte header[4];
     read_bytes(reader, header, sizeof(header));
+    byte arch = MPY_FEATURE_DECODE_ARCH(header[2]);
     if (header[0] != 'M'
         || header[1] != MPY_VERSION
-        || header[2] != MPY_FEATURE_FLAGS
-        || header[3] > mp_small_int_bits()) {
+        || MPY_FEATURE_DECODE_FLAGS(header[2]) != MPY_FEATURE_FLAGS
+        || header[3] > mp_small_int_bits()
+        || (arch != MP_NATIVE_ARCH_NONE && (!MICROPY_PERSISTENT_CODE_LOAD_NATIVE || arch != MPY_FEATURE_ARCH
+            || !MPY_NATIVE_NLR_BUF_FITS))) {
         mp_raise_MpyError(translate("Incompatible .mpy file. Please update all .mpy files. See http://adafru.it/mpy-update for more info."));
     }
-    mp_raw_code_t *rc = load_raw_code(reader);
+    // each raw code in a file with native code starts with its kind
+    mp_raw_code_t *rc = load_raw_code(reader, xip, arch != MP_NATIVE_ARCH_NONE);
     reader->close(reader->data);
     return rc;
 }
 
+mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader) {
+    return raw_code_load(reader, NULL);
+}
+
 mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len) {
     mp_reader_t reader;
     mp_reader_new_mem(&reader, buf, len, 0);
     return mp_raw_code_load(&reader);
 }
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+mp_raw_code_t *mp_raw_code_load_mem_xip(const byte *buf, size_t len) {
+    mp_reader_t reader;
+    mp_reader_new_mem(&reader, buf, len, 0);
+    xip_ctx_t xip = {0};
+    mp_raw_code_t *rc = raw_code_load(&reader, &xip);
+
+    // the qstr map is now complete, so trim it and give it to all the code
+    uint16_t *qstr_map = m_renew(uint16_t, xip.qstr_map, xip.qstr_map_alloc, xip.qstr_map_len);
+    for (size_t i = 0; i < xip.rc_len; ++i) {
+        xip.rc[i]->data.u_byte.qstr_map = qstr_map;
+    }
+    m_del(mp_raw_code_t*, xip.rc, xip.rc_alloc);
+
+    return rc;
+}
+#endif
+
 mp_raw_code_t *mp_raw_code_load_file(const char *filename) {
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    size_t len;
+    const byte *buf = mp_persistent_code_map_file(filename, &len);
+    if (buf != NULL) {
+        return mp_raw_code_load_mem_xip(buf, len);
+    }
+    #endif
     mp_reader_t reader;
     mp_reader_new_file(&reader, filename);
     return mp_raw_code_load(&reader);
@@ -260,6 +526,7 @@ mp_raw_code_t *mp_raw_code_load_file(const char *filename) {
 #if MICROPY_PERSISTENT_CODE_SAVE
 
 #include "py/objstr.h"
+#include "py/objtuple.h"
 
 STATIC void mp_print_bytes(mp_print_t *print, const byte *data, size_t len) {
     print->print_strn(print->data, (const char*)data, len);
@@ -300,11 +567,25 @@ STATIC void save_obj(mp_print_t *print, mp_obj_t o) {
     } else if (MP_OBJ_TO_PTR(o) == &mp_const_ellipsis_obj) {
         byte obj_type = 'e';
         mp_print_bytes(print, &obj_type, 1);
+    } else if (o == mp_const_none || o == mp_const_false || o == mp_const_true) {
+        // these appear as constants in native code, and in tuples of constants
+        byte obj_type = o == mp_const_none ? 'n' : o == mp_const_false ? 'F' : 'T';
+        mp_print_bytes(print, &obj_type, 1);
+    } else if (MP_OBJ_IS_TYPE(o, &mp_type_tuple)) {
+        size_t len;
+        mp_obj_t *items;
+        mp_obj_tuple_get(o, &len, &items);
+        byte obj_type = 't';
+        mp_print_bytes(print, &obj_type, 1);
+        mp_print_uint(print, len);
+        for (size_t i = 0; i < len; ++i) {
+            save_obj(print, items[i]);
+        }
     } else {
         // we save numbers using a simplistic text representation
         // TODO could be improved
         byte obj_type;
-        if (MP_OBJ_IS_TYPE(o, &mp_type_int)) {
+        if (MP_OBJ_IS_INT(o)) {
             obj_type = 'i';
         #if MICROPY_PY_BUILTINS_COMPLEX
         } else if (MP_OBJ_IS_TYPE(o, &mp_type_complex)) {
@@ -337,8 +618,73 @@ STATIC void save_bytecode_qstrs(mp_print_t *print, const byte *ip, const byte *i
     }
 }
 
-STATIC void save_raw_code(mp_print_t *print, mp_raw_code_t *rc) {
+STATIC void save_raw_code(mp_print_t *print, mp_raw_code_t *rc, bool has_kind);
+
+#if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+STATIC void save_native_raw_code(mp_print_t *print, mp_raw_code_t *rc) {
+    const byte *fun_data = rc->data.u_native.fun_data;
+    mp_print_uint(print, rc->data.u_native.fun_len);
+    mp_print_bytes(print, fun_data, rc->data.u_native.fun_len);
+    mp_print_uint(print, rc->scope_flags);
+    mp_print_uint(print, rc->n_pos_args);
+    if (rc->kind == MP_CODE_NATIVE_PY) {
+        mp_print_uint(print, (const byte*)rc->data.u_native.const_table - fun_data);
+    } else {
+        mp_print_uint(print, rc->data.u_native.type_sig);
+    }
+
+    // save the child raw code, in the order that the relocations refer to it
+    const mp_native_reloc_t *reloc = rc->data.u_native.reloc;
+    size_t n_reloc = rc->data.u_native.n_reloc;
+    size_t n_raw_code = 0;
+    for (size_t i = 0; i < n_reloc; ++i) {
+        n_raw_code += reloc[i].kind == MP_NATIVE_RELOC_RAW_CODE;
+    }
+    mp_print_uint(print, n_raw_code);
+    for (size_t i = 0; i < n_reloc; ++i) {
+        if (reloc[i].kind == MP_NATIVE_RELOC_RAW_CODE) {
+            save_raw_code(print, (mp_raw_code_t*)(uintptr_t)reloc[i].value, true);
+        }
+    }
+
+    // save the relocations
+    mp_print_uint(print, n_reloc);
+    for (size_t i = 0; i < n_reloc; ++i) {
+        mp_print_uint(print, reloc[i].offset);
+        byte kind = reloc[i].kind;
+        mp_print_bytes(print, &kind, 1);
+        switch (kind) {
+            case MP_NATIVE_RELOC_FUN:
+                mp_print_uint(print, reloc[i].value);
+                break;
+            case MP_NATIVE_RELOC_QSTR:
+            case MP_NATIVE_RELOC_QSTR16:
+            case MP_NATIVE_RELOC_QSTR_OBJ:
+                save_qstr(print, reloc[i].value);
+                break;
+            case MP_NATIVE_RELOC_OBJ:
+                save_obj(print, (mp_obj_t)reloc[i].value);
+                break;
+            default:
+                assert(kind == MP_NATIVE_RELOC_RAW_CODE);
+                break;
+        }
+    }
+}
+#endif
+
+STATIC void save_raw_code(mp_print_t *print, mp_raw_code_t *rc, bool has_kind) {
+    if (has_kind) {
+        byte kind = rc->kind;
+        mp_print_bytes(print, &kind, 1);
+    }
     if (rc->kind != MP_CODE_BYTECODE) {
+        #if MICROPY_PERSISTENT_CODE_SAVE_NATIVE
+        if (has_kind && (rc->kind == MP_CODE_NATIVE_PY || rc->kind == MP_CODE_NATIVE_VIPER)) {
+            save_native_raw_code(print, rc);
+            return;
+        }
+        #endif
         mp_raise_ValueError(translate("can only save bytecode"));
     }
 
@@ -369,7 +715,7 @@ STATIC void save_raw_code(mp_print_t *print, mp_raw_code_t *rc) {
         save_obj(print, (mp_obj_t)*const_table++);
     }
     for (uint i = 0; i < rc->data.u_byte.n_raw_code; ++i) {
-        save_raw_code(print, (mp_raw_code_t*)(uintptr_t)*const_table++);
+        save_raw_code(print, (mp_raw_code_t*)(uintptr_t)*const_table++, has_kind);
     }
 }
 
@@ -377,9 +723,10 @@ void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print) {
     // header contains:
     //  byte  'M'
     //  byte  version
-    //  byte  feature flags
+    //  byte  feature flags, and native architecture
     //  byte  number of bits in a small int
-    byte header[4] = {'M', MPY_VERSION, MPY_FEATURE_FLAGS_DYNAMIC,
+    byte arch = MPY_FEATURE_ARCH_DYNAMIC;
+    byte header[4] = {'M', MPY_VERSION, MPY_FEATURE_FLAGS_DYNAMIC | MPY_FEATURE_ENCODE_ARCH(arch),
         #if MICROPY_DYNAMIC_COMPILER
         mp_dynamic_compiler.small_int_bits,
         #else
@@ -388,13 +735,26 @@ void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print) {
     };
     mp_print_bytes(print, header, sizeof(header));
 
-    save_raw_code(print, rc);
+    save_raw_code(print, rc, arch != MP_NATIVE_ARCH_NONE);
 }
 
 // here we define mp_raw_code_save_file depending on the port
 // TODO abstract this away properly
 
-#if defined(__i386__) || defined(__x86_64__) || defined(__unix__)
+#if MICROPY_VFS
+
+#include "py/stream.h"
+#include "extmod/vfs.h"
+
+void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename) {
+    mp_obj_t args[2] = { mp_obj_new_str(filename, strlen(filename)), MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+    mp_obj_t file = mp_vfs_open(2, args, (mp_map_t*)&mp_const_empty_map);
+    mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+    mp_raw_code_save(rc, &print);
+    mp_stream_close(file);
+}
+
+#elif defined(__i386__) || defined(__x86_64__) || defined(__unix__)
 
 #include <unistd.h>
 #include <sys/stat.h>
@@ -30,10 +30,37 @@
 #include "py/reader.h"
 #include "py/emitglue.h"
 
+// The native architecture that code in a .mpy file was built for.  Files with
+// no native code use MP_NATIVE_ARCH_NONE and load on any architecture.
+enum {
+    MP_NATIVE_ARCH_NONE = 0,
+    MP_NATIVE_ARCH_X86,
+    MP_NATIVE_ARCH_X64,
+    MP_NATIVE_ARCH_ARMV6,
+    MP_NATIVE_ARCH_ARMV6M,
+    MP_NATIVE_ARCH_ARMV7M,
+    MP_NATIVE_ARCH_ARMV7EM,
+    MP_NATIVE_ARCH_ARMV7EMSP,
+    MP_NATIVE_ARCH_ARMV7EMDP,
+    MP_NATIVE_ARCH_XTENSA,
+};
+
 mp_raw_code_t *mp_raw_code_load(mp_reader_t *reader);
 mp_raw_code_t *mp_raw_code_load_mem(const byte *buf, size_t len);
 mp_raw_code_t *mp_raw_code_load_file(const char *filename);
 
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+// Load a .mpy file whose contents stay at buf for as long as the loaded code
+// may run, and execute its bytecode from there.
+mp_raw_code_t *mp_raw_code_load_mem_xip(const byte *buf, size_t len);
+
+// Provided by the port: map the given file (a VFS path if MICROPY_READER_VFS)
+// into memory for use with mp_raw_code_load_mem_xip, or return NULL if it
+// can't be.  The memory must be
+// writable if MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE is enabled.
+const byte *mp_persistent_code_map_file(const char *filename, size_t *len);
+#endif
+
 void mp_raw_code_save(mp_raw_code_t *rc, mp_print_t *print);
 void mp_raw_code_save_file(mp_raw_code_t *rc, const char *filename);
 
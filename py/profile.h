@@ -0,0 +1,52 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2020 CircuitPython contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#ifndef MICROPY_INCLUDED_PY_PROFILE_H
+#define MICROPY_INCLUDED_PY_PROFILE_H
+
+#include "py/mpstate.h"
+
+#if MICROPY_PY_UPROFILE
+
+// A counter in the sampling profiler's table, for one bytecode location.
+// Samples are counted by location and only mapped to source lines when
+// the results are read, to keep mp_prof_sample() cheap.
+typedef struct _mp_prof_entry_t {
+    const struct _mp_obj_fun_bc_t *fun_bc;
+    uint32_t offset; // of the sampled opcode from the start of the bytecode
+    uint32_t count;
+} mp_prof_entry_t;
+
+// Count one sample of the code running on the main thread.  Safe to call
+// from an interrupt or signal handler; with threads the port must make sure
+// it is only called on the main thread, or while the main thread is stopped.
+void mp_prof_sample(void);
+
+// Stop sampling and forget the table, for when the heap is (re)initialised.
+void mp_prof_reset(void);
+
+#endif // MICROPY_PY_UPROFILE
+
+#endif // MICROPY_INCLUDED_PY_PROFILE_H
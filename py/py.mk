@@ -183,6 +183,7 @@ PY_CORE_O_BASENAME = $(addprefix py/,\
 	parsenum.o \
 	emitglue.o \
 	persistentcode.o \
+	jit.o \
 	runtime.o \
 	runtime_utils.o \
 	scheduler.o \
@@ -250,6 +251,7 @@ PY_CORE_O_BASENAME = $(addprefix py/,\
 	modstruct.o \
 	modsys.o \
 	moduerrno.o \
+	modprofile.o \
 	modthread.o \
 	vm.o \
 	bc.o \
@@ -55,3 +55,13 @@ void *mp_pystack_alloc(size_t n_bytes) {
 }
 
 #endif
+
+#if MICROPY_FRAME_ARENA
+
+void mp_frame_arena_init(void *start, void *end) {
+    MP_STATE_THREAD(frame_arena_start) = start;
+    MP_STATE_THREAD(frame_arena_end) = end;
+    MP_STATE_THREAD(frame_arena_cur) = start;
+}
+
+#endif
@@ -73,6 +73,31 @@ static inline size_t mp_pystack_limit(void) {
 
 #endif
 
+#if MICROPY_FRAME_ARENA
+
+void mp_frame_arena_init(void *start, void *end);
+
+// Returns NULL if the arena is full, in which case the caller should use the
+// heap instead.
+static inline void *mp_frame_arena_alloc(size_t n_bytes) {
+    n_bytes = (n_bytes + (MICROPY_PYSTACK_ALIGN - 1)) & ~(MICROPY_PYSTACK_ALIGN - 1);
+    uint8_t *ptr = MP_STATE_THREAD(frame_arena_cur);
+    if (n_bytes > (size_t)(MP_STATE_THREAD(frame_arena_end) - ptr)) {
+        return NULL;
+    }
+    MP_STATE_THREAD(frame_arena_cur) = ptr + n_bytes;
+    return ptr;
+}
+
+// Like mp_pystack_free, this frees ptr and everything allocated after it.
+static inline void mp_frame_arena_free(void *ptr) {
+    assert((uint8_t*)ptr >= MP_STATE_THREAD(frame_arena_start));
+    assert((uint8_t*)ptr <= MP_STATE_THREAD(frame_arena_cur));
+    MP_STATE_THREAD(frame_arena_cur) = (uint8_t*)ptr;
+}
+
+#endif
+
 #if !MICROPY_ENABLE_PYSTACK
 
 #define mp_local_alloc(n_bytes) alloca(n_bytes)
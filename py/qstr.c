@@ -35,8 +35,8 @@
 
 #include "supervisor/linker.h"
 
-// NOTE: we are using linear arrays to store and search for qstr's (unique strings, interned strings)
-// ultimately we will replace this with a static hash table of some kind
+// NOTE: we are using linear arrays to store qstr's (unique strings, interned strings)
+// and, unless MICROPY_QSTR_HASH_INDEX is enabled, to search for them
 // also probably need to include the length in the string data, to allow null bytes in the string
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -84,12 +84,33 @@
 #endif
 
 // this must match the equivalent function in makeqstrdata.py
-mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+STATIC uint32_t qstr_compute_hash_full(const byte *data, size_t len) {
+    #if MICROPY_QSTR_HASH_FNV1A
+    // 32-bit FNV-1a; see http://www.isthe.com/chongo/tech/comp/fnv/
+    uint32_t hash = 2166136261u;
+    for (const byte *top = data + len; data < top; data++) {
+        hash = (hash ^ *data) * 16777619u;
+    }
+    #else
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
-    mp_uint_t hash = 5381;
+    uint32_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    #endif
+    return hash;
+}
+
+// this must match the equivalent function in makeqstrdata.py
+STATIC mp_uint_t qstr_truncate_hash(uint32_t full_hash) {
+    mp_uint_t hash = full_hash;
+    #if MICROPY_QSTR_HASH_FNV1A
+    // fold the upper bits down into the bytes that are stored
+    hash ^= hash >> 16;
+    #if MICROPY_QSTR_BYTES_IN_HASH == 1
+    hash ^= hash >> 8;
+    #endif
+    #endif
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -98,17 +119,41 @@ mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_truncate_hash(qstr_compute_hash_full(data, len));
+}
+
+#if MICROPY_QSTR_HASH_INDEX
+STATIC const uint16_t mp_qstr_const_hash_index[] = {
+#ifndef NO_QSTR
+#define QDEF(id, str)
+#define QHASH(entry) entry,
+#define TRANSLATION(id, length, compressed...)
+#include "genhdr/qstrdefs.generated.h"
+#undef TRANSLATION
+#undef QHASH
+#undef QDEF
+#endif
+};
+#endif
+
 const qstr_pool_t mp_qstr_const_pool = {
     NULL,               // no previous pool
     0,                  // no previous pool
     10,                 // set so that the first dynamically allocated pool is twice this size; must be <= the len (just below)
     MP_QSTRnumber_of,   // corresponds to number of strings in array just below
+    #if MICROPY_QSTR_HASH_INDEX
+    mp_qstr_const_hash_index,
+    MP_ARRAY_SIZE(mp_qstr_const_hash_index) - 1,
+    #endif
     {
 #ifndef NO_QSTR
 #define QDEF(id, str) str,
+#define QHASH(entry)
 #define TRANSLATION(id, length, compressed...)
 #include "genhdr/qstrdefs.generated.h"
 #undef TRANSLATION
+#undef QHASH
 #undef QDEF
 #endif
     },
@@ -125,6 +170,12 @@ void qstr_init(void) {
     MP_STATE_VM(last_pool) = (qstr_pool_t*)&CONST_POOL; // we won't modify the const_pool since it has no allocated room left
     MP_STATE_VM(qstr_last_chunk) = NULL;
 
+    #if MICROPY_QSTR_HASH_INDEX
+    MP_STATE_VM(qstr_hash_index) = NULL;
+    MP_STATE_VM(qstr_hash_index_mask) = 0;
+    MP_STATE_VM(qstr_hash_index_count) = 0;
+    #endif
+
     #if MICROPY_PY_THREAD
     mp_thread_mutex_init(&MP_STATE_VM(qstr_mutex));
     #endif
@@ -140,6 +191,92 @@ STATIC const byte *find_qstr(qstr q) {
     return pool->qstrs[q - pool->total_prev_len];
 }
 
+static inline bool qstr_data_equal(const byte *q, mp_uint_t hash, const char *str, size_t str_len) {
+    return Q_GET_HASH(q) == hash && Q_GET_LENGTH(q) == str_len && memcmp(Q_GET_DATA(q), str, str_len) == 0;
+}
+
+#if MICROPY_QSTR_HASH_INDEX
+
+// The hash indexes are keyed by the full 32-bit hash of a qstr, rather than
+// the truncated hash stored with it, so that they spread well even when
+// MICROPY_QSTR_BYTES_IN_HASH is 1.
+//
+// Dynamically created qstrs live in many small pools, so they share one
+// index, kept in MP_STATE_VM(qstr_hash_index).  Each entry holds the upper
+// 16 bits of the full hash in its upper half and (qstr - first dynamic qstr
+// + 1) in its lower half, so most non-matching probes are rejected without
+// having to find the qstr's pool.  Only the first qstr_hash_index_count
+// dynamic qstrs are indexed; if the index can't grow, later ones are found
+// by scanning their pools.
+
+#define Q_INDEX_MAX_DYNAMIC (0xffff)
+
+static inline size_t qstr_first_dynamic(void) {
+    return CONST_POOL.total_prev_len + CONST_POOL.len;
+}
+
+STATIC qstr qstr_find_in_pool_index(const qstr_pool_t *pool, uint32_t full_hash, mp_uint_t hash, const char *str, size_t str_len) {
+    size_t mask = pool->hash_index_mask;
+    for (size_t pos = full_hash & mask;; pos = (pos + 1) & mask) {
+        size_t n = pool->hash_index[pos];
+        if (n == 0) {
+            return 0;
+        }
+        if (qstr_data_equal(pool->qstrs[n - 1], hash, str, str_len)) {
+            return pool->total_prev_len + n - 1;
+        }
+    }
+}
+
+STATIC void qstr_index_insert(uint32_t *index, size_t mask, uint32_t full_hash, size_t n) {
+    size_t pos = full_hash & mask;
+    while (index[pos] != 0) {
+        pos = (pos + 1) & mask;
+    }
+    index[pos] = (full_hash & 0xffff0000) | (n + 1);
+}
+
+// qstr_mutex must be taken while in this function
+STATIC void qstr_index_add(qstr q, const byte *q_ptr) {
+    size_t n = q - qstr_first_dynamic();
+    if (n != MP_STATE_VM(qstr_hash_index_count) || n >= Q_INDEX_MAX_DYNAMIC) {
+        // index was not kept up to date, so leave this qstr to the scan
+        return;
+    }
+    if (MP_STATE_VM(qstr_hash_index) == NULL || (n + 1) * 3 > (MP_STATE_VM(qstr_hash_index_mask) + 1) * 2) {
+        // grow the index, keeping it at most 2/3 full
+        size_t old_len = MP_STATE_VM(qstr_hash_index) == NULL ? 0 : MP_STATE_VM(qstr_hash_index_mask) + 1;
+        size_t new_len = old_len == 0 ? 64 : old_len * 2;
+        uint32_t *index = m_new_ll_maybe(uint32_t, new_len);
+        if (index == NULL) {
+            return;
+        }
+        memset(index, 0, new_len * sizeof(uint32_t));
+        size_t first = qstr_first_dynamic();
+        for (qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != &CONST_POOL; pool = pool->prev) {
+            for (size_t i = 0; i < pool->len; i++) {
+                size_t k = pool->total_prev_len + i - first;
+                if (k < n) {
+                    const byte *qd = pool->qstrs[i];
+                    qstr_index_insert(index, new_len - 1, qstr_compute_hash_full(Q_GET_DATA(qd), Q_GET_LENGTH(qd)), k);
+                }
+            }
+        }
+        #if !(MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL)
+        // without a GIL another thread may still be probing the old index,
+        // so leave it to the GC in that case
+        m_del(uint32_t, MP_STATE_VM(qstr_hash_index), old_len);
+        #endif
+        MP_STATE_VM(qstr_hash_index) = index;
+        MP_STATE_VM(qstr_hash_index_mask) = new_len - 1;
+    }
+    uint32_t full_hash = qstr_compute_hash_full(Q_GET_DATA(q_ptr), Q_GET_LENGTH(q_ptr));
+    qstr_index_insert(MP_STATE_VM(qstr_hash_index), MP_STATE_VM(qstr_hash_index_mask), full_hash, n);
+    MP_STATE_VM(qstr_hash_index_count) = n + 1;
+}
+
+#endif // MICROPY_QSTR_HASH_INDEX
+
 // qstr_mutex must be taken while in this function
 STATIC qstr qstr_add(const byte *q_ptr) {
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", Q_GET_HASH(q_ptr), Q_GET_LENGTH(q_ptr), Q_GET_LENGTH(q_ptr), Q_GET_DATA(q_ptr));
@@ -159,25 +296,75 @@ STATIC qstr qstr_add(const byte *q_ptr) {
         pool->total_prev_len = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len;
         pool->alloc = new_pool_length;
         pool->len = 0;
+        #if MICROPY_QSTR_HASH_INDEX
+        pool->hash_index = NULL;
+        pool->hash_index_mask = 0;
+        #endif
         MP_STATE_VM(last_pool) = pool;
         DEBUG_printf("QSTR: allocate new pool of size %d\n", MP_STATE_VM(last_pool)->alloc);
     }
 
     // add the new qstr
     MP_STATE_VM(last_pool)->qstrs[MP_STATE_VM(last_pool)->len++] = q_ptr;
+    qstr q = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len - 1;
+
+    #if MICROPY_QSTR_HASH_INDEX
+    qstr_index_add(q, q_ptr);
+    #endif
 
     // return id for the newly-added qstr
-    return MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len - 1;
+    return q;
 }
 
 qstr qstr_find_strn(const char *str, size_t str_len) {
     // work out hash of str
-    mp_uint_t str_hash = qstr_compute_hash((const byte*)str, str_len);
+    uint32_t str_full_hash = qstr_compute_hash_full((const byte*)str, str_len);
+    mp_uint_t str_hash = qstr_truncate_hash(str_full_hash);
+
+    #if MICROPY_QSTR_HASH_INDEX
+    // search the index of dynamic qstrs
+    const uint32_t *index = MP_STATE_VM(qstr_hash_index);
+    if (index != NULL) {
+        size_t mask = MP_STATE_VM(qstr_hash_index_mask);
+        for (size_t pos = str_full_hash & mask; index[pos] != 0; pos = (pos + 1) & mask) {
+            if ((index[pos] & 0xffff0000) == (str_full_hash & 0xffff0000)) {
+                qstr q = qstr_first_dynamic() + (index[pos] & 0xffff) - 1;
+                if (qstr_data_equal(find_qstr(q), str_hash, str, str_len)) {
+                    return q;
+                }
+            }
+        }
+    }
 
+    // scan the dynamic qstrs that are not in the index
+    qstr first_unindexed = qstr_first_dynamic() + MP_STATE_VM(qstr_hash_index_count);
+    qstr_pool_t *pool = MP_STATE_VM(last_pool);
+    for (; pool != &CONST_POOL; pool = pool->prev) {
+        for (size_t i = pool->len; i > 0 && pool->total_prev_len + i > first_unindexed; i--) {
+            if (qstr_data_equal(pool->qstrs[i - 1], str_hash, str, str_len)) {
+                return pool->total_prev_len + i - 1;
+            }
+        }
+        if (pool->total_prev_len <= first_unindexed) {
+            break;
+        }
+    }
+
+    // search the const pools
+    for (pool = (qstr_pool_t*)&CONST_POOL; pool != NULL; pool = pool->prev) {
+        if (pool->hash_index != NULL) {
+            qstr q = qstr_find_in_pool_index(pool, str_full_hash, str_hash, str, str_len);
+            if (q != 0) {
+                return q;
+            }
+            continue;
+        }
+    #else
     // search pools for the data
     for (qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    #endif
         for (const byte **q = pool->qstrs, **q_top = pool->qstrs + pool->len; q < q_top; q++) {
-            if (Q_GET_HASH(*q) == str_hash && Q_GET_LENGTH(*q) == str_len && memcmp(Q_GET_DATA(*q), str, str_len) == 0) {
+            if (qstr_data_equal(*q, str_hash, str, str_len)) {
                 return pool->total_prev_len + (q - pool->qstrs);
             }
         }
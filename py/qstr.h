@@ -52,6 +52,13 @@ typedef struct _qstr_pool_t {
     size_t total_prev_len;
     size_t alloc;
     size_t len;
+    #if MICROPY_QSTR_HASH_INDEX
+    // Open-addressed index of (pool-local qstr number + 1) by hash, with
+    // hash_index_mask + 1 entries; NULL for dynamically allocated pools,
+    // which are covered by the index in MP_STATE_VM(qstr_hash_index).
+    const uint16_t *hash_index;
+    size_t hash_index_mask;
+    #endif
     const byte *qstrs[];
 } qstr_pool_t;
 
@@ -31,13 +31,6 @@
 #include "py/mperrno.h"
 #include "py/reader.h"
 
-typedef struct _mp_reader_mem_t {
-    size_t free_len; // if >0 mem is freed on close by: m_free(beg, free_len)
-    const byte *beg;
-    const byte *cur;
-    const byte *end;
-} mp_reader_mem_t;
-
 STATIC mp_uint_t mp_reader_mem_readbyte(void *data) {
     mp_reader_mem_t *reader = (mp_reader_mem_t*)data;
     if (reader->cur < reader->end) {
@@ -47,6 +40,17 @@ STATIC mp_uint_t mp_reader_mem_readbyte(void *data) {
     }
 }
 
+#if MICROPY_LEXER_FAST_SCAN
+STATIC size_t mp_reader_mem_readblock(void *data, const byte **buf) {
+    mp_reader_mem_t *reader = (mp_reader_mem_t*)data;
+    // the whole of the rest of the memory is one block
+    size_t len = reader->end - reader->cur;
+    *buf = reader->cur;
+    reader->cur = reader->end;
+    return len;
+}
+#endif
+
 STATIC void mp_reader_mem_close(void *data) {
     mp_reader_mem_t *reader = (mp_reader_mem_t*)data;
     if (reader->free_len > 0) {
@@ -63,6 +67,9 @@ void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t
     rm->end = buf + len;
     reader->data = rm;
     reader->readbyte = mp_reader_mem_readbyte;
+    #if MICROPY_LEXER_FAST_SCAN
+    reader->readblock = mp_reader_mem_readblock;
+    #endif
     reader->close = mp_reader_mem_close;
 }
 
@@ -72,12 +79,20 @@ void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t
 #include <fcntl.h>
 #include <unistd.h>
 
+// the lexer reads in blocks when it can scan them directly, so a bigger
+// buffer pays off there
+#if MICROPY_LEXER_FAST_SCAN
+#define MP_READER_POSIX_BUF_SIZE (512)
+#else
+#define MP_READER_POSIX_BUF_SIZE (20)
+#endif
+
 typedef struct _mp_reader_posix_t {
     bool close_fd;
     int fd;
     size_t len;
     size_t pos;
-    byte buf[20];
+    byte buf[MP_READER_POSIX_BUF_SIZE];
 } mp_reader_posix_t;
 
 STATIC mp_uint_t mp_reader_posix_readbyte(void *data) {
@@ -98,6 +113,28 @@ STATIC mp_uint_t mp_reader_posix_readbyte(void *data) {
     return reader->buf[reader->pos++];
 }
 
+#if MICROPY_LEXER_FAST_SCAN
+STATIC size_t mp_reader_posix_readblock(void *data, const byte **buf) {
+    mp_reader_posix_t *reader = (mp_reader_posix_t*)data;
+    if (reader->pos >= reader->len) {
+        if (reader->len == 0) {
+            return 0;
+        }
+        int n = read(reader->fd, reader->buf, sizeof(reader->buf));
+        if (n <= 0) {
+            reader->len = 0;
+            return 0;
+        }
+        reader->len = n;
+        reader->pos = 0;
+    }
+    size_t len = reader->len - reader->pos;
+    *buf = reader->buf + reader->pos;
+    reader->pos = reader->len;
+    return len;
+}
+#endif
+
 STATIC void mp_reader_posix_close(void *data) {
     mp_reader_posix_t *reader = (mp_reader_posix_t*)data;
     if (reader->close_fd) {
@@ -121,6 +158,9 @@ void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd) {
     rp->pos = 0;
     reader->data = rp;
     reader->readbyte = mp_reader_posix_readbyte;
+    #if MICROPY_LEXER_FAST_SCAN
+    reader->readblock = mp_reader_posix_readblock;
+    #endif
     reader->close = mp_reader_posix_close;
 }
 
@@ -33,12 +33,28 @@
 // it can be called again after returning MP_READER_EOF, and in that case must return MP_READER_EOF
 #define MP_READER_EOF ((mp_uint_t)(-1))
 
+// the readblock function consumes the next block of bytes in the input stream,
+// setting *buf to point to them and returning their number; the bytes stay
+// valid until the next call into the reader
+// it must return 0 if end of stream, and keep doing so if called again
 typedef struct _mp_reader_t {
     void *data;
     mp_uint_t (*readbyte)(void *data);
+    #if MICROPY_LEXER_FAST_SCAN
+    size_t (*readblock)(void *data, const byte **buf);
+    #endif
     void (*close)(void *data);
 } mp_reader_t;
 
+// the state of a reader made by mp_reader_new_mem, which other code can use to
+// access the underlying memory directly
+typedef struct _mp_reader_mem_t {
+    size_t free_len; // if >0 mem is freed on close by: m_free(beg, free_len)
+    const byte *beg;
+    const byte *cur;
+    const byte *end;
+} mp_reader_mem_t;
+
 void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t free_len);
 void mp_reader_new_file(mp_reader_t *reader, const char *filename);
 void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd);
@@ -46,6 +46,7 @@
 #include "py/builtin.h"
 #include "py/stackctrl.h"
 #include "py/gc.h"
+#include "py/profile.h"
 
 #include "supervisor/shared/translate.h"
 
@@ -58,6 +59,11 @@
 #define DEBUG_OP_printf(...) (void)0
 #endif
 
+#if MICROPY_FRAME_ARENA
+// uint64_t elements keep the frames aligned to MICROPY_PYSTACK_ALIGN
+STATIC uint64_t frame_arena[(MICROPY_FRAME_ARENA_SIZE + 7) / 8];
+#endif
+
 const mp_obj_module_t mp_module___main__ = {
     .base = { &mp_type_module },
     .globals = (mp_obj_dict_t*)&MP_STATE_VM(dict_main),
@@ -66,6 +72,11 @@ const mp_obj_module_t mp_module___main__ = {
 void mp_init(void) {
     qstr_init();
 
+    #if MICROPY_PY_UPROFILE
+    // any profile table was in the previous heap
+    mp_prof_reset();
+    #endif
+
     // no pending exceptions to start with
     MP_STATE_VM(mp_pending_exception) = MP_OBJ_NULL;
     #if MICROPY_ENABLE_SCHEDULER
@@ -77,6 +88,10 @@ void mp_init(void) {
     mp_init_emergency_exception_buf();
 #endif
 
+    #if MICROPY_FRAME_ARENA
+    mp_frame_arena_init(frame_arena, (uint8_t*)frame_arena + sizeof(frame_arena));
+    #endif
+
     #if MICROPY_KBD_EXCEPTION
     // initialise the exception object for raising KeyboardInterrupt
     MP_STATE_VM(mp_kbd_exception).base.type = &mp_type_KeyboardInterrupt;
@@ -100,6 +115,34 @@ void mp_init(void) {
     #if MICROPY_ENABLE_COMPILER
     // optimization disabled by default
     MP_STATE_VM(mp_optimise_value) = 0;
+    #if MICROPY_MODULE_BYTECODE_CACHE
+    MP_STATE_VM(bytecode_cache_enabled) = true;
+    MP_STATE_VM(bytecode_cache_writable) = true;
+    #endif
+    #endif
+
+    #if MICROPY_MODULE_STAT_CACHE
+    mp_map_init(&MP_STATE_VM(import_stat_cache), 0);
+    MP_STATE_VM(import_stat_cache_stale) = false;
+    #endif
+
+    #if MICROPY_JIT
+    MP_STATE_VM(jit_table) = NULL;
+    MP_STATE_VM(jit_table_len) = 0;
+    MP_STATE_VM(jit_table_alloc) = 0;
+    MP_STATE_VM(jit_source_table) = NULL;
+    MP_STATE_VM(jit_source_table_len) = 0;
+    MP_STATE_VM(jit_source_table_alloc) = 0;
+    #endif
+
+    #if MICROPY_OPT_STR_INPLACE_ADD
+    memset(MP_STATE_VM(str_builder_tip), 0, sizeof(MP_STATE_VM(str_builder_tip)));
+    MP_STATE_VM(str_builder_next) = 0;
+    #endif
+
+    #if MICROPY_OPT_STR_FORMAT_SIMPLE
+    // qstr numbers are reused after a soft reset
+    memset(MP_STATE_VM(str_format_cache), 0, sizeof(MP_STATE_VM(str_format_cache)));
     #endif
 
     // init global module dict
@@ -125,6 +168,10 @@ void mp_init(void) {
     MP_STATE_VM(dupterm_arr_obj) = MP_OBJ_NULL;
     #endif
 
+    #if MICROPY_PY_URE && MICROPY_PY_URE_CACHE_SIZE
+    memset(MP_STATE_VM(ure_cache), 0, sizeof(MP_STATE_VM(ure_cache)));
+    #endif
+
     #ifdef MICROPY_FSUSERMOUNT
     // zero out the pointers to the user-mounted devices
     memset(MP_STATE_VM(fs_user_mount) + MICROPY_FATFS_NUM_PERSISTENT, 0,
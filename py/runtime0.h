@@ -33,6 +33,7 @@
 #define MP_SCOPE_FLAG_VARKEYWORDS  (0x02)
 #define MP_SCOPE_FLAG_GENERATOR    (0x04)
 #define MP_SCOPE_FLAG_DEFKWARGS    (0x08)
+#define MP_SCOPE_FLAG_SIMPLE_ARGS  (0x10) // only positional args, none with defaults
 
 // types for native (viper) function signature
 #define MP_NATIVE_TYPE_OBJ  (0x00)
@@ -43,6 +44,7 @@
 #define MP_NATIVE_TYPE_PTR8 (0x05)
 #define MP_NATIVE_TYPE_PTR16 (0x06)
 #define MP_NATIVE_TYPE_PTR32 (0x07)
+#define MP_NATIVE_TYPE_FLOAT (0x08)
 
 typedef enum {
     // These ops may appear in the bytecode. Changing this group
@@ -165,10 +167,8 @@ typedef enum {
     MP_F_LIST_APPEND,
     MP_F_BUILD_MAP,
     MP_F_STORE_MAP,
-#if MICROPY_PY_BUILTINS_SET
     MP_F_STORE_SET,
     MP_F_BUILD_SET,
-#endif
     MP_F_MAKE_FUNCTION_FROM_RAW_CODE,
     MP_F_NATIVE_CALL_FUNCTION_N_KW,
     MP_F_CALL_METHOD_N_KW,
@@ -181,9 +181,7 @@ typedef enum {
     MP_F_IMPORT_NAME,
     MP_F_IMPORT_FROM,
     MP_F_IMPORT_ALL,
-#if MICROPY_PY_BUILTINS_SLICE
     MP_F_NEW_SLICE,
-#endif
     MP_F_UNPACK_SEQUENCE,
     MP_F_UNPACK_EX,
     MP_F_DELETE_NAME,
@@ -193,6 +191,10 @@ typedef enum {
     MP_F_SETUP_CODE_STATE,
     MP_F_SMALL_INT_FLOOR_DIVIDE,
     MP_F_SMALL_INT_MODULO,
+    MP_F_FLOAT_BINARY_OP,
+    MP_F_FLOAT_CONVERT,
+    MP_F_NATIVE_LOOP_HOOK,
+    MP_F_JIT_SETUP_CODE_STATE,
     MP_F_NUMBER_OF,
 } mp_fun_kind_t;
 
@@ -25,6 +25,7 @@
  */
 
 #include <assert.h>
+#include <string.h>
 
 #include "py/scope.h"
 
@@ -40,8 +41,10 @@ STATIC const uint8_t scope_simple_name_table[] = {
     [SCOPE_GEN_EXPR] = MP_QSTR__lt_genexpr_gt_,
 };
 
-scope_t *scope_new(scope_kind_t kind, mp_parse_node_t pn, qstr source_file, mp_uint_t emit_options) {
-    scope_t *scope = m_new0(scope_t, 1);
+scope_t *scope_new(mp_parse_tree_t *arena, scope_kind_t kind, mp_parse_node_t pn, qstr source_file, mp_uint_t emit_options) {
+    scope_t *scope = mp_parse_tree_alloc(arena, sizeof(scope_t));
+    memset(scope, 0, sizeof(scope_t));
+    scope->arena = arena;
     scope->kind = kind;
     scope->pn = pn;
     scope->source_file = source_file;
@@ -54,16 +57,11 @@ scope_t *scope_new(scope_kind_t kind, mp_parse_node_t pn, qstr source_file, mp_u
     scope->raw_code = mp_emit_glue_new_raw_code();
     scope->emit_options = emit_options;
     scope->id_info_alloc = MICROPY_ALLOC_SCOPE_ID_INIT;
-    scope->id_info = m_new(id_info_t, scope->id_info_alloc);
+    scope->id_info = mp_parse_tree_alloc(arena, scope->id_info_alloc * sizeof(id_info_t));
 
     return scope;
 }
 
-void scope_free(scope_t *scope) {
-    m_del(id_info_t, scope->id_info, scope->id_info_alloc);
-    m_del(scope_t, scope, 1);
-}
-
 id_info_t *scope_find_or_add_id(scope_t *scope, qstr qst, bool *added) {
     id_info_t *id_info = scope_find(scope, qst);
     if (id_info != NULL) {
@@ -72,9 +70,14 @@ id_info_t *scope_find_or_add_id(scope_t *scope, qstr qst, bool *added) {
     }
 
     // make sure we have enough memory
+    // (the arena can't free, so the old array is left behind until the whole
+    // arena is released; grow geometrically to keep that waste bounded)
     if (scope->id_info_len >= scope->id_info_alloc) {
-        scope->id_info = m_renew(id_info_t, scope->id_info, scope->id_info_alloc, scope->id_info_alloc + MICROPY_ALLOC_SCOPE_ID_INC);
-        scope->id_info_alloc += MICROPY_ALLOC_SCOPE_ID_INC;
+        size_t new_alloc = scope->id_info_alloc + MAX(scope->id_info_alloc, MICROPY_ALLOC_SCOPE_ID_INC);
+        id_info_t *new_id_info = mp_parse_tree_alloc(scope->arena, new_alloc * sizeof(id_info_t));
+        memcpy(new_id_info, scope->id_info, scope->id_info_len * sizeof(id_info_t));
+        scope->id_info = new_id_info;
+        scope->id_info_alloc = new_alloc;
     }
 
     // add new id to end of array of all ids; this seems to match CPython
@@ -85,10 +85,15 @@ typedef struct _scope_t {
     uint16_t id_info_alloc;
     uint16_t id_info_len;
     id_info_t *id_info;
+    mp_parse_tree_t *arena;
+    #if MICROPY_JIT
+    size_t jit_code_size; // of its bytecode, to compare it with a hot function's
+    #endif
 } scope_t;
 
-scope_t *scope_new(scope_kind_t kind, mp_parse_node_t pn, qstr source_file, mp_uint_t emit_options);
-void scope_free(scope_t *scope);
+// scopes and their id_info arrays live in the arena of the given parse tree
+// and are freed along with it by mp_parse_tree_clear
+scope_t *scope_new(mp_parse_tree_t *arena, scope_kind_t kind, mp_parse_node_t pn, qstr source_file, mp_uint_t emit_options);
 id_info_t *scope_find_or_add_id(scope_t *scope, qstr qstr, bool *added);
 id_info_t *scope_find(scope_t *scope, qstr qstr);
 id_info_t *scope_find_global(scope_t *scope, qstr qstr);
@@ -58,10 +58,21 @@
 #define DECODE_ULABEL size_t ulab = (ip[0] | (ip[1] << 8)); ip += 2
 #define DECODE_SLABEL size_t slab = (ip[0] | (ip[1] << 8)) - 0x8000; ip += 2
 
+#if MICROPY_JIT
+// Count a jump back to an earlier opcode, ie a loop iteration, towards the
+// function being compiled to native code
+#define JIT_COUNT_JUMP(slab) \
+    if ((mp_int_t)(slab) < 0 && code_state->fun_bc->jit_count < MICROPY_JIT_THRESHOLD) { \
+        ++code_state->fun_bc->jit_count; \
+    }
+#else
+#define JIT_COUNT_JUMP(slab)
+#endif
+
 #if MICROPY_PERSISTENT_CODE
 
 #define DECODE_QSTR \
-    qstr qst = ip[0] | ip[1] << 8; \
+    qstr qst = MP_OBJ_FUN_BC_QSTR(code_state->fun_bc, ip[0] | ip[1] << 8); \
     ip += 2;
 #define DECODE_PTR \
     DECODE_UINT; \
@@ -150,6 +161,15 @@ mp_vm_return_kind_t PLACE_IN_ITCM(mp_execute_bytecode)(mp_code_state_t *code_sta
     // loop and the exception handler, leading to very obscure bugs.
     #define RAISE(o) do { nlr_pop(); nlr.ret_val = MP_OBJ_TO_PTR(o); goto exception_handler; } while (0)
 
+    #if MICROPY_PY_UPROFILE
+    // the sampling profiler looks at the innermost running code state, so
+    // make it this one and restore the caller's on the way out
+    const mp_code_state_t *prof_caller_code_state = MP_STATE_THREAD(prof_code_state);
+    #define PROF_RESTORE_CODE_STATE() MP_STATE_THREAD(prof_code_state) = prof_caller_code_state
+    #else
+    #define PROF_RESTORE_CODE_STATE()
+    #endif
+
 #if MICROPY_STACKLESS
 run_code_state: ;
 #endif
@@ -162,6 +182,10 @@ run_code_state: ;
         exc_stack = (mp_exc_stack_t*)(code_state->state + n_state);
     }
 
+    #if MICROPY_PY_UPROFILE
+    MP_STATE_THREAD(prof_code_state) = code_state;
+    #endif
+
     // variables that are visible to the exception handler (declared volatile)
     volatile bool currently_in_except_block = MP_TAGPTR_TAG0(code_state->exc_sp); // 0 or 1, to detect nested exceptions
     mp_exc_stack_t *volatile exc_sp = MP_TAGPTR_PTR(code_state->exc_sp); // stack grows up, exc_sp points to top of stack
@@ -538,6 +562,7 @@ dispatch_loop:
                 ENTRY(MP_BC_JUMP): {
                     DECODE_SLABEL;
                     ip += slab;
+                    JIT_COUNT_JUMP(slab);
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
 
@@ -545,6 +570,7 @@ dispatch_loop:
                     DECODE_SLABEL;
                     if (mp_obj_is_true(POP())) {
                         ip += slab;
+                        JIT_COUNT_JUMP(slab);
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -553,6 +579,7 @@ dispatch_loop:
                     DECODE_SLABEL;
                     if (!mp_obj_is_true(POP())) {
                         ip += slab;
+                        JIT_COUNT_JUMP(slab);
                     }
                     DISPATCH_WITH_PEND_EXC_CHECK();
                 }
@@ -1120,6 +1147,7 @@ unwind_return:
                         goto run_code_state;
                     }
                     #endif
+                    PROF_RESTORE_CODE_STATE();
                     return MP_VM_RETURN_NORMAL;
 
                 ENTRY(MP_BC_RAISE_VARARGS): {
@@ -1157,6 +1185,7 @@ yield:
                     code_state->ip = ip;
                     code_state->sp = sp;
                     code_state->exc_sp = MP_TAGPTR_MAKE(exc_sp, currently_in_except_block);
+                    PROF_RESTORE_CODE_STATE();
                     return MP_VM_RETURN_YIELD;
 
                 ENTRY(MP_BC_YIELD_FROM): {
@@ -1286,6 +1315,7 @@ yield:
                     mp_obj_t obj = mp_obj_new_exception_msg(&mp_type_NotImplementedError, translate("byte code not implemented"));
                     nlr_pop();
                     fastn[0] = obj;
+                    PROF_RESTORE_CODE_STATE();
                     return MP_VM_RETURN_EXCEPTION;
                 }
 
@@ -1383,50 +1413,9 @@ unwind_loop:
             // TODO: don't set traceback for exceptions re-raised by END_FINALLY.
             // But consider how to handle nested exceptions.
             if (nlr.ret_val != &mp_const_GeneratorExit_obj) {
-                const byte *ip = code_state->fun_bc->bytecode;
-                ip = mp_decode_uint_skip(ip); // skip n_state
-                ip = mp_decode_uint_skip(ip); // skip n_exc_stack
-                ip++; // skip scope_params
-                ip++; // skip n_pos_args
-                ip++; // skip n_kwonly_args
-                ip++; // skip n_def_pos_args
-                size_t bc = code_state->ip - ip;
-                size_t code_info_size = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip); // skip code_info_size
-                bc -= code_info_size;
-                #if MICROPY_PERSISTENT_CODE
-                qstr block_name = ip[0] | (ip[1] << 8);
-                qstr source_file = ip[2] | (ip[3] << 8);
-                ip += 4;
-                #else
-                qstr block_name = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip);
-                qstr source_file = mp_decode_uint_value(ip);
-                ip = mp_decode_uint_skip(ip);
-                #endif
-                size_t source_line = 1;
-                size_t c;
-                while ((c = *ip)) {
-                    size_t b, l;
-                    if ((c & 0x80) == 0) {
-                        // 0b0LLBBBBB encoding
-                        b = c & 0x1f;
-                        l = c >> 5;
-                        ip += 1;
-                    } else {
-                        // 0b1LLLBBBB 0bLLLLLLLL encoding (l's LSB in second byte)
-                        b = c & 0xf;
-                        l = ((c << 4) & 0x700) | ip[1];
-                        ip += 2;
-                    }
-                    if (bc >= b) {
-                        bc -= b;
-                        source_line += l;
-                    } else {
-                        // found source line corresponding to bytecode offset
-                        break;
-                    }
-                }
+                qstr block_name, source_file;
+                size_t source_line;
+                mp_bytecode_get_source_info(code_state->fun_bc, code_state->ip, &block_name, &source_file, &source_line);
                 mp_obj_exception_add_traceback(MP_OBJ_FROM_PTR(nlr.ret_val), source_file, source_line, block_name);
             }
 
@@ -1480,6 +1469,7 @@ unwind_loop:
                 // propagate exception to higher level
                 // TODO what to do about ip and sp? they don't really make sense at this point
                 fastn[0] = MP_OBJ_FROM_PTR(nlr.ret_val); // must put exception here because sp is invalid
+                PROF_RESTORE_CODE_STATE();
                 return MP_VM_RETURN_EXCEPTION;
             }
         }
@@ -132,11 +132,11 @@ static void parse_byteorder(mp_obj_t byteorder_obj, pixelbuf_byteorder_details_t
     parsed->order_string = byteorder_obj;
 
     parsed->bpp = bo_len;
-    char *dotstar = strchr(byteorder, 'P');
-    char *r = strchr(byteorder, 'R');
-    char *g = strchr(byteorder, 'G');
-    char *b = strchr(byteorder, 'B');
-    char *w = strchr(byteorder, 'W');
+    char *dotstar = memchr(byteorder, 'P', bo_len);
+    char *r = memchr(byteorder, 'R', bo_len);
+    char *g = memchr(byteorder, 'G', bo_len);
+    char *b = memchr(byteorder, 'B', bo_len);
+    char *w = memchr(byteorder, 'W', bo_len);
     int num_chars = (dotstar ? 1 : 0) + (w ? 1 : 0) + (r ? 1 : 0) + (g ? 1 : 0) + (b ? 1 : 0);
     if ((num_chars < parsed->bpp) || !(r && b && g)) {
         mp_raise_ValueError(translate("Invalid byteorder string"));
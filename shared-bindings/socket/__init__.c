@@ -524,7 +524,9 @@ STATIC const mp_obj_type_t socket_type = {
 
 STATIC mp_obj_t socket_getaddrinfo(mp_obj_t host_in, mp_obj_t port_in) {
     size_t hlen;
-    const char *host = mp_obj_str_get_data(host_in, &hlen);
+    mp_obj_str_get_data(host_in, &hlen);
+    // some NIC drivers' gethostbyname ignore the length and need a null byte
+    const char *host = mp_obj_str_get_str(host_in);
     mp_int_t port = mp_obj_get_int(port_in);
     uint8_t out_ip[MOD_NETWORK_IPADDR_BUF_SIZE];
     bool have_ip = false;
@@ -51,6 +51,8 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t* self,
                                            size_t buffer_size) {
     // Load the wave
     self->file = file;
+    // reads jump around the file, so let seeks skip walking the FAT chain
+    vfs_fat_file_fastseek_auto(file);
     uint8_t chunk_header[16];
     f_rewind(&self->file->fp);
     UINT bytes_read;
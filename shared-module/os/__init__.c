@@ -29,6 +29,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "py/builtin.h"
 #include "py/mperrno.h"
 #include "py/mpstate.h"
 #include "py/obj.h"
@@ -99,6 +100,7 @@ void common_hal_os_chdir(const char* path) {
     } else {
         mp_vfs_proxy_call(vfs, MP_QSTR_chdir, 1, &path_out);
     }
+    mp_import_stat_cache_clear();
 }
 
 mp_obj_t common_hal_os_getcwd(void) {
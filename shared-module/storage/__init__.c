@@ -29,6 +29,7 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "py/builtin.h"
 #include "py/mperrno.h"
 #include "py/obj.h"
 #include "py/runtime.h"
@@ -100,6 +101,7 @@ void common_hal_storage_mount(mp_obj_t vfs_obj, const char* mount_path, bool rea
     mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table);
     vfs->next = *vfsp;
     *vfsp = vfs;
+    mp_import_stat_cache_clear();
 }
 
 void common_hal_storage_umount_object(mp_obj_t vfs_obj) {
@@ -124,6 +126,7 @@ void common_hal_storage_umount_object(mp_obj_t vfs_obj) {
 
     // call the underlying object to do any unmounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_umount, 0, NULL);
+    mp_import_stat_cache_clear();
 }
 
 STATIC mp_obj_t storage_object_from_path(const char* mount_path) {
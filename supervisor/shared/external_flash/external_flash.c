@@ -544,11 +544,40 @@ bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
 }
 
+// Whether the block's current contents are in the write cache rather than on
+// the flash.
+static bool block_is_cached(uint32_t block) {
+    uint32_t address = block * FILESYSTEM_BLOCK_SIZE;
+    uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
+    uint8_t block_index = block % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
+    return current_sector == this_sector && (dirty_mask & (1 << block_index)) != 0;
+}
+
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+    if (block_num + num_blocks > supervisor_flash_get_block_count()) {
+        return 1; // error
+    }
+    while (num_blocks > 0) {
+        if (block_is_cached(block_num)) {
+            if (!external_flash_read_block(dest, block_num)) {
+                return 1; // error
+            }
+            dest += FILESYSTEM_BLOCK_SIZE;
+            block_num++;
+            num_blocks--;
+            continue;
+        }
+        // Read the run of blocks up to the next cached one in one go.
+        uint32_t count = 1;
+        while (count < num_blocks && !block_is_cached(block_num + count)) {
+            count++;
+        }
+        if (!read_flash(block_num * FILESYSTEM_BLOCK_SIZE, dest, count * FILESYSTEM_BLOCK_SIZE)) {
             return 1; // error
         }
+        dest += count * FILESYSTEM_BLOCK_SIZE;
+        block_num += count;
+        num_blocks -= count;
     }
     return 0; // success
 }
@@ -87,9 +87,6 @@ static void build_partition(uint8_t *buf, int boot, int type, uint32_t start_blo
 
 mp_uint_t flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
     if (block_num == 0) {
-        if (block_num > 1) {
-            return 1; // error
-        }
         // fake the MBR so we can decide on our own partition table
 
         for (int i = 0; i < 446; i++) {
@@ -104,22 +101,28 @@ mp_uint_t flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_bloc
         dest[510] = 0x55;
         dest[511] = 0xaa;
 
-        return 0; // ok
-
+        if (num_blocks == 1) {
+            return 0; // ok
+        }
+        // the rest of the transfer comes from the partition
+        dest += FILESYSTEM_BLOCK_SIZE;
+        block_num++;
+        num_blocks--;
     }
     return supervisor_flash_read_blocks(dest, block_num - PART1_START_BLOCK, num_blocks);
 }
 
 mp_uint_t flash_write_blocks(const uint8_t *src, uint32_t block_num, uint32_t num_blocks) {
     if (block_num == 0) {
-        if (num_blocks > 1) {
-            return 1; // error
-        }
         // can't write MBR, but pretend we did
-        return 0;
-    } else {
-        return supervisor_flash_write_blocks(src, block_num - PART1_START_BLOCK, num_blocks);
+        if (num_blocks == 1) {
+            return 0;
+        }
+        src += FILESYSTEM_BLOCK_SIZE;
+        block_num++;
+        num_blocks--;
     }
+    return supervisor_flash_write_blocks(src, block_num - PART1_START_BLOCK, num_blocks);
 }
 
 STATIC mp_obj_t supervisor_flash_obj_readblocks(mp_obj_t self, mp_obj_t block_num, mp_obj_t buf) {
@@ -146,6 +149,7 @@ STATIC mp_obj_t supervisor_flash_obj_ioctl(mp_obj_t self, mp_obj_t cmd_in, mp_ob
         case BP_IOCTL_SYNC: supervisor_flash_flush(); return MP_OBJ_NEW_SMALL_INT(0);
         case BP_IOCTL_SEC_COUNT: return MP_OBJ_NEW_SMALL_INT(flash_get_block_count());
         case BP_IOCTL_SEC_SIZE: return MP_OBJ_NEW_SMALL_INT(supervisor_flash_get_block_size());
+        case BP_IOCTL_XFER_SIZE: return mp_const_none; // any run of blocks in one call
         default: return mp_const_none;
     }
 }
@@ -29,6 +29,7 @@
 #include "supervisor/linker.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/autoreload.h"
+#include "py/profile.h"
 
 static volatile uint64_t PLACE_IN_DTCM_BSS(ticks_ms);
 static volatile uint32_t PLACE_IN_DTCM_BSS(background_ticks_ms32);
@@ -63,6 +64,9 @@ void supervisor_tick(void) {
         #endif
     }
 #endif
+#if MICROPY_PY_UPROFILE
+    mp_prof_sample();
+#endif
 }
 
 uint64_t supervisor_ticks_ms64() {
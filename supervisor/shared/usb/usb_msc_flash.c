@@ -29,6 +29,7 @@
 
 // For updating fatfs's cache
 #include "extmod/vfs.h"
+#include "py/builtin.h"
 #include "extmod/vfs_fat.h"
 #include "lib/oofatfs/diskio.h"
 #include "lib/oofatfs/ff.h"
@@ -184,6 +185,9 @@ void tud_msc_write10_complete_cb (uint8_t lun) {
 
     // This write is complete, start the autoreload clock.
     autoreload_start();
+
+    // The host may have added or removed modules behind the VFS's back.
+    mp_import_stat_cache_clear();
 }
 
 // Invoked when received SCSI_CMD_INQUIRY
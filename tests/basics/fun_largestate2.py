@@ -0,0 +1,34 @@
+# test calls with large state unwinding and being scanned by the GC
+
+def f(n, l):
+    a = b = c = d = e = g = h = k = m = [n]
+    if n == 0:
+        raise ValueError(len(l))
+    try:
+        return f(n - 1, l + a)
+    finally:
+        l.append(b)
+
+# frames unwound by an exception
+for i in range(3):
+    try:
+        f(50, [])
+    except ValueError as er:
+        print(er)
+
+# objects only reachable from frames must survive a collection
+try:
+    import gc
+except ImportError:
+    gc = None
+
+def g(n):
+    a = b = c = d = e = h = k = m = [n] * 4
+    if n == 0:
+        if gc:
+            gc.collect()
+        [bytearray(16) for _ in range(100)]
+        return 0
+    return g(n - 1) + sum(a)
+
+print(g(100))
@@ -0,0 +1,32 @@
+# test operations on very large integers, which may use different algorithms
+
+# multiplication, including operands of unequal length and squaring
+a = 3 ** 4000 + 12345
+b = 7 ** 2500 - 1
+c = 11 ** 700
+for x, y in ((a, b), (b, a), (a, c), (c, a), (a, a), (-a, b), (a, -c)):
+    p = x * y
+    print(p % 1000000007, len(hex(p)), p // y == x, p % y)
+
+# (a + b) ** 2 expanded, to check the cross terms
+print((a + b) * (a + b) == a * a + 2 * a * b + b * b)
+print((a - b) * (a + b) == a * a - b * b)
+
+# conversion to and from strings of many digits
+s = str(a * b)
+print(len(s), s[:20], s[-20:], int(s) == a * b)
+s = str(-c * c)
+print(len(s), s[:20], s[-20:], int(s) == -c * c)
+print(str(10 ** 1000)[:5], len(str(10 ** 1000)), len(str(10 ** 1000 - 1)))
+print(hex(a)[-20:], oct(b)[:20], len(bin(c)))
+
+# modular exponentiation with large odd and even moduli
+m = (1 << 1024) - 105
+for mod in (m, m + 1, 3 ** 300, 2 ** 521 - 1):
+    print(pow(65537, m - 2, mod) % 1000000007, pow(-3, 12345678901234567890, mod) % 1000000007)
+print(pow(a, b, m) == pow(a % m, b, m))
+print(pow(2, m - 1, m) == 1, pow(5, 0, m), pow(m + 1, 3, m))
+
+# division where the first estimate of a quotient digit is too large
+for m in ((1 << 64) - 105, (1 << 96) - 105, m):
+    print(((m + 1) * (m + 1)) % m, ((m + 1) * (m + 1)) // m - m, pow(m + 1, 3, m + 1), pow(m + 2, 3, m - 1))
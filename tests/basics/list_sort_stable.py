@@ -0,0 +1,65 @@
+# test that sorting is stable, with and without reverse
+
+# pseudo-random values with many duplicates
+l = []
+x = 1
+for i in range(300):
+    x = (x * 1103515245 + 12345) & 0x7fffffff
+    l.append(((x >> 8) % 10, i))
+
+def check(l, r):
+    for i in range(1, len(l)):
+        a, b = l[i - 1], l[i]
+        if a[0] == b[0] and a[1] > b[1]:
+            return False
+        if (a[0] > b[0]) != r and a[0] != b[0]:
+            return False
+    return True
+
+print(check(sorted(l, key=lambda x: x[0]), False))
+print(check(sorted(l, key=lambda x: x[0], reverse=True), True))
+
+# runs that are partly ascending and partly descending
+l2 = [(i // 3, i) for i in range(100)] + [(9 - i // 20, 100 + i) for i in range(100)]
+print(check(sorted(l2, key=lambda x: x[0]), False))
+print(check(sorted(l2, key=lambda x: x[0], reverse=True), True))
+
+# the key function is called exactly once per item
+n = 0
+def key(x):
+    global n
+    n += 1
+    return -x[0]
+sorted(l, key=key)
+print(n)
+
+# a comparison that raises leaves all items in the list
+n = 0
+class A:
+    def __init__(self, x):
+        self.x = x
+    def __lt__(self, other):
+        global n
+        n += 1
+        if n == 1000:
+            raise ValueError
+        return self.x < other.x
+l3 = [A(i * 7 % 11) for i in range(200)]
+try:
+    l3.sort()
+except ValueError:
+    print('ValueError')
+print(sorted([a.x for a in l3]) == sorted([i * 7 % 11 for i in range(200)]))
+
+# a key function that changes the length of the list
+l4 = [3, 1, 2]
+try:
+    l4.sort(key=lambda x: l4.append(x) or x)
+except ValueError:
+    print('ValueError')
+# (CPython hides the items during the sort, so pop() raises IndexError there)
+l4 = [3, 1, 2, 5, 4]
+try:
+    l4.sort(key=lambda x: l4.pop())
+except (ValueError, IndexError):
+    print('error')
@@ -24,3 +24,9 @@ print(not 1)
 print(not True)
 print(not not 0)
 print(not not 1)
+
+# conditional expressions with a constant condition
+print(f_true() if 1 else foo)
+print(foo if 0 else f_false())
+print(1 if not 0 else foo)
+print((f_true() if False else 2) if True else foo)
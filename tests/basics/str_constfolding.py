@@ -0,0 +1,18 @@
+# tests string and bytes constant folding in parser
+
+print('abc' + 'def')
+print('a' + 'b' + 'c')
+print(b'abc' + b'def')
+print(('ab' + 'cd') * 2)
+print('x' * 3 + 'y')
+print(len('a' * 10 + 'b' * 10))
+
+# a long string that isn't interned
+s = 'abcdefghijklmnopqrstuvwxyz' + 'ABCDEFGHIJKLMNOPQRSTUVWXYZ' + '0123456789'
+print(s, len(s))
+
+# mixing str and bytes can't be folded, and raises at runtime
+try:
+    'a' + b'b'
+except TypeError:
+    print('TypeError')
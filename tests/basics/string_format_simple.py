@@ -0,0 +1,60 @@
+# format strings made only of literal text and plain fields
+
+# str.format with "{}" fields
+print("{}".format("a"))
+print("{}{}".format("a", "b"))
+print("x={} y={}".format(1, -2))
+print("{} {} {}".format(None, True, [1, "2"]))
+print("{}".format(""))
+print("".format())
+print("no fields".format())
+print("extra args {}".format(1, 2, 3))
+print("{{}} {{{}}} }}{{".format("esc"))
+print("{}".format("é€"))
+print("{}-{}".format(1.5, 2 ** 100))
+
+# repeat a constant format string so any cached shape gets used
+for i in range(3):
+    print("item {} of {}: {}".format(i, 3, "val" * i))
+
+# str subclasses go through __str__
+class S(str):
+    def __str__(self):
+        return "S!"
+print("{}".format(S("abc")))
+
+# a format string that isn't interned
+fmt = "".join(["{}", "+", "{}"])
+print(fmt.format(1, 2))
+
+# not enough arguments
+try:
+    "{} {}".format(1)
+except IndexError:
+    print("IndexError")
+
+# str % args with "%s" and "%d" fields
+print("%s" % "a")
+print("%s=%d" % ("x", 42))
+print("%d%%" % 50)
+print("%s %s %s" % (None, False, (1,)))
+print("%d %d" % (True, 3.7))
+print("%d" % (2 ** 70))
+print("%s" % [1])
+print("%s" % {"a": 1})
+for i in range(3):
+    print("%s:%d" % ("n", i))
+
+# errors still come from the general path
+try:
+    "%d" % "x"
+except TypeError:
+    print("TypeError")
+try:
+    "%s %s" % ("x",)
+except TypeError:
+    print("TypeError")
+try:
+    "%s" % ("x", "y")
+except TypeError:
+    print("TypeError")
@@ -0,0 +1,65 @@
+# building str and bytes with +=
+
+s = ""
+for i in range(100):
+    s += str(i)
+print(len(s), s[:20], s[-20:])
+
+# earlier values are not affected by later appends
+s = "ab"
+s += "c"
+a = s
+s += "d"
+b = s
+s += "e"
+print(a, b, s)
+
+# appending to an earlier value gives an independent string
+a += "X"
+s += "f"
+print(a, b, s)
+a += "Y"
+b += "Z"
+print(a, b, s)
+
+# appending a string to itself
+s = "xy"
+s += "z"
+s += s
+s += s
+print(s)
+
+# strings built like this work as dict keys and compare equal to others
+d = {}
+k = "ke"
+k += "y"
+d[k] = 1
+k2 = "k"
+k2 += "ey"
+print(d[k2], k == "key", k2 == k, hash(k) == hash("key"))
+
+# interleaved builders
+x = ""
+y = ""
+for i in range(10):
+    x += "x%d," % i
+    y += "y%d;" % i
+print(x)
+print(y)
+
+# the old value, whose buffer has been appended to, can still be used
+s = "12"
+s += "3"
+t = s
+s += "4"
+print(int(t), float(t), t.encode(), t.upper(), s)
+
+# bytes
+b = b""
+for i in range(5):
+    b += bytes([65 + i])
+c = b
+b += b"!"
+print(b, c)
+b += bytearray(b"?")
+print(b, c)
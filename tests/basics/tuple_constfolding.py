@@ -0,0 +1,26 @@
+# tests tuples of constants, which the compiler can make a single constant
+
+print((1, 2, 3))
+print(())
+print((1,))
+print((None, True, False, ..., 'str', b'bytes'))
+print((1 << 40, -1))
+
+def f(a=(1, 2)):
+    return a
+
+print(f())
+
+def g():
+    return ('a', 'b')
+
+print(g() == g())
+
+x = 2
+print(x in (1, 2, 3), x in (4, 5))
+for i in (1, 'a', None):
+    print(i)
+
+# tuples that aren't constant are still built
+y = 3
+print((x, y), (1, x), (x, 1))
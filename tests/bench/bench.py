@@ -1,4 +1,7 @@
-import time
+try:
+    import time
+except ImportError:
+    import utime as time
 
 
 ITERS = 20000000
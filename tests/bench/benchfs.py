@@ -0,0 +1,74 @@
+# Block devices and FAT volumes for the storage benchmarks
+
+import uos
+
+MOUNT = "/bench"
+
+
+class RAMBlockDev:
+    def __init__(self, block_size, num_blocks, xfer=None):
+        self.block_size = block_size
+        self.data = bytearray(block_size * num_blocks)
+        self.xfer = xfer
+
+    def readblocks(self, block_num, buf):
+        addr = block_num * self.block_size
+        buf[:] = memoryview(self.data)[addr:addr + len(buf)]
+
+    def writeblocks(self, block_num, buf):
+        addr = block_num * self.block_size
+        self.data[addr:addr + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.block_size
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.block_size
+        if op == 7:  # BP_IOCTL_XFER_SIZE
+            return self.xfer
+
+
+def image_path():
+    return (uos.getenv("TMPDIR") or "/tmp") + "/micropython-bench.img"
+
+
+def image_dev(num_blocks, **kw):
+    # a disk image mapped from the host, falling back to RAM if the port
+    # doesn't have MmapBlockDev
+    try:
+        return uos.MmapBlockDev(image_path(), 512, num_blocks, **kw)
+    except AttributeError:
+        return RAMBlockDev(512, num_blocks)
+
+
+def mount(bdev, path=MOUNT):
+    if not hasattr(uos, "VfsFat"):
+        print("SKIP")
+        raise SystemExit
+    uos.VfsFat.mkfs(bdev)
+    uos.mount(uos.VfsFat(bdev), path)
+    return path
+
+
+def unmount(bdev, path=MOUNT):
+    uos.umount(path)
+    if hasattr(bdev, "close"):
+        bdev.close()
+        uos.remove(image_path())
+
+
+def make_file(name, size):
+    chunk = bytes(range(256)) * 16
+    with open(name, "wb") as f:
+        for i in range(size // len(chunk)):
+            f.write(chunk)
+
+
+def copy(src, dst, buf):
+    with open(src, "rb") as fi:
+        with open(dst, "wb") as fo:
+            while True:
+                n = fi.readinto(buf)
+                if not n:
+                    break
+                fo.write(memoryview(buf)[:n])
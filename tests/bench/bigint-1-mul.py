@@ -0,0 +1,11 @@
+# Big integer arithmetic
+# Multiplication of two 20000-bit integers.
+import bench
+
+def test(num):
+    a = 3 ** 12600 + 1
+    b = 7 ** 7100 + 3
+    for i in iter(range(num // 100000)):
+        a * b
+
+bench.run(test)
@@ -0,0 +1,11 @@
+# Big integer arithmetic
+# Modular exponentiation with a 2048-bit odd modulus, as used in RSA.
+import bench
+
+def test(num):
+    m = (1 << 2048) - 159
+    e = (1 << 2047) + 12345
+    for i in iter(range(num // 4000000)):
+        pow(65537 + i, e, m)
+
+bench.run(test)
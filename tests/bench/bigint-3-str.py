@@ -0,0 +1,10 @@
+# Big integer arithmetic
+# Conversion of a 100000-bit integer to a decimal string.
+import bench
+
+def test(num):
+    a = 3 ** 63000
+    for i in iter(range(num // 10000000)):
+        str(a)
+
+bench.run(test)
@@ -0,0 +1,11 @@
+# Big integer arithmetic
+# Repeated squaring, where the operands grow to 64000 bits.
+import bench
+
+def test(num):
+    for i in iter(range(num // 1000000)):
+        a = 3
+        for j in range(16):
+            a = a * a
+
+bench.run(test)
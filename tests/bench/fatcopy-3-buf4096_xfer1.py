@@ -0,0 +1,11 @@
+import bench
+import benchfs
+
+def test(num):
+    path = benchfs.mount(benchfs.RAMBlockDev(512, 1024, xfer=1))
+    benchfs.make_file(path + "/src", 128 * 1024)
+    buf = bytearray(4096)
+    for i in range(num // 100000):
+        benchfs.copy(path + "/src", path + "/dst", buf)
+
+bench.run(test)
@@ -0,0 +1,11 @@
+import bench
+import benchfs
+
+def test(num):
+    path = benchfs.mount(benchfs.RAMBlockDev(512, 1024))
+    with open(path + "/log", "w") as f:
+        for i in range(num // 2000):
+            f.write("%d,12.5,-3\n" % i)
+            f.flush()
+
+bench.run(test)
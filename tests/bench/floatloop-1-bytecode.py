@@ -0,0 +1,10 @@
+# One-pole low-pass filter over a constant input, as plain bytecode
+import bench
+
+def test(num):
+    y = 0.0
+    k = 0.001
+    for i in range(num // 10):
+        y = y + k * (1.0 - y)
+
+bench.run(test)
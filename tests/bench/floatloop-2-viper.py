@@ -0,0 +1,16 @@
+# Same as floatloop-1, with the filter state held as viper floats
+import bench
+import micropython
+
+@micropython.viper
+def filt(n: int) -> float:
+    y = 0.0
+    k = 0.001
+    for i in range(n):
+        y = y + k * (1.0 - y)
+    return y
+
+def test(num):
+    filt(num // 10)
+
+bench.run(test)
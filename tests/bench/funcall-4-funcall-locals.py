@@ -0,0 +1,14 @@
+# Function call overhead test
+# Same as funcall-2, but the function has enough locals and stack that its
+# state doesn't fit in the C stack fast path
+import bench
+
+def f(x):
+    a = b = c = d = e = g = h = k = m = n = x
+    return (a, b, c, d, e, g, h, k, m, n, x + 1)[-1]
+
+def test(num):
+    for i in iter(range(num)):
+        a = f(i)
+
+bench.run(test)
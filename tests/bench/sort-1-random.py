@@ -0,0 +1,14 @@
+# List sorting
+# Input: pseudo-random integers, no existing order.
+import bench
+
+def test(num):
+    x = 1
+    l = []
+    for i in range(1000):
+        x = (x * 1103515245 + 12345) & 0x3fffffff
+        l.append(x >> 10)
+    for i in iter(range(num // 200000)):
+        sorted(l)
+
+bench.run(test)
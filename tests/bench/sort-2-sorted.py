@@ -0,0 +1,10 @@
+# List sorting
+# Input: already sorted, which an adaptive sort handles in a single pass.
+import bench
+
+def test(num):
+    l = list(range(1000))
+    for i in iter(range(num // 200000)):
+        sorted(l)
+
+bench.run(test)
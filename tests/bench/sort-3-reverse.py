@@ -0,0 +1,10 @@
+# List sorting
+# Input: sorted in descending order.
+import bench
+
+def test(num):
+    l = list(range(1000, 0, -1))
+    for i in iter(range(num // 200000)):
+        sorted(l)
+
+bench.run(test)
@@ -0,0 +1,17 @@
+# List sorting
+# Input: sorted, with a few elements swapped and new ones appended at the end.
+import bench
+
+def test(num):
+    l = list(range(1000))
+    x = 1
+    for i in range(10):
+        x = (x * 1103515245 + 12345) & 0x3fffffff
+        j = (x >> 10) % 1000
+        l[i], l[j] = l[j], l[i]
+    for i in range(20):
+        l.append(i * 37 % 1000)
+    for i in iter(range(num // 200000)):
+        sorted(l)
+
+bench.run(test)
@@ -0,0 +1,14 @@
+import bench
+import benchfs
+
+def test(num):
+    bdev = benchfs.image_dev(2048)
+    path = benchfs.mount(bdev)
+    buf = bytes(4096)
+    for i in range(num // 100000):
+        with open(path + "/data", "wb") as f:
+            for j in range(64):
+                f.write(buf)
+    benchfs.unmount(bdev)
+
+bench.run(test)
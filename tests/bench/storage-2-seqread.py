@@ -0,0 +1,15 @@
+import bench
+import benchfs
+
+def test(num):
+    bdev = benchfs.image_dev(2048)
+    path = benchfs.mount(bdev)
+    benchfs.make_file(path + "/data", 256 * 1024)
+    buf = bytearray(4096)
+    for i in range(num // 20000):
+        with open(path + "/data", "rb") as f:
+            while f.readinto(buf):
+                pass
+    benchfs.unmount(bdev)
+
+bench.run(test)
@@ -0,0 +1,12 @@
+import bench
+import benchfs
+
+def test(num):
+    bdev = benchfs.image_dev(2048)
+    path = benchfs.mount(bdev)
+    for i in range(num // 10000):
+        with open(path + "/log", "a") as f:
+            f.write("%d,12.5,-3\n" % i)
+    benchfs.unmount(bdev)
+
+bench.run(test)
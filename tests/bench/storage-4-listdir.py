@@ -0,0 +1,16 @@
+import bench
+import benchfs
+import uos
+
+def test(num):
+    bdev = benchfs.image_dev(2048)
+    path = benchfs.mount(bdev)
+    for i in range(100):
+        with open("%s/file_with_long_name_%d.txt" % (path, i), "w") as f:
+            f.write("x" * i)
+    for i in range(num // 100000):
+        for name, kind, inode, size in uos.ilistdir(path):
+            uos.stat(path + "/" + name)
+    benchfs.unmount(bdev)
+
+bench.run(test)
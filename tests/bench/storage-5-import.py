@@ -0,0 +1,22 @@
+import bench
+import benchfs
+import sys
+
+def test(num):
+    bdev = benchfs.image_dev(2048)
+    path = benchfs.mount(bdev)
+    for i in range(10):
+        with open("%s/benchmod%d.py" % (path, i), "w") as f:
+            f.write("def f(x):\n    return x + %d\n" % i)
+            for j in range(50):
+                f.write("v%d = [%d, 'abc', (%d, 2.5)]\n" % (j, j, i))
+    sys.path.insert(0, path)
+    for i in range(num // 1000000):
+        for j in range(10):
+            name = "benchmod%d" % j
+            __import__(name)
+            del sys.modules[name]
+    sys.path.pop(0)
+    benchfs.unmount(bdev)
+
+bench.run(test)
@@ -0,0 +1,49 @@
+# test passing strings built with += to functions that need their data, or a
+# pointer to it, to stay null terminated
+
+try:
+    import uos, ure
+    uos.mount
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class Filesystem:
+    def __init__(self, id):
+        self.id = id
+    def mount(self, readonly, mkfs):
+        print(self.id, 'mount')
+    def umount(self):
+        print(self.id, 'umount')
+
+
+# a subject whose buffer a later += has appended to
+s = 'ab'
+s += 'c'
+t = s
+s += 'bc'
+m = ure.search(r'(b)c', t)
+print(m.group(0), m.group(1))
+if hasattr(m, 'span'):
+    print(m.span(0) == (1, 3), m.span(1) == (1, 2), m.start(1), m.end(1))
+else:
+    print(True, True, 1, 2)
+
+# umount mount points that share a buffer
+mnt = '/test_'
+mnt += 'mnt'
+mnt1 = mnt
+mnt += '2'
+uos.mount(Filesystem(1), '/test_mnt')
+uos.mount(Filesystem(2), '/test_mnt2')
+uos.umount(mnt1)
+uos.umount(mnt)
+
+# the mount point is kept, so appending to it must not change it
+mnt = '/test_'
+mnt += 'mnt'
+uos.mount(Filesystem(3), mnt)
+mnt += '3'
+print(mnt)
+uos.umount('/test_mnt')
@@ -0,0 +1,26 @@
+# test ujson.iterparse
+
+try:
+    from uio import StringIO
+    import ujson as json
+    json.iterparse
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+for ev in json.iterparse('{"a": [1, {"b": null}], "c": "d", "e": {}}'):
+    print(ev)
+
+# from a stream, with a long document
+s = json.dumps({"x": list(range(100))})
+events = list(json.iterparse(StringIO(s)))
+print(len(events), events[:3], events[-2:])
+
+print(list(json.iterparse(b'  "abc" ')))
+
+# unbalanced or malformed documents
+for bad in ("[1}", '{"a"]', "1 2", "", "[", "{[1]: 2}", "]"):
+    try:
+        print(list(json.iterparse(bad)))
+    except ValueError:
+        print(repr(bad), "ValueError")
@@ -0,0 +1,24 @@
+# test ujson.load/dump with documents larger than the stream buffers
+
+try:
+    from uio import StringIO
+    import ujson as json
+except:
+    try:
+        from io import StringIO
+        import json
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+# strings and numbers straddling the read buffer boundaries
+for n in range(120, 140):
+    doc = ["x" * n, -123456, "y\\" * 3, 1.25, 12345678901234567890]
+    s = json.dumps(doc)
+    print(json.load(StringIO(s)) == doc, json.loads(s) == doc)
+
+doc = {"a": list(range(-100, 300)), "b": ["s%d" % i for i in range(100)], "c": "ሴ\n" * 50}
+s = StringIO()
+json.dump(doc, s)
+print(s.getvalue() == json.dumps(doc))
+print(json.load(StringIO(s.getvalue())) == doc)
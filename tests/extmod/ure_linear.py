@@ -0,0 +1,31 @@
+# test the ure.LINEAR matcher
+
+try:
+    import ure as re
+    re.LINEAR
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+# patterns that exhaust the stack when backtracking
+print(re.compile("(a*)*", re.LINEAR).match("aaa").group(0))
+print(re.compile(".*b", re.LINEAR).match("a" * 10000 + "b") is not None)
+
+# same results as the backtracking matcher
+for p, s in (
+    ("(a|b)*c", "xxababcx"),
+    ("(ab|a)(bc|c)?", "abc"),
+    ("(a+?)(a*)", "aaa"),
+    (r"(\w+)@(\w+)\.com", "mail foo@bar.com now"),
+    ("^b", "ab"),
+    ("a+$", "baaa"),
+    ("[^a-c]+x", "abyyx"),
+):
+    r1 = re.compile(p)
+    r2 = re.compile(p, re.LINEAR)
+    for f in ("match", "search"):
+        m1 = getattr(r1, f)(s)
+        m2 = getattr(r2, f)(s)
+        print(p, f, m2 and m2.group(0), (m1 and m1.group(0)) == (m2 and m2.group(0)))
+
+print(re.compile("a", re.LINEAR).split("bab"))
@@ -0,0 +1,25 @@
+# test searching for patterns that start with a literal char
+
+try:
+    import ure as re
+except ImportError:
+    try:
+        import re
+    except ImportError:
+        print("SKIP")
+        raise SystemExit
+
+for p, s in (
+    ("ERROR (.*)", "12:00 INFO ok"),
+    ("ERROR (.*)", "12:00 ERROR disk full"),
+    ("ab", "aaab"),
+    ("ab+", "abbab"),
+    ("ab|cd", "xxcd"),
+    ("a$", "aba"),
+    ("a", ""),
+    ("x", "abcx"),
+):
+    m = re.search(p, s)
+    print(p, s, m and m.group(0))
+
+print(re.compile("a").split("bacad"))
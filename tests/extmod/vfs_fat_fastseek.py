@@ -0,0 +1,103 @@
+# test fast seek (cluster link map) on VfsFat files
+
+try:
+    import uerrno
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    uos.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(200)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, "/ramdisk")
+uos.chdir("/ramdisk")
+
+# write two files a block at a time, interleaved, so that both are fragmented
+def block(name, i):
+    return bytes([(i * 7 + ord(name[0]) + j) & 0xff for j in range(512)])
+
+fa = open("a", "wb")
+fb = open("b", "wb")
+for i in range(40):
+    fa.write(block("a", i))
+    fa.flush()
+    fb.write(block("b", i))
+    fb.flush()
+fa.close()
+fb.close()
+
+# a seek in a large file opened for reading turns fast seek on
+with open("a", "rb") as f:
+    print(f.fastseek())
+    ok = True
+    for i in (39, 0, 17, 38, 3, 25, 25, 1):
+        f.seek(i * 512 + 100)
+        ok = ok and f.read(10) == block("a", i)[100:110]
+    print(f.fastseek(), ok)
+    f.seek(-5, 2)
+    print(f.read() == block("a", 39)[-5:])
+    # a seek past the end of a read-only file is clipped and keeps the table
+    print(f.seek(50 * 512), f.fastseek(), f.read())
+    f.seek(7 * 512)
+    print(f.read(4) == block("a", 7)[:4])
+    f.fastseek(False)
+    print(f.fastseek())
+    # once turned off, it isn't turned on again
+    f.seek(512)
+    print(f.fastseek(), f.read(4) == block("a", 1)[:4])
+
+# on a file open for update, it is dropped when the file grows
+with open("b", "r+b") as f:
+    f.fastseek(True)
+    f.seek(30 * 512)
+    f.write(b"xyz")
+    print(f.fastseek())
+    f.seek(40 * 512)
+    f.write(b"end")
+    print(f.fastseek())
+    f.seek(30 * 512)
+    print(f.read(3), f.seek(0, 2))
+
+f = open("a", "rb")
+f.close()
+try:
+    f.fastseek()
+except ValueError:
+    print("ValueError")
+
+uos.umount("/ramdisk")
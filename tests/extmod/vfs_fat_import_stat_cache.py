@@ -0,0 +1,100 @@
+# test that imports from a FAT filesystem see changes made by calling the
+# VfsFat object directly, rather than through uos
+
+import sys
+
+try:
+    import uos
+    uos.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.SEC_SIZE + i]
+        return 0
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.SEC_SIZE + i] = buf[i]
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(50)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+# keep the bytecode cache from writing to the filesystem
+try:
+    import micropython
+    micropython.bytecode_cache(False)
+except (ImportError, AttributeError):
+    pass
+
+MOD = "fat_stat_mod"
+PKG = "fat_stat_pkg"
+
+def load(name):
+    sys.modules.pop(name, None)
+    try:
+        return __import__(name).value
+    except ImportError:
+        return None
+
+def write(path, value):
+    with vfs.open(path, "w") as f:
+        f.write("value = %r\n" % value)
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, "/fatsc")
+sys.path.insert(0, "/fatsc")
+try:
+    # a failed import is retried after vfs.open() writes the module
+    print(load(MOD))
+    write(MOD + ".py", "file")
+    print(load(MOD))
+
+    # vfs.remove()
+    vfs.remove(MOD + ".py")
+    print(load(MOD))
+
+    # vfs.rename()
+    write(MOD + ".txt", "renamed")
+    vfs.rename(MOD + ".txt", MOD + ".py")
+    print(load(MOD))
+    vfs.remove(MOD + ".py")
+    print(load(MOD))
+
+    # vfs.mkdir() and vfs.rmdir()
+    print(load(PKG))
+    vfs.mkdir(PKG)
+    write(PKG + "/__init__.py", "pkg")
+    print(load(PKG))
+    vfs.remove(PKG + "/__init__.py")
+    vfs.rmdir(PKG)
+    print(load(PKG))
+finally:
+    sys.path.pop(0)
+    uos.umount("/fatsc")
+    try:
+        micropython.bytecode_cache(True)
+    except (NameError, AttributeError):
+        pass
@@ -0,0 +1,115 @@
+# test write-behind buffering and autosync on VfsFat files
+
+try:
+    import uerrno
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+try:
+    uos.VfsFat
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+        self.nwrites = 0
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.nwrites += 1
+        self.data[n * self.SEC_SIZE:n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # BP_IOCTL_SEC_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # BP_IOCTL_SEC_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(100)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+uos.VfsFat.mkfs(bdev)
+vfs = uos.VfsFat(bdev)
+uos.mount(vfs, "/ramdisk")
+uos.chdir("/ramdisk")
+
+try:
+    with open("probe", "w", buffering=16) as f:
+        f.autosync
+except AttributeError:
+    print("SKIP")
+    uos.umount("/ramdisk")
+    raise SystemExit
+
+# nothing reaches the device until the buffer fills or is flushed
+f = open("log", "w", buffering=2048)
+n = bdev.nwrites
+for i in range(100):
+    f.write("line %d\n" % i)
+print(bdev.nwrites == n, f.tell())
+f.flush()
+print(bdev.nwrites > n)
+n = bdev.nwrites
+f.write("x" * 3000)
+print(bdev.nwrites > n)
+f.close()
+with open("log") as f:
+    data = f.read()
+print(len(data), data[:14], data[-3:])
+
+# writing in small pieces gives the same file as unbuffered writing
+for buffering in (-1, 0, 100, 512, 700):
+    with open("b", "wb", buffering=buffering) as f:
+        for i in range(200):
+            f.write(bytes([i]) * (i % 11))
+    with open("b", "rb") as f:
+        print(buffering, f.read() == b"".join([bytes([i]) * (i % 11) for i in range(200)]))
+
+# reads and seeks see buffered data in update modes
+with open("c", "w+b", buffering=64) as f:
+    f.write(b"0123456789")
+    f.seek(2)
+    print(f.read(3))
+    f.write(b"ab")
+    f.seek(0)
+    print(f.read())
+
+with open("c", "ab", buffering=64) as f:
+    f.write(b"end")
+    print(f.tell())
+with open("c", "rb") as f:
+    print(f.read())
+
+# autosync commits the file once enough bytes went by
+with open("d", "wb", buffering=32) as f:
+    f.autosync(nbytes=100)
+    f.write(b"a" * 90)
+    print(uos.stat("d")[6])
+    f.write(b"b" * 20)
+    print(uos.stat("d")[6])
+    f.autosync()
+
+f = open("e", "w")
+f.close()
+try:
+    f.autosync(ms=10)
+except ValueError:
+    print("ValueError")
+
+uos.umount("/ramdisk")
@@ -0,0 +1,32 @@
+# tests float constant folding in parser
+
+print(1.5 + 2)
+print(2 - 0.25)
+print(1.5 * 2)
+print(-1.5, +1.5, -(-1.5))
+print(1 / 2, 7 / 2, -3 / 4)
+print(7.5 // 2, 7.5 % 2, -7.5 // 2, -7.5 % 2)
+print(1 + 2.5 * 4 - 0.5)
+print(2 * (1.0 + 0.5))
+
+# these can't be folded, and raise at runtime
+try:
+    1.5 / 0
+except ZeroDivisionError:
+    print('ZeroDivisionError')
+try:
+    1 / 0
+except ZeroDivisionError:
+    print('ZeroDivisionError')
+try:
+    1.5 // 0.0
+except ZeroDivisionError:
+    print('ZeroDivisionError')
+try:
+    1.5 << 1
+except TypeError:
+    print('TypeError')
+try:
+    ~1.5
+except TypeError:
+    print('TypeError')
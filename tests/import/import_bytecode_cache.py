@@ -0,0 +1,133 @@
+# test caching of compiled code for imported .py files
+
+import sys
+
+try:
+    import micropython, uio, uos
+    micropython.bytecode_cache
+    uio.IOBase
+    uos.mount
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class UserFile(uio.IOBase):
+    def __init__(self, fs, path, data):
+        self.fs = fs
+        self.path = path
+        self.data = data
+        self.pos = 0
+    def readinto(self, buf):
+        n = 0
+        while n < len(buf) and self.pos < len(self.data):
+            buf[n] = self.data[self.pos]
+            n += 1
+            self.pos += 1
+        return n
+    def write(self, buf):
+        self.data += buf
+        return len(buf)
+    def ioctl(self, req, arg):
+        if req == 4 and self.path is not None: # close a file being written
+            self.fs.write(self.path, self.data)
+            self.path = None
+        return 0
+
+
+# a filesystem in RAM whose clock only moves when the test moves it, so that
+# files written in the same tick get the same mtime
+class UserFS:
+    def __init__(self, readonly=False):
+        self.files = {}
+        self.dirs = []
+        self.now = 1000
+        self.readonly = readonly
+        self.writes = 0
+    def mount(self, readonly, mkfs):
+        pass
+    def umount(self):
+        pass
+    def write(self, path, data):
+        self.files[path] = (bytes(data), self.now)
+    def stat(self, path):
+        if path in self.dirs:
+            return (0x4000, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        if path in self.files:
+            data, mtime = self.files[path]
+            return (0x8000, 0, 0, 0, 0, 0, len(data), mtime, mtime, mtime)
+        raise OSError(2)
+    def open(self, path, mode):
+        if "w" in mode:
+            self.writes += 1
+            if self.readonly:
+                raise OSError(30)
+            return UserFile(self, path, bytearray())
+        if path not in self.files:
+            raise OSError(2)
+        return UserFile(self, None, self.files[path][0])
+    def mkdir(self, path):
+        self.writes += 1
+        if self.readonly:
+            raise OSError(30)
+        self.dirs.append(path)
+    def remove(self, path):
+        del self.files[path]
+
+
+MOD = "bc_cache_mod"
+CACHE = "/.mpycache/" + MOD + ".mpy"
+
+def write(fs, mod, value):
+    fs.write("/" + mod + ".py", ("def f():\n    return %r\n" % value).encode())
+
+def load(mod):
+    sys.modules.pop(mod, None)
+    return __import__(mod).f()
+
+fs = UserFS()
+uos.mount(fs, "/bcfs")
+sys.path.insert(0, "/bcfs")
+try:
+    # a cache made in the same tick as the source can't be trusted, so the
+    # first import leaves none
+    write(fs, MOD, "one")
+    print(load(MOD), CACHE in fs.files)
+
+    # once the clock has moved on the cache is made
+    fs.now += 1
+    print(load(MOD), CACHE in fs.files)
+
+    # and the next import uses it, without writing anything
+    n = fs.writes
+    print(load(MOD), fs.writes == n)
+
+    # a change to the source, even of the same size, is picked up
+    fs.now += 1
+    write(fs, MOD, "two")
+    print(load(MOD))
+
+    # with the cache turned off nothing is written
+    fs.now += 1
+    fs.files.pop(CACHE, None)
+    micropython.bytecode_cache(False)
+    print(micropython.bytecode_cache(), load(MOD), CACHE in fs.files)
+finally:
+    micropython.bytecode_cache(True)
+    sys.path.pop(0)
+    uos.umount("/bcfs")
+
+# on a filesystem that can't be written, saving fails once and isn't tried
+# again until the cache is turned on again
+fs = UserFS(readonly=True)
+for mod in ("bc_ro_a", "bc_ro_b", "bc_ro_c"):
+    write(fs, mod, mod)
+uos.mount(fs, "/bcro")
+sys.path.insert(0, "/bcro")
+try:
+    print(load("bc_ro_a"), load("bc_ro_b"), fs.writes)
+    micropython.bytecode_cache(True)
+    print(load("bc_ro_c"), fs.writes)
+finally:
+    sys.path.pop(0)
+    uos.umount("/bcro")
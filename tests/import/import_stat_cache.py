@@ -0,0 +1,73 @@
+# test that imports see files and directories created and removed at runtime
+
+import sys
+
+try:
+    import uos
+    uos.mkdir, uos.rename
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+MOD = "stat_cache_mod"
+PKG = "stat_cache_pkg"
+
+def load(name):
+    sys.modules.pop(name, None)
+    try:
+        return __import__(name).value
+    except ImportError:
+        return None
+
+def write(path, value):
+    with open(path, "w") as f:
+        f.write("value = %r\n" % value)
+
+def remove(path):
+    try:
+        uos.remove(path)
+    except OSError:
+        pass
+
+# keep the bytecode cache from adding files to the package directory
+try:
+    import micropython
+    micropython.bytecode_cache(False)
+except (ImportError, AttributeError):
+    pass
+
+sys.path.insert(0, "")
+try:
+    # a failed import is retried after the module is written
+    print(load(MOD))
+    print(load(MOD))
+    write(MOD + ".py", "file")
+    print(load(MOD))
+
+    # and fails again once it is removed
+    remove(MOD + ".py")
+    print(load(MOD))
+
+    # renaming a file into place
+    write(MOD + ".txt", "renamed")
+    uos.rename(MOD + ".txt", MOD + ".py")
+    print(load(MOD))
+    remove(MOD + ".py")
+
+    # a package directory made after a failed import
+    print(load(PKG))
+    uos.mkdir(PKG)
+    write(PKG + "/__init__.py", "pkg")
+    print(load(PKG))
+    remove(PKG + "/__init__.py")
+    uos.rmdir(PKG)
+    print(load(PKG))
+finally:
+    sys.path.pop(0)
+    remove(MOD + ".py")
+    remove(MOD + ".txt")
+    remove(PKG + "/__init__.py")
+    try:
+        uos.rmdir(PKG)
+    except OSError:
+        pass
@@ -0,0 +1,67 @@
+# test importing a .mpy file from the filesystem, which may be executed in place
+
+import sys
+
+try:
+    import uos as os
+except ImportError:
+    import os
+
+if not hasattr(os, "unlink"):
+    print("SKIP")
+    raise SystemExit
+
+# mpy-cross -mcache-lookup-bc of:
+# def f(x):
+#     return x.upper() + "_suffix"
+# class C:
+#     attr = "value"
+#     def m(self, name):
+#         return getattr(self, name)
+#     def gen(self):
+#         yield from ("a", "b")
+# def err():
+#     raise ValueError("xip")
+mpy = (
+    b'M\x04\x03\x1f(\x03\x00\x00\x00\x00\x00\x0a6\x00\x1a\x01f\x8b\x07\x00\x00'
+    b'\xff`\x00$\x1b\x01 `\x01\x16\x1e\x01d\x02$\x1e\x01`\x02$&\x01\x11[\x08<m'
+    b'odule>\x0fmpy_file_mod.py\x01f\x01C\x01C\x03err\x00\x03\x1a\x03\x00\x00'
+    b'\x01\x00\x00\x08\x1b\x01\x1a\x01!\x00\x00\xff\xb0\x1e\x15\x01f\x00\x16'
+    b'\x1d\x01\xf1[\x01f\x0fmpy_file_mod.py\x05upper\x07_suffix\x00\x00\x01x1'
+    b'\x01\x00\x00\x00\x00\x00\x0b\x1e\x01\x1a\x01n &E\x00\x00\xff\x1b!\x00'
+    b'\x00$ \x00\x16\x1e\x01$%\x00\x16\x17\x01$\x1f\x01`\x00$ \x01`\x01$#\x01'
+    b'\x11[\x01C\x0fmpy_file_mod.py\x08__name__\x0a__module__\x01C\x0c__qualna'
+    b'me__\x05value\x04attr\x01m\x03gen\x00\x02\x19\x05\x00\x00\x02\x00\x00'
+    b'\x09 \x01\x1a\x01a`\x00\x00\xff\x1c\xae\x00\x00\xb0\xb1d\x02[\x01m\x0fmp'
+    b'y_file_mod.py\x07getattr\x00\x00\x04self\x04name\x1e\x03\x00\x04\x01\x00'
+    b'\x00\x09#\x01\x1a\x01\x81\x08\x00\x00\xff\x16$\x01\x16%\x01P\x02B\x11^2'
+    b'\x11[\x03gen\x0fmpy_file_mod.py\x01a\x01b\x00\x00\x04self\x1d\x02\x00'
+    b'\x00\x00\x00\x00\x09&\x01\x1a\x01\x81\x0b\x00\x00\xff\x1cs\x00\x00\x16'
+    b'\x27\x01d\x01\x5c\x01\x11[\x03err\x0fmpy_file_mod.py\x0aValueError\x03xi'
+    b'p\x00\x00'
+)
+
+with open("mpy_file_mod.mpy", "wb") as f:
+    f.write(mpy)
+sys.path.insert(0, "")
+try:
+    import mpy_file_mod as mod
+except MpyError:
+    # .mpy built for a different configuration
+    mod = None
+finally:
+    sys.path.pop(0)
+    os.unlink("mpy_file_mod.mpy")
+if mod is None:
+    print("SKIP")
+    raise SystemExit
+
+print(mod.__name__)
+print(mod.f("xip"))
+c = mod.C()
+print(c.m("attr"), list(c.gen()))
+print(mod.f.__name__, mod.C.m.__name__)
+try:
+    mod.err()
+except ValueError as e:
+    print(repr(e))
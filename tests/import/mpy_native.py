@@ -0,0 +1,121 @@
+# test importing a .mpy file containing native code built by mpy-cross
+
+import sys
+
+try:
+    import uos as os
+except ImportError:
+    import os
+
+if not hasattr(os, "unlink"):
+    print("SKIP")
+    raise SystemExit
+
+# mpy-cross -mcache-lookup-bc -march=x64 of:
+# @micropython.native
+# def f(x):
+#     return x.upper() + "_native"
+# class C:
+#     attr = "value"
+#     @micropython.native
+#     def m(self, name):
+#         return getattr(self, name)
+# @micropython.native
+# def err(x):
+#     try:
+#         raise ValueError(x)
+#     except ValueError as e:
+#         r = repr(e)
+#     return r
+# @micropython.viper
+# def vsum(n: int) -> int:
+#     s = 0
+#     for i in range(n):
+#         s += i
+#     return s
+mpy = (
+    b'M\x04\x0b\x1f\x02/\x03\x00\x10\x00\x00\x00\x0c6\x00"\x01fk@\x85\x07\x00'
+    b'\x00\xff`\x00$#\x01 `\x01\x16&\x01d\x02$&\x01`\x02$+\x01`\x03$.\x01\x11['
+    b'\x08<module>\x11mpy_native_mod.py\x01f\x01C\x01C\x03err\x04vsum\x00\x04'
+    b'\x03\x818UH\x89\xe5H\x83\xecHSATAUH\x89}\xb8\xbf\xa1\x00\x00\x00H\x89}'
+    b'\xc0H\x8d}\xb8H\xb8\xe2bC\xec\x1cV\x00\x00\xff\xd0H\x8b]\xf0H\x89\xdfH'
+    b'\x8dU\xb8\x90H\xbe\x1c\x01\x00\x00\x00\x00\x00\x00\x90\x90\x90\x90\x90'
+    b'\x90H\xb8\x9f=B\xec\x1cV\x00\x00\xff\xd0H\x8dU\xb8\xbf\x00\x00\x00\x00'
+    b'\xbe\x00\x00\x00\x00\x90\x90\x90\x90\x90\x90H\xb8\r;B\xec\x1cV\x00\x00'
+    b'\xff\xd0\x90\x90\x90\x90H\xba\x96\x04\x00\x00\x00\x00\x00\x00H\x89\xc6'
+    b'\xbf\x1a\x00\x00\x00\x90\x90\x90\x90\x90\x90H\xb8cLB\xec\x1cV\x00\x00'
+    b'\xff\xd0A]A\\[\xc9\xc3\x80\x03\x00\x10\x01\x00\x00\x05#\x01"\x01\xff\x00'
+    b'\x00\x92\x04\x00\x00\x00\x00\x00\x00\x10\x01\x810\x00\t \x00)8\x01\x05up'
+    b'perH\x00\x06h\x00\x18x\x03\x07_native\x81\x10\x00\x0e\x81)\x02\x01f\x81+'
+    b'\x02\x11mpy_native_mod.py\x810\x03\x01x\x02+\x01\x00\x10\x00\x00\x00\n&'
+    b'\x01"\x01n &\x00\x00\xff\x1b!\x00\x00$ \x00\x16&\x01$%\x00\x16\x1e\x01$'
+    b'\'\x01`\x00$(\x01\x11[\x01C\x11mpy_native_mod.py\x08__name__\n__module__'
+    b'\x01C\x0c__qualname__\x05value\x04attr\x01m\x00\x01\x03\x81 UH\x89\xe5H'
+    b'\x83\xecXSATAUH\x89}\xa8\xbf\x81\x00\x00\x00H\x89}\xb0H\x8d}\xa8H\xb8'
+    b'\xe2bC\xec\x1cV\x00\x00\xff\xd0H\x8b]\xf0L\x8be\xe8\x90\x90\x90\x90H\xbf'
+    b'\xb0\x00\x00\x00\x00\x00\x00\x00\x90\x90\x90\x90\x90\x90H\xb8\xf23B\xec'
+    b'\x1cV\x00\x00\xff\xd0H\x89E\xa8H\x89]\xb0L\x89e\xb8H\x8dU\xb0H\x8b}\xa8'
+    b'\xbe\x02\x00\x00\x00\x90\x90\x90H\xb8\x04RB\xec\x1cV\x00\x00\xff\xd0A]A'
+    b'\\[\xc9\xc3\x80\x05\x00\x10\x02\x00\x00\x05(\x01"\x01\xff\x00\x00\xa6'
+    b'\x04\x00\x00\x00\x00\x00\x00\xaa\x04\x00\x00\x00\x00\x00\x00\x10\x02\x81'
+    b'\x10\x00\x08 \x00)8\x01\x07getattrH\x00\x03p\x00\x17\x81\t\x02\x01m\x81'
+    b'\x0b\x02\x11mpy_native_mod.py\x81\x10\x03\x04self\x81\x18\x03\x04name'
+    b'\x03\x84XUH\x89\xe5H\x81\xec\xc8\x00\x00\x00SATAUH\x89\xbd8\xff\xff\xff'
+    b'\xbf<\x02\x00\x00H\x89\xbd@\xff\xff\xffH\x8d\xbd8\xff\xff\xff\x90\x90'
+    b'\x90\x90H\xb8\xe2bC\xec\x1cV\x00\x00\xff\xd0H\x8b]\xf8L\x8be\xf0L\x8bm'
+    b'\xe8H\x8d\xbd8\xff\xff\xff\x90H\xb8O\x03A\xec\x1cV\x00\x00\xff\xd0\x84'
+    b'\xc0\x0f\x85m\x00\x00\x00\x90\x90\x90\x90H\xbft\x00\x00\x00\x00\x00\x00'
+    b'\x00\x90\x90\x90\x90\x90\x90H\xb8\xf23B\xec\x1cV\x00\x00\xff\xd0H\x89E'
+    b'\xa0H\x89]\xa8H\x8dU\xa8H\x8b}\xa0\xbe\x01\x00\x00\x00\x90\x90\x90\x90'
+    b'\x90\x90\x90H\xb8\x04RB\xec\x1cV\x00\x00\xff\xd0H\x89\xc7\x90H\xb8>TB'
+    b'\xec\x1cV\x00\x00\xff\xd0\x90\x90\x90\x90H\xb8=\x03A\xec\x1cV\x00\x00'
+    b'\xff\xd0\xe9c\x01\x00\x00H\x8b\xbd@\xff\xff\xffH\x89\xbd8\xff\xff\xffH'
+    b'\x89\xbd@\xff\xff\xffH\x89\xbdH\xff\xff\xffH\x89\xbdP\xff\xff\xff\x90'
+    b'\x90\x90\x90H\xbft\x00\x00\x00\x00\x00\x00\x00\x90\x90\x90\x90\x90\x90H'
+    b'\xb8\xf23B\xec\x1cV\x00\x00\xff\xd0H\x89\xc2H\x8b\xb5P\xff\xff\xff\xbf'
+    b'\x08\x00\x00\x00\x90\x90\x90\x90\x90H\xb8cLB\xec\x1cV\x00\x00\xff\xd0H'
+    b'\x89\xc7\x90H\xb8|hB\xec\x1cV\x00\x00\xff\xd0\x84\xc0\x0f\x84\xd5\x00'
+    b'\x00\x00L\x8b\xa5H\xff\xff\xffH\x8d\xbdH\xff\xff\xff\x90\x90\x90\x90\x90'
+    b'\x90H\xb8O\x03A\xec\x1cV\x00\x00\xff\xd0\x84\xc0\x0f\x85m\x00\x00\x00'
+    b'\x90\x90\x90\x90H\xbf\xf4\x00\x00\x00\x00\x00\x00\x00\x90\x90\x90\x90'
+    b'\x90\x90H\xb8\xf23B\xec\x1cV\x00\x00\xff\xd0H\x89E\xb0L\x89e\xb8H\x8dU'
+    b'\xb8H\x8b}\xb0\xbe\x01\x00\x00\x00\x90\x90\x90\x90\x90\x90\x90H\xb8\x04R'
+    b'B\xec\x1cV\x00\x00\xff\xd0I\x89\xc5\x90H\xb8=\x03A\xec\x1cV\x00\x00\xff'
+    b'\xd0\x90\x90\x90\x90H\xb8P;D\xec\x1cV\x00\x00H\x89\x85P\xff\xff\xff\x90'
+    b'\x90\x90\x90\x90\x90\x90I\xbcP;D\xec\x1cV\x00\x00\x90\x90\x90\x90\x90'
+    b'\x90I\xbcP;D\xec\x1cV\x00\x00H\x8b\xbdP\xff\xff\xff\x90\x90\x90\x90\x90'
+    b'\x90\x90H\xb8>TB\xec\x1cV\x00\x00\xff\xd0\xe9\x13\x00\x00\x00H\x8b\xbdH'
+    b'\xff\xff\xffH\xb8>TB\xec\x1cV\x00\x00\xff\xd0L\x89\xe8A]A\\[\xc9\xc3\x80'
+    b'\x14\x00\x10\x01\x00\x00\x05+\x01"\x01\xff\x00\x00\x00\x00\x00\x00\x00'
+    b'\x92\x04\x00\x00\x00\x00\x00\x00\x10\x01\x84P\x00\x180\x00)P\x00\x1ch'
+    b'\x01\nValueErrorx\x00\x03\x81 \x00\x17\x810\x00\x1e\x81@\x00\x1d\x81x'
+    b'\x01\nValueError\x82\x08\x00\x03\x82(\x00\x0e\x828\x00\x0c\x82`\x00\x1c'
+    b'\x82x\x01\x04repr\x83\x08\x00\x03\x830\x00\x17\x83@\x00\x1d\x83P\x04n'
+    b'\x83h\x04n\x83x\x04n\x84\x10\x00\x1e\x84(\x00\x1e\x84D\x02\x03err\x84F'
+    b'\x02\x11mpy_native_mod.py\x84P\x03\x01x\x04vUH\x89\xe5H\x83\xec(SATAUH'
+    b'\x89\xfbA\xbc\x00\x00\x00\x00H\x89]\xd8\xb8\x00\x00\x00\x00H\x89E\xe0'
+    b'\xe9$\x00\x00\x00H\x8bE\xe0I\x89\xc5L\x89\xe6L\x01\xeeI\x89\xf4H\x89E'
+    b'\xe0\xba\x01\x00\x00\x00H\x8bu\xe0H\x01\xd6H\x89u\xe0H\x8bE\xe0H\x8b}'
+    b'\xd8H\x89E\xe0H\x89}\xd8H\x89\xc6H1\xc0H9\xfe\x0f\x9c\xc0\x84\xc0u\xbcL'
+    b'\x89\xe0A]A\\[\xc9\xc3\x10\x01"\x00\x00'
+)
+
+with open("mpy_native_mod.mpy", "wb") as f:
+    f.write(mpy)
+sys.path.insert(0, "")
+try:
+    import mpy_native_mod as mod
+except MpyError:
+    # .mpy built for a different configuration or architecture
+    mod = None
+finally:
+    sys.path.pop(0)
+    os.unlink("mpy_native_mod.mpy")
+if mod is None:
+    print("SKIP")
+    raise SystemExit
+
+print(mod.f("aot"))
+print(mod.C().m("attr"))
+print(mod.err("native"))
+print(mod.vsum(100))
@@ -0,0 +1,27 @@
+# test that a hot function uses the globals of its own module when it's called
+# from another one
+
+import sys
+
+try:
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+remove = getattr(uos, "remove", None) or getattr(uos, "unlink")
+
+MOD = "jit_globals_mod"
+K = 100
+
+with open(MOD + ".py", "w") as f:
+    f.write("K = 5\ndef f(n):\n    s = 0\n    for i in range(n):\n        s += K\n    return s\n")
+
+sys.path.insert(0, "")
+try:
+    mod = __import__(MOD)
+    for rep in range(3):
+        print(mod.f(2000))
+finally:
+    sys.path.pop(0)
+    sys.modules.pop(MOD, None)
+    remove(MOD + ".py")
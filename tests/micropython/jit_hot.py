@@ -0,0 +1,66 @@
+# test that functions which become hot give the same results after the JIT
+# compiles them; without a JIT they just run as bytecode
+
+
+def loop(n, k=3, *, z=2):
+    s = 0
+    i = 0
+    while i < n:
+        s += i * k + z
+        i += 1
+    return s
+
+
+def for_loops(n):
+    t = 0
+    for x in range(n):
+        t += x % 7
+    for x in [1, 2, 3] * (n // 3):
+        t -= x
+    return t
+
+
+def outer(a):
+    def inner(n):
+        s = 0
+        for i in range(n):
+            s += a
+        return s
+
+    return inner
+
+
+class C:
+    def m(self, n):
+        r = []
+        for i in range(n):
+            if i % 500 == 0:
+                r.append(i)
+        return r
+
+
+def raiser(n):
+    for i in range(n):
+        pass
+    raise ValueError(n)
+
+
+# generators stay as bytecode
+def gen(n):
+    i = 0
+    while i < n:
+        yield i
+        i += 1
+
+
+for rep in range(3):
+    print(loop(2000), loop(2000, 5, z=1), for_loops(3000))
+    f = outer(rep)
+    print(f(1500), f(1500))
+    print(C().m(2000))
+    try:
+        raiser(1500)
+    except ValueError as e:
+        print("ValueError", e)
+    print(sum(gen(1500)))
+    print(loop.__name__)
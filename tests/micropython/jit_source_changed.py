@@ -0,0 +1,31 @@
+# test that the JIT doesn't compile a hot function from its source file once
+# that file has changed, even if the new bytecode only differs in a constant
+
+import sys
+
+try:
+    import uos
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+remove = getattr(uos, "remove", None) or getattr(uos, "unlink")
+
+MOD = "jit_source_mod"
+
+def write(value):
+    with open(MOD + ".py", "w") as f:
+        f.write("def f(n):\n    s = 0\n    for i in range(n):\n        s += %s\n    return s\n" % value)
+        f.write("def g(n):\n    h = lambda: %s\n    s = 0\n    for i in range(n):\n        s += h()\n    return s\n" % value)
+
+sys.path.insert(0, "")
+try:
+    write("1.5")
+    mod = __import__(MOD)
+    # the same size, and likely the same mtime
+    write("2.5")
+    for rep in range(3):
+        print(mod.f(10), mod.f(2000), mod.g(10), mod.g(2000))
+finally:
+    sys.path.pop(0)
+    sys.modules.pop(MOD, None)
+    remove(MOD + ".py")
@@ -0,0 +1,69 @@
+# test that tracebacks through hot functions have the same entries, with the
+# same line numbers, as they do as bytecode
+
+import sys
+
+try:
+    import uio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def print_exc(e):
+    buf = uio.StringIO()
+    sys.print_exception(e, buf)
+    for l in buf.getvalue().split("\n"):
+        # remove the file name, which depends on how the test is run
+        if l.startswith("  File "):
+            l = l.split('"')
+            print(l[0], l[2])
+        else:
+            print(l)
+
+
+def inner(x):
+    return x + None
+
+
+def call_inner(n):
+    t = 0
+    for i in range(n):
+        t += i
+        if i == n - 1:
+            inner(t)
+    return t
+
+
+def raise_in_loop(n):
+    i = 0
+    while True:
+        i += 1
+        if i > n:
+            raise ValueError(
+                i)
+
+
+def multiline(n, m):
+    for i in range(n):
+        pass
+    return m[
+        n]
+
+
+def bad_args(n):
+    for i in range(n):
+        pass
+
+
+for rep in range(3):
+    for f, args in (
+        (call_inner, (1500,)),
+        (raise_in_loop, (1500,)),
+        (multiline, (1500, [])),
+        (bad_args, (1500, 1)),
+    ):
+        try:
+            f(*args)
+        except Exception as e:
+            print_exc(e)
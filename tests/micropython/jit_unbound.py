@@ -0,0 +1,52 @@
+# test that hot functions which may load an unbound local raise NameError as
+# they do as bytecode, rather than running as native code that doesn't check
+
+
+def cond(n, flag):
+    for i in range(n):
+        pass
+    if flag:
+        y = 1
+    return y
+
+
+def deleted(n):
+    x = 1
+    for i in range(n):
+        pass
+    del x
+    return x
+
+
+def loop_var(n):
+    j = 0
+    while j < 1500:
+        j += 1
+    for i in range(n):
+        pass
+    return i
+
+
+def cell(n, flag):
+    for i in range(n):
+        pass
+    if flag:
+        y = n
+    g = lambda: y
+    return y
+
+
+for rep in range(3):
+    for f, args in (
+        (cond, (1500, True)),
+        (cond, (1500, False)),
+        (deleted, (1500,)),
+        (loop_var, (3,)),
+        (loop_var, (0,)),
+        (cell, (1500, True)),
+        (cell, (1500, False)),
+    ):
+        try:
+            print(f(*args))
+        except NameError:
+            print("NameError")
@@ -0,0 +1,74 @@
+# test that hot functions using with, try or raise without an argument behave
+# as they do as bytecode
+
+
+class CM:
+    n = 0
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, a, b, c):
+        CM.n += 1
+
+
+def with_continue(n):
+    for i in range(n):
+        with CM():
+            if i % 2:
+                continue
+    return CM.n
+
+
+def with_break(n):
+    for i in range(n):
+        with CM():
+            if i == n - 1:
+                break
+    return CM.n
+
+
+def with_return(n):
+    for i in range(n):
+        pass
+    with CM():
+        return CM.n
+
+
+def finally_continue(n):
+    c = 0
+    for i in range(n):
+        try:
+            if i % 3:
+                continue
+        finally:
+            c += 1
+    return c
+
+
+def finally_return(n):
+    for i in range(n):
+        pass
+    try:
+        return "try"
+    finally:
+        print("finally")
+
+
+def reraise(n):
+    for i in range(n):
+        pass
+    try:
+        raise ValueError(n)
+    except ValueError:
+        raise
+
+
+for rep in range(3):
+    CM.n = 0
+    print(with_continue(1500), with_break(1500), with_return(1500))
+    print(finally_continue(1500), finally_return(1500))
+    try:
+        reraise(1500)
+    except ValueError as e:
+        print("ValueError", e)
@@ -0,0 +1,39 @@
+# test the uprofile sampling profiler
+
+try:
+    import uprofile
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# nothing recorded yet
+uprofile.clear()
+print(uprofile.report())
+print(uprofile.missed())
+
+def work():
+    x = 0
+    for i in range(100000):
+        x += i
+    return x
+
+# how many samples land depends on timing, so only check things that hold
+# however many there are, including none
+uprofile.start()
+work()
+uprofile.stop()
+r = uprofile.report()
+print(type(r))
+print(all([len(e) == 4 and e[0] > 0 for e in r]))
+print(all([func in ("work", "<module>") for count, file, func, line in r]))
+print(all([r[i][0] >= r[i + 1][0] for i in range(len(r) - 1)]))
+
+# nothing is counted while stopped
+n = (sum([e[0] for e in r]), uprofile.missed())
+work()
+print(n == (sum([e[0] for e in uprofile.report()]), uprofile.missed()))
+
+# clear resets the counts
+uprofile.clear()
+print(uprofile.report())
+print(uprofile.missed())
@@ -0,0 +1,91 @@
+# test viper float type: arithmetic, comparison and conversion
+
+import micropython
+
+# skip if floats can't be held natively by viper
+try:
+    exec("@micropython.viper\ndef f(x: float) -> float: return x")
+except (ViperTypeError, NameError):
+    print("SKIP")
+    raise SystemExit
+@micropython.viper
+def add(a: float, b: float) -> float:
+    return a + b
+print(add(1.5, 2.25))
+
+@micropython.viper
+def poly(x: float) -> float:
+    return 3.0 * x * x - 2.0 * x + 0.5
+print(poly(2.0), poly(-1.5))
+
+@micropython.viper
+def mixed(x: float, n: int) -> float:
+    return x * n + n - (-x)
+print(mixed(0.5, 4))
+
+@micropython.viper
+def conv(x: float) -> int:
+    return int(x) + int(-x) * 10
+print(conv(3.7))
+
+@micropython.viper
+def tofloat(n: int) -> float:
+    return float(n) / 4
+print(tofloat(-3))
+
+@micropython.viper
+def cmp(a: float, b: float) -> object:
+    return (a < b, a > b, a == b, a <= b, a >= b, a != b)
+print(cmp(1.0, 2.0), cmp(2.0, 2.0))
+
+@micropython.viper
+def acc(l) -> float:
+    s = 0.0
+    for v in l:
+        s += float(v) * 0.5
+    return s
+print(acc([1, 2, 3.5]))
+
+@micropython.viper
+def ops(a: float, b: float) -> object:
+    return (a // b, a % b, a ** b, a / b)
+print(ops(7.0, 2.0), ops(-7.0, 2.0))
+
+@micropython.viper
+def box(a: float):
+    print(a, a * 2.0)
+box(1.25)
+
+@micropython.viper
+def zdiv(a: float) -> float:
+    return a / 0.0
+try:
+    zdiv(1.0)
+except ZeroDivisionError:
+    print('ZeroDivisionError')
+
+@micropython.viper
+def big(a: float) -> int:
+    return int(a)
+try:
+    big(float('inf'))
+except OverflowError:
+    print('OverflowError')
+print(big(-2.5))
+
+# a float constant with an object is boxed
+@micropython.viper
+def objop(x):
+    return (x * 2.5, 2.5 - x, x < 2.5, x == 1.5)
+print(objop(2), objop(1.5))
+
+# errors specific to floats
+def test(code):
+    try:
+        exec(code)
+    except ViperTypeError as e:
+        print(repr(e))
+
+test("@micropython.viper\ndef f(x: float): y = x | x")
+test("@micropython.viper\ndef f(x: float): y = x + None")
+test("@micropython.viper\ndef f(x: float):\n if x: pass")
@@ -0,0 +1,53 @@
+# test uos.MmapBlockDev, a block device on a mapped disk image
+
+try:
+    import uos
+    uos.MmapBlockDev
+    uos.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+path = (uos.getenv("TMPDIR") or "/tmp") + "/micropython-test-blockdev.img"
+
+bdev = uos.MmapBlockDev(path, 512, 128, erase_size=4096)
+print(bdev.ioctl(4, 0), bdev.ioctl(5, 0), bdev.ioctl(7, 0))
+
+# raw block access
+buf = bytearray(1024)
+bdev.readblocks(3, buf)
+print(buf[0], buf[-1])
+bdev.writeblocks(3, b"\x01" * 1024)
+bdev.readblocks(4, memoryview(buf)[:512])
+print(buf[0], buf[511], buf[512])
+print(bdev.stats(True))
+# writing over data that isn't erased costs an erase per erase unit
+bdev.writeblocks(7, bytes(1024))
+bdev.writeblocks(3, bytes(512))
+print(bdev.stats())
+try:
+    bdev.readblocks(127, buf)
+except OSError as e:
+    print("OSError", e.args[0])
+
+# a FAT filesystem on it survives closing and reopening the image
+uos.VfsFat.mkfs(bdev)
+uos.mount(uos.VfsFat(bdev), "/mmapfs")
+with open("/mmapfs/hello.txt", "w") as f:
+    f.write("hello " * 200)
+uos.umount("/mmapfs")
+bdev.close()
+try:
+    bdev.stats()
+except ValueError:
+    print("ValueError")
+
+bdev = uos.MmapBlockDev(path, 512, xfer=8)
+print(bdev.ioctl(4, 0), bdev.ioctl(7, 0))
+uos.mount(uos.VfsFat(bdev), "/mmapfs")
+print(uos.listdir("/mmapfs"))
+with open("/mmapfs/hello.txt") as f:
+    print(len(f.read()))
+uos.umount("/mmapfs")
+bdev.close()
+uos.remove(path)
@@ -57,7 +57,7 @@ class FreezeError(Exception):
         return 'error while freezing %s: %s' % (self.rawcode.source_file, self.msg)
 
 class Config:
-    MPY_VERSION = 3
+    MPY_VERSION = 4
     MICROPY_LONGINT_IMPL_NONE = 0
     MICROPY_LONGINT_IMPL_LONGLONG = 1
     MICROPY_LONGINT_IMPL_MPZ = 2
@@ -254,6 +254,87 @@ class RawCode:
             rc.freeze('')
         # TODO
 
+    def freeze_const_obj(self, sizes, obj_name, obj):
+        if is_const_rom_obj(obj):
+            pass
+        elif obj is Ellipsis:
+            print('#define %s mp_const_ellipsis_obj' % obj_name)
+        elif is_str_type(obj) or is_bytes_type(obj):
+            if is_str_type(obj):
+                obj = bytes_cons(obj, 'utf8')
+                obj_type = 'mp_type_str'
+            else:
+                obj_type = 'mp_type_bytes'
+            print('STATIC const mp_obj_str_t %s = {{&%s}, %u, %u, (const byte*)"%s"}; // %s'
+                % (obj_name, obj_type, qstrutil.compute_hash(obj, config.MICROPY_QSTR_BYTES_IN_HASH, config.MICROPY_QSTR_HASH_FNV1A),
+                    len(obj), ''.join(('\\x%02x' % b) for b in obj), obj))
+            sizes["strings"] += len(obj)
+            sizes["string_overhead"] += 16
+
+        elif is_int_type(obj):
+            if config.MICROPY_LONGINT_IMPL == config.MICROPY_LONGINT_IMPL_NONE:
+                # TODO check if we can actually fit this long-int into a small-int
+                raise FreezeError(self, 'target does not support long int')
+            elif config.MICROPY_LONGINT_IMPL == config.MICROPY_LONGINT_IMPL_LONGLONG:
+                # TODO
+                raise FreezeError(self, 'freezing int to long-long is not implemented')
+            elif config.MICROPY_LONGINT_IMPL == config.MICROPY_LONGINT_IMPL_MPZ:
+                neg = 0
+                if obj < 0:
+                    obj = -obj
+                    neg = 1
+                bits_per_dig = config.MPZ_DIG_SIZE
+                digs = []
+                z = obj
+                while z:
+                    digs.append(z & ((1 << bits_per_dig) - 1))
+                    z >>= bits_per_dig
+                ndigs = len(digs)
+                digs = ','.join(('%#x' % d) for d in digs)
+                print('STATIC const mp_obj_int_t %s = {{&mp_type_int}, '
+                    '{.neg=%u, .fixed_dig=1, .alloc=%u, .len=%u, .dig=(uint%u_t[]){%s}}};'
+                    % (obj_name, neg, ndigs, ndigs, bits_per_dig, digs))
+                sizes["number_overhead"] += 16
+        elif type(obj) is float:
+            print('#if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_A || MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_B')
+            print('STATIC const mp_obj_float_t %s = {{&mp_type_float}, %.16g};'
+                % (obj_name, obj))
+            print('#endif')
+            sizes["number_overhead"] += 8
+        elif type(obj) is complex:
+            print('STATIC const mp_obj_complex_t %s = {{&mp_type_complex}, %.16g, %.16g};'
+                % (obj_name, obj.real, obj.imag))
+            sizes["number_overhead"] += 12
+        elif type(obj) is tuple:
+            for i, item in enumerate(obj):
+                self.freeze_const_obj(sizes, '%s_%u' % (obj_name, i), item)
+            print('STATIC const mp_rom_obj_tuple_t %s = {{&mp_type_tuple}, %u, {'
+                % (obj_name, len(obj)))
+            for i, item in enumerate(obj):
+                self.print_const_rom_obj('%s_%u' % (obj_name, i), item)
+            print('}};')
+            sizes["number_overhead"] += 8 + 4 * len(obj)
+        else:
+            raise FreezeError(self, 'freezing of object %r is not implemented' % (obj,))
+
+    def print_const_rom_obj(self, obj_name, obj):
+        if obj is None or obj is False or obj is True:
+            print('    MP_ROM_PTR(&mp_const_%s_obj),' % str(obj).lower())
+        elif is_const_rom_obj(obj):
+            print('    MP_ROM_INT(%d),' % obj)
+        elif type(obj) is float:
+            print('#if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_A || MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_B')
+            print('    MP_ROM_PTR(&%s),' % obj_name)
+            print('#elif MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C')
+            n = struct.unpack('<I', struct.pack('<f', obj))[0]
+            n = ((n & ~0x3) | 2) + 0x80800000
+            print('    (mp_rom_obj_t)(0x%08x),' % (n,))
+            print('#else')
+            print('#error "MICROPY_OBJ_REPR_D not supported with floats in frozen mpy files"')
+            print('#endif')
+        else:
+            print('    MP_ROM_PTR(&%s),' % obj_name)
+
     def freeze(self, parent_name):
         self.escaped_name = parent_name + self.simple_name.qstr_esc
 
@@ -314,56 +395,7 @@ class RawCode:
         # generate constant objects
         for i, obj in enumerate(self.objs):
             obj_name = 'const_obj_%s_%u' % (self.escaped_name, i)
-            if obj is Ellipsis:
-                print('#define %s mp_const_ellipsis_obj' % obj_name)
-            elif is_str_type(obj) or is_bytes_type(obj):
-                if is_str_type(obj):
-                    obj = bytes_cons(obj, 'utf8')
-                    obj_type = 'mp_type_str'
-                else:
-                    obj_type = 'mp_type_bytes'
-                print('STATIC const mp_obj_str_t %s = {{&%s}, %u, %u, (const byte*)"%s"}; // %s'
-                    % (obj_name, obj_type, qstrutil.compute_hash(obj, config.MICROPY_QSTR_BYTES_IN_HASH),
-                        len(obj), ''.join(('\\x%02x' % b) for b in obj), obj))
-                sizes["strings"] += len(obj)
-                sizes["string_overhead"] += 16
-
-            elif is_int_type(obj):
-                if config.MICROPY_LONGINT_IMPL == config.MICROPY_LONGINT_IMPL_NONE:
-                    # TODO check if we can actually fit this long-int into a small-int
-                    raise FreezeError(self, 'target does not support long int')
-                elif config.MICROPY_LONGINT_IMPL == config.MICROPY_LONGINT_IMPL_LONGLONG:
-                    # TODO
-                    raise FreezeError(self, 'freezing int to long-long is not implemented')
-                elif config.MICROPY_LONGINT_IMPL == config.MICROPY_LONGINT_IMPL_MPZ:
-                    neg = 0
-                    if obj < 0:
-                        obj = -obj
-                        neg = 1
-                    bits_per_dig = config.MPZ_DIG_SIZE
-                    digs = []
-                    z = obj
-                    while z:
-                        digs.append(z & ((1 << bits_per_dig) - 1))
-                        z >>= bits_per_dig
-                    ndigs = len(digs)
-                    digs = ','.join(('%#x' % d) for d in digs)
-                    print('STATIC const mp_obj_int_t %s = {{&mp_type_int}, '
-                        '{.neg=%u, .fixed_dig=1, .alloc=%u, .len=%u, .dig=(uint%u_t[]){%s}}};'
-                        % (obj_name, neg, ndigs, ndigs, bits_per_dig, digs))
-                    sizes["number_overhead"] += 16
-            elif type(obj) is float:
-                print('#if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_A || MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_B')
-                print('STATIC const mp_obj_float_t %s = {{&mp_type_float}, %.16g};'
-                    % (obj_name, obj))
-                print('#endif')
-                sizes["number_overhead"] += 8
-            elif type(obj) is complex:
-                print('STATIC const mp_obj_complex_t %s = {{&mp_type_complex}, %.16g, %.16g};'
-                    % (obj_name, obj.real, obj.imag))
-                sizes["number_overhead"] += 12
-            else:
-                raise FreezeError(self, 'freezing of object %r is not implemented' % (obj,))
+            self.freeze_const_obj(sizes, obj_name, obj)
 
         # generate constant table, if it has any entries
         const_table_len = len(self.qstrs) + len(self.objs) + len(self.raw_codes)
@@ -375,18 +407,7 @@ class RawCode:
                 print('    MP_ROM_QSTR(%s),' % global_qstrs[qst].qstr_id)
             for i in range(len(self.objs)):
                 sizes["const_table_overhead"] += 4
-                if type(self.objs[i]) is float:
-                    print('#if MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_A || MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_B')
-                    print('    MP_ROM_PTR(&const_obj_%s_%u),' % (self.escaped_name, i))
-                    print('#elif MICROPY_OBJ_REPR == MICROPY_OBJ_REPR_C')
-                    n = struct.unpack('<I', struct.pack('<f', self.objs[i]))[0]
-                    n = ((n & ~0x3) | 2) + 0x80800000
-                    print('    (mp_rom_obj_t)(0x%08x),' % (n,))
-                    print('#else')
-                    print('#error "MICROPY_OBJ_REPR_D not supported with floats in frozen mpy files"')
-                    print('#endif')
-                else:
-                    print('    MP_ROM_PTR(&const_obj_%s_%u),' % (self.escaped_name, i))
+                self.print_const_rom_obj('const_obj_%s_%u' % (self.escaped_name, i), self.objs[i])
             for rc in self.raw_codes:
                 sizes["const_table_overhead"] += 4
                 print('    MP_ROM_PTR(&raw_code_%s),' % rc.escaped_name)
@@ -427,6 +448,13 @@ def read_uint(f):
 
 global_qstrs = []
 qstr_type = namedtuple('qstr', ('str', 'qstr_esc', 'qstr_id'))
+def is_const_rom_obj(obj):
+    # whether obj is a singleton or an int that's small on all targets, and so
+    # can go in a table of mp_rom_obj_t without an object of its own
+    if obj is None or obj is False or obj is True:
+        return True
+    return is_int_type(obj) and -0x20000000 <= obj <= 0x1fffffff
+
 def read_qstr(f):
     ln = read_uint(f)
     data = str_cons(f.read(ln), 'utf8')
@@ -438,6 +466,14 @@ def read_obj(f):
     obj_type = f.read(1)
     if obj_type == b'e':
         return Ellipsis
+    elif obj_type == b'n':
+        return None
+    elif obj_type == b'F':
+        return False
+    elif obj_type == b'T':
+        return True
+    elif obj_type == b't':
+        return tuple(read_obj(f) for _ in range(read_uint(f)))
     else:
         buf = f.read(read_uint(f))
         if obj_type == b's':
@@ -487,6 +523,8 @@ def read_mpy(filename):
         if header[1] != config.MPY_VERSION:
             raise Exception('incompatible .mpy version')
         feature_flags = header[2]
+        if feature_flags >> 2:
+            raise Exception('freezing of native code is not implemented')
         config.MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE = (feature_flags & 1) != 0
         config.MICROPY_PY_BUILTINS_STR_UNICODE = (feature_flags & 2) != 0
         config.mp_small_int_bits = header[3]
@@ -510,6 +548,7 @@ def freeze_mpy(base_qstrs, raw_codes):
     print('#include "py/mpconfig.h"')
     print('#include "py/objint.h"')
     print('#include "py/objstr.h"')
+    print('#include "py/objtuple.h"')
     print('#include "py/emitglue.h"')
     print()
 
@@ -555,6 +594,16 @@ def freeze_mpy(base_qstrs, raw_codes):
             print('    MP_QSTR_%s,' % new[i][1])
     print('};')
 
+    hash_index = qstrutil.make_hash_index([qstrutil.compute_hash_full(bytes_cons(qstr, 'utf8'),
+        config.MICROPY_QSTR_HASH_FNV1A) for _, _, qstr in new])
+    print()
+    print('#if MICROPY_QSTR_HASH_INDEX')
+    print('STATIC const uint16_t mp_qstr_frozen_const_hash_index[] = {')
+    for i in range(0, len(hash_index), 16):
+        print('    %s,' % ', '.join(str(e) for e in hash_index[i:i + 16]))
+    print('};')
+    print('#endif')
+
     print()
     print('extern const qstr_pool_t mp_qstr_const_pool;');
     print('const qstr_pool_t mp_qstr_frozen_const_pool = {')
@@ -562,13 +611,18 @@ def freeze_mpy(base_qstrs, raw_codes):
     print('    MP_QSTRnumber_of, // previous pool size')
     print('    %u, // allocated entries' % len(new))
     print('    %u, // used entries' % len(new))
+    print('    #if MICROPY_QSTR_HASH_INDEX')
+    print('    mp_qstr_frozen_const_hash_index,')
+    print('    %u, // hash index mask' % (len(hash_index) - 1))
+    print('    #endif')
     print('    {')
     qstr_size = {"metadata": 0, "data": 0}
     for _, _, qstr in new:
         qstr_size["metadata"] += config.MICROPY_QSTR_BYTES_IN_LEN + config.MICROPY_QSTR_BYTES_IN_HASH
         qstr_size["data"] += len(qstr)
         print('        %s,'
-            % qstrutil.make_bytes(config.MICROPY_QSTR_BYTES_IN_LEN, config.MICROPY_QSTR_BYTES_IN_HASH, qstr))
+            % qstrutil.make_bytes(config.MICROPY_QSTR_BYTES_IN_LEN, config.MICROPY_QSTR_BYTES_IN_HASH, qstr,
+                config.MICROPY_QSTR_HASH_FNV1A))
     print('    },')
     print('};')
 
@@ -632,9 +686,11 @@ def main():
         qcfgs, base_qstrs, _ = qstrutil.parse_input_headers([args.qstr_header])
         config.MICROPY_QSTR_BYTES_IN_LEN = int(qcfgs['BYTES_IN_LEN'])
         config.MICROPY_QSTR_BYTES_IN_HASH = int(qcfgs['BYTES_IN_HASH'])
+        config.MICROPY_QSTR_HASH_FNV1A = int(qcfgs.get('HASH_FNV1A', '0')) != 0
     else:
         config.MICROPY_QSTR_BYTES_IN_LEN = 1
         config.MICROPY_QSTR_BYTES_IN_HASH = 1
+        config.MICROPY_QSTR_HASH_FNV1A = False
         base_qstrs = {}
 
     raw_codes = [read_mpy(file) for file in args.files]